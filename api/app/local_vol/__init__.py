@@ -8,12 +8,13 @@ Stages
 3. iv_surface — bicubic spline implied-vol surface in (y, T) space        [Python]
 4. dupire     — Gatheral (2004) formula → local vol surface + grid export [Python]
 5. cpp_bridge — adapter that passes the grid to the C++ Euler-Maruyama MC [C++]
+                and the forward Dupire PDE for whole-surface repricing
 """
 from .cleaner import CleaningStats, clean_chain
 from .dupire import LocalVolSurface, calibrate_dupire
 from .fetcher import OptionQuote, fetch_option_chain
 from .iv_surface import IVSurface, build_iv_surface
-from .cpp_bridge import LocalVolPricingResult, price_with_local_vol
+from .cpp_bridge import LocalVolPricingResult, LocalVolRepricing, price_with_local_vol, reprice_surface
 
 __all__ = [
     "OptionQuote",
@@ -26,4 +27,6 @@ __all__ = [
     "calibrate_dupire",
     "LocalVolPricingResult",
     "price_with_local_vol",
+    "LocalVolRepricing",
+    "reprice_surface",
 ]
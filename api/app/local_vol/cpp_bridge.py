@@ -17,12 +17,16 @@ Public API
 ----------
 LocalVolPricingResult
 price_with_local_vol(local_vol, spot, strike, ...) -> LocalVolPricingResult
+LocalVolRepricing
+reprice_surface(local_vol, spot, rate, dividend, strikes, maturities) -> LocalVolRepricing
 """
 from __future__ import annotations
 
 import logging
 from dataclasses import dataclass, field
-from typing import Optional
+from typing import Optional, Sequence
+
+import numpy as np
 
 from .dupire import LocalVolSurface
 
@@ -61,6 +65,20 @@ class LocalVolPricingResult:
     diagnostics: str = field(default="")
 
 
+@dataclass
+class LocalVolRepricing:
+    """Call prices and implied vols on a strike × maturity grid (forward PDE).
+
+    Arrays have shape (len(strikes), len(maturities)); implied vols are NaN
+    where the price cannot be inverted.
+    """
+    strikes: np.ndarray
+    maturities: np.ndarray
+    call_prices: np.ndarray
+    implied_vols: np.ndarray
+    diagnostics: str = field(default="")
+
+
 # ---------------------------------------------------------------------------
 # Public API
 # ---------------------------------------------------------------------------
@@ -153,3 +171,66 @@ def price_with_local_vol(
     )
 
     return res
+
+
+def reprice_surface(
+    local_vol: LocalVolSurface,
+    spot: float,
+    rate: float,
+    dividend: float,
+    strikes: Sequence[float],
+    maturities: Sequence[float],
+    pde_space_steps: int = 400,
+    pde_time_steps: int = 200,
+) -> LocalVolRepricing:
+    """
+    Reprice a whole strike × maturity grid under a calibrated local-vol
+    surface with one forward Dupire PDE solve in C++.
+
+    Comparing ``implied_vols`` with the input implied-vol surface measures
+    the calibration's repricing error.
+
+    Parameters
+    ----------
+    local_vol : LocalVolSurface
+        Calibrated Dupire surface from :func:`dupire.calibrate_dupire`.
+    spot, rate, dividend : float
+    strikes, maturities : sequence of float
+        Strictly increasing and positive.
+    pde_space_steps, pde_time_steps : int
+        Strike nodes, and time steps to the last maturity.
+
+    Returns
+    -------
+    LocalVolRepricing
+    """
+    qm = _import_cpp()
+
+    surface = qm.LocalVolSurface()
+    surface.K_grid = local_vol.K_grid
+    surface.T_grid = local_vol.T_grid
+    surface.sigma_loc_flat = local_vol.sigma_loc_flat
+
+    inp = qm.LocalVolCallSurfaceInput()
+    inp.spot            = float(spot)
+    inp.rate            = float(rate)
+    inp.dividend        = float(dividend)
+    inp.surface         = surface
+    inp.strikes         = [float(k) for k in strikes]
+    inp.maturities      = [float(t) for t in maturities]
+    inp.pde_space_steps = int(pde_space_steps)
+    inp.pde_time_steps  = int(pde_time_steps)
+
+    out: dict = qm.price_local_vol_call_surface(inp)
+    shape = (len(inp.strikes), len(inp.maturities))
+
+    res = LocalVolRepricing(
+        strikes=np.asarray(out["strikes"], dtype=float),
+        maturities=np.asarray(out["maturities"], dtype=float),
+        call_prices=np.asarray(out["call_prices"], dtype=float).reshape(shape),
+        implied_vols=np.asarray(out["implied_vols"], dtype=float).reshape(shape),
+        diagnostics=str(out.get("diagnostics", "")),
+    )
+
+    logger.info("cpp_bridge (C++): %s", res.diagnostics)
+    return res
@@ -0,0 +1,96 @@
+#ifndef CALIBRATION_IMPLIED_VOL_HPP
+#define CALIBRATION_IMPLIED_VOL_HPP
+
+#include "quantModeling/core/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace quantModeling
+{
+
+    // ─────────────────────────────────────────────────────────────────────────
+    //  Normalised Black function
+    // ─────────────────────────────────────────────────────────────────────────
+
+    /**
+     * @brief Normalised Black price b(x, s) = price / (df · √(F K)).
+     *
+     *   x = ln(F / K),  s = σ √T
+     *   call: b = e^{x/2} N(x/s + s/2) − e^{−x/2} N(x/s − s/2)
+     *
+     * Evaluated through erfcx (with a Taylor series for the near-cancelling
+     * difference of two erfcx values) so out-of-the-money
+     * prices keep full relative precision (this is what makes the inversion
+     * accurate for tiny prices).
+     */
+    Real normalised_black(Real x, Real s, bool is_call);
+
+    // ─────────────────────────────────────────────────────────────────────────
+    //  Implied volatility (scalar)
+    // ─────────────────────────────────────────────────────────────────────────
+
+    /**
+     * @brief Black-76 implied volatility from a discounted option price.
+     *
+     * Follows the structure of Jäckel's "Let's Be Rational" (2015):
+     * reduce to an out-of-the-money call in normalised coordinates, pick one
+     * of three objective transforms (1/ln b, b, ln(b_max − b)) from where the
+     * price sits relative to the curve's inflection point, start from a
+     * branch-specific asymptotic guess and run safeguarded third-order
+     * Householder steps until the update is below machine precision
+     * (typically two or three steps).
+     *
+     * @param price    discounted option price
+     * @param forward  forward F
+     * @param strike   strike K
+     * @param T        expiry (> 0)
+     * @param discount discount factor to expiry
+     * @return σ ≥ 0 (0 when price equals intrinsic value)
+     * @throws InvalidInput for non-positive F, K, T, discount, or a price
+     *         outside the no-arbitrage bounds [intrinsic, max]
+     */
+    Real implied_vol_black(Real price, Real forward, Real strike, Time T,
+                           Real discount, bool is_call);
+
+    /**
+     * @brief Black-Scholes implied volatility (flat r, q), via
+     *        F = S e^{(r − q)T}, df = e^{−rT}.
+     */
+    Real implied_vol_bs(Real price, Real spot, Real strike, Time T,
+                        Real r, Real q, bool is_call);
+
+    // ─────────────────────────────────────────────────────────────────────────
+    //  Implied volatility (batch)
+    // ─────────────────────────────────────────────────────────────────────────
+
+    /**
+     * @brief Structure-of-arrays view over a chain of Black-Scholes quotes.
+     *
+     * Same layout as BSBatchInputView with `price` in place of `vol`.
+     */
+    struct ImpliedVolBatchInputView
+    {
+        std::size_t n = 0;
+        const Real *price = nullptr;
+        const Real *spot = nullptr;
+        const Real *strike = nullptr;
+        const Real *maturity = nullptr;
+        const Real *rate = nullptr;
+        const Real *dividend = nullptr;
+        const std::uint8_t *is_call = nullptr;
+    };
+
+    /**
+     * @brief Invert a whole chain.  vol[i] is NaN for quotes that violate
+     *        the no-arbitrage bounds, so one bad quote does not abort the
+     *        chain.
+     *
+     * @throws InvalidInput if a required pointer is null
+     */
+    void implied_vol_bs_batch(const ImpliedVolBatchInputView &in, Real *vol);
+
+} // namespace quantModeling
+
+#endif
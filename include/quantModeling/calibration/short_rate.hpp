@@ -0,0 +1,132 @@
+#ifndef CALIBRATION_SHORT_RATE_HPP
+#define CALIBRATION_SHORT_RATE_HPP
+
+#include "quantModeling/core/types.hpp"
+
+#include <string>
+#include <vector>
+
+namespace quantModeling
+{
+
+    // ─────────────────────────────────────────────────────────────────────────
+    //  Market quotes
+    // ─────────────────────────────────────────────────────────────────────────
+
+    enum class ShortRateQuoteType
+    {
+        ZeroCouponBond, ///< P(0, end)
+        BondOption,     ///< European option on P(start, end)
+        Caplet,         ///< caplet / floorlet on [start, end]
+        CapFloor        ///< cap / floor on `schedule`
+    };
+
+    /**
+     * @brief One market quote used as a calibration target.
+     *
+     * Field usage per quote type:
+     *   - ZeroCouponBond : end = bond maturity
+     *   - BondOption     : start = option expiry T, end = bond maturity S,
+     *                      strike = bond-price strike, is_call
+     *   - Caplet         : start / end = accrual period, strike = cap rate,
+     *                      is_call = true for a caplet, false for a floorlet
+     *   - CapFloor       : schedule = [T_0, ..., T_n], strike = cap rate,
+     *                      is_call = true for a cap, false for a floor
+     *
+     * Prices are quoted per `notional`, exactly as the analytic engine
+     * would return them.
+     */
+    struct ShortRateQuote
+    {
+        ShortRateQuoteType type = ShortRateQuoteType::Caplet;
+        Time start = 0.0;
+        Time end = 0.0;
+        std::vector<Time> schedule;
+        Real strike = 0.0;
+        bool is_call = true;
+        Real notional = 1.0;
+
+        Real market_price = 0.0;
+        Real weight = 1.0; ///< residual weight (e.g. 1 / vega or 1 / bid-ask)
+    };
+
+    // ─────────────────────────────────────────────────────────────────────────
+    //  Calibration input / output
+    // ─────────────────────────────────────────────────────────────────────────
+
+    /**
+     * @brief Input for fitting a one-factor short-rate model to market quotes.
+     *
+     * Parameters follow the ShortRate*Input convention: (a, b, σ) with r0
+     * held fixed.  For "hull_white" the long-term level is b = θ / a, so the
+     * fitted (a, b, σ) plug straight into ShortRate*Input structs.
+     *
+     * Gaussian models (Vasicek, Hull-White) use closed-form parameter
+     * gradients of the bond-option / caplet formulas.  CIR has no analytic
+     * option formula in this library; it can only be fitted to ZCB quotes and
+     * uses central finite differences of the closed-form ZCB price.
+     */
+    struct ShortRateCalibrationInput
+    {
+        std::string model_type; ///< "vasicek", "cir", or "hull_white"
+        Real a = 0.1;           ///< initial guess
+        Real b = 0.05;          ///< initial guess
+        Real sigma = 0.01;      ///< initial guess
+        Real r0 = 0.03;         ///< fixed
+
+        std::vector<ShortRateQuote> quotes;
+
+        bool calibrate_long_term = true; ///< false → b held at its initial value
+        int max_iterations = 200;
+        Real tolerance = 1e-12; ///< relative step / objective tolerance
+        Real initial_lambda = 1e-3;
+        int n_threads = 0; ///< quote-evaluation threads; 0 = hardware concurrency
+    };
+
+    /**
+     * @brief Per-iteration Levenberg-Marquardt trace.
+     */
+    struct ShortRateCalibrationIteration
+    {
+        int iteration;
+        Real objective; ///< ½ Σ w_i² (model_i − market_i)²
+        Real lambda;    ///< damping after this iteration
+        bool accepted;  ///< whether the trial step was accepted
+        double elapsed_ms;
+    };
+
+    struct ShortRateCalibrationResult
+    {
+        Real a = 0.0;
+        Real b = 0.0;
+        Real sigma = 0.0;
+        Real r0 = 0.0;
+
+        std::vector<Real> model_prices; ///< one per quote, at the fitted parameters
+        std::vector<Real> residuals;    ///< model − market, unweighted
+        Real objective = 0.0;
+        Real rmse = 0.0;
+
+        int iterations = 0;
+        bool converged = false;
+        std::vector<ShortRateCalibrationIteration> history;
+        double total_ms = 0.0;
+        std::string diagnostics;
+    };
+
+    /**
+     * @brief Levenberg-Marquardt fit of (a, [b], σ) to short-rate quotes.
+     *
+     * Each iteration evaluates every quote price and its parameter gradient
+     * once; quotes are split across `n_threads` worker threads.  Trial steps
+     * that leave the admissible parameter region (a, σ > 0, Feller for CIR)
+     * are rejected and the damping increased.
+     *
+     * @throws InvalidInput          on an empty quote set or unknown model type
+     * @throws UnsupportedInstrument for option quotes under CIR
+     */
+    ShortRateCalibrationResult calibrate_short_rate(const ShortRateCalibrationInput &in);
+
+} // namespace quantModeling
+
+#endif
@@ -4,6 +4,7 @@
 #include "quantModeling/core/types.hpp"
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace quantModeling
 {
@@ -21,6 +22,10 @@ namespace quantModeling
     std::optional<Real> vega_std_error;
     std::optional<Real> theta_std_error;
     std::optional<Real> rho_std_error;
+    // Per-asset sensitivities (multi-asset engines only; empty otherwise)
+    std::vector<Real> delta_per_asset; ///< dV/dS0_i
+    std::vector<Real> gamma_per_asset; ///< d2V/dS0_i^2
+    std::vector<Real> vega_per_asset;  ///< dV/dsigma_i
   };
 
   struct BondAnalytics
@@ -39,6 +44,17 @@ namespace quantModeling
     std::string diagnostics;
     Real mc_std_error;
   };
+
+  /// Per-option results of a batched analytic pricer (unit notional).
+  struct VanillaBSBatchResult
+  {
+    std::vector<Real> npv;
+    std::vector<Real> delta;
+    std::vector<Real> gamma;
+    std::vector<Real> vega;
+    std::vector<Real> theta;
+    std::vector<Real> rho;
+  };
 } // namespace quantModeling
 
 #endif
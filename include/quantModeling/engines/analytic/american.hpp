@@ -0,0 +1,110 @@
+#ifndef ENGINE_ANALYTIC_AMERICAN_HPP
+#define ENGINE_ANALYTIC_AMERICAN_HPP
+
+#include "quantModeling/engines/base.hpp"
+#include "quantModeling/instruments/equity/asian.hpp"
+#include "quantModeling/instruments/equity/barrier.hpp"
+#include "quantModeling/instruments/equity/digital.hpp"
+#include "quantModeling/instruments/equity/future.hpp"
+#include "quantModeling/instruments/equity/vanilla.hpp"
+#include "quantModeling/instruments/rates/fixed_rate_bond.hpp"
+#include "quantModeling/instruments/rates/zero_coupon_bond.hpp"
+#include "quantModeling/models/equity/local_vol_model.hpp"
+
+#include <utility>
+
+namespace quantModeling
+{
+
+    /// Approximation used by BSAmericanAnalyticEngine.
+    enum class AmericanAnalyticScheme
+    {
+        BaroneAdesiWhaley, ///< quadratic approximation, one Newton solve (~1e-2 of strike)
+        ALOFast,           ///< ALO, n = 8 nodes (~1e-6, ~1e-4 worst case)
+        ALOAccurate,       ///< ALO default, n = 20 (~1e-8, ~1e-6 for long-dated low-vol puts)
+        ALOHighPrecision   ///< ALO, n = 48, used as the reference in tests
+    };
+
+    /**
+     * @brief Closed-form-speed American vanilla options under flat
+     *        Black-Scholes.
+     *
+     * Andersen, Lake & Offengelt (2016): the exercise boundary B(τ) of the
+     * put solves the fixed-point system
+     *   B(τ) = K e^{−(r−q)τ} N(τ, B) / D(τ, B)
+     * obtained from value matching ("FP-B").  The boundary is represented
+     * through H(√τ) = ln(B(τ)/X)², with X = K min(1, r/q) its limit at
+     * expiry, which is smooth enough in √τ for Chebyshev interpolation on a
+     * handful of nodes.  The collocated system is solved by Newton's method
+     * from the Barone-Adesi–Whaley boundary, which converges in about four
+     * steps in every regime (ALO's FP-A Jacobi sweeps need many more, and
+     * become unstable once (r − q)√T / σ² > 5).  The integrals in N, D and
+     * in the early-exercise premium
+     *   V = v_E + ∫₀ᵀ [r K e^{−r(T−u)} Φ(−d₋) − q S e^{−q(T−u)} Φ(−d₊)] du
+     * are Gauss-Legendre rules in the angle θ of u = τ cos²θ, which absorbs
+     * the 1/√(τ−u) and √u-type endpoint behaviour.  The rules and the
+     * Chebyshev maps depend on the scheme only and are built once.
+     * Barone-Adesi–Whaley is also available on its own as the cheap scheme.
+     *
+     * Calls are priced as puts through McDonald–Schroder symmetry,
+     *   C(S, K, r, q) = P(K, S, q, r).
+     * When early exercise is never optimal (put with r ≤ 0, call with
+     * q ≤ 0) the price is the European one; the double-boundary regime
+     * q < r < 0 is rejected.
+     *
+     * Greeks: the boundary does not depend on spot, so delta and gamma are
+     * exact derivatives of the representation.  Theta follows from the
+     * Black-Scholes PDE in the continuation region (zero where exercise is
+     * optimal).  Vega and rho differentiate through the boundary: its
+     * tangents to σ and the rate come from the fixed point linearised at
+     * convergence, with the Newton Jacobian already factorised, so a priced
+     * option costs one boundary solve.  That is about 130 µs with
+     * ALOAccurate in a portable build and about 80 µs with QM_NATIVE_ARCH
+     * (40 and 30 µs with ALOFast).  Barone-Adesi–Whaley does not solve the
+     * PDE and has no tangents, so its theta, vega and rho are differences.
+     */
+    class BSAmericanAnalyticEngine final : public EngineBase
+    {
+    public:
+        explicit BSAmericanAnalyticEngine(PricingContext ctx,
+                                          AmericanAnalyticScheme scheme = AmericanAnalyticScheme::ALOAccurate)
+            : EngineBase(std::move(ctx)), scheme_(scheme)
+        {
+        }
+
+        void visit(const VanillaOption &opt) override;
+
+        void visit(const AsianOption &) override
+        {
+            throw UnsupportedInstrument("BSAmericanAnalyticEngine does not support Asian options.");
+        }
+        void visit(const BarrierOption &) override
+        {
+            throw UnsupportedInstrument("BSAmericanAnalyticEngine does not support barrier options.");
+        }
+        void visit(const DigitalOption &) override
+        {
+            throw UnsupportedInstrument("BSAmericanAnalyticEngine does not support digital options.");
+        }
+        void visit(const EquityFuture &) override
+        {
+            throw UnsupportedInstrument("BSAmericanAnalyticEngine does not support equity futures.");
+        }
+        void visit(const ZeroCouponBond &) override
+        {
+            throw UnsupportedInstrument("BSAmericanAnalyticEngine does not support bonds.");
+        }
+        void visit(const FixedRateBond &) override
+        {
+            throw UnsupportedInstrument("BSAmericanAnalyticEngine does not support bonds.");
+        }
+
+    private:
+        AmericanAnalyticScheme scheme_;
+
+        static void validate(const VanillaOption &opt);
+    };
+
+} // namespace quantModeling
+
+#endif // ENGINE_ANALYTIC_AMERICAN_HPP
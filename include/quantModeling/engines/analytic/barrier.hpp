@@ -0,0 +1,88 @@
+#ifndef ENGINE_ANALYTIC_BARRIER_HPP
+#define ENGINE_ANALYTIC_BARRIER_HPP
+
+#include "quantModeling/engines/base.hpp"
+#include "quantModeling/instruments/equity/asian.hpp"
+#include "quantModeling/instruments/equity/barrier.hpp"
+#include "quantModeling/instruments/equity/digital.hpp"
+#include "quantModeling/instruments/equity/future.hpp"
+#include "quantModeling/instruments/equity/vanilla.hpp"
+#include "quantModeling/instruments/rates/fixed_rate_bond.hpp"
+#include "quantModeling/instruments/rates/zero_coupon_bond.hpp"
+#include "quantModeling/models/equity/local_vol_model.hpp"
+
+namespace quantModeling
+{
+
+    /**
+     * @brief Reiner-Rubinstein price and Greeks of a single-barrier European
+     *        under flat r, q, σ — the kernel of BSBarrierAnalyticEngine,
+     *        callable without an instrument, model or engine.
+     *
+     * n_steps and brownian_bridge select the monitoring as on BarrierOption.
+     * Throws InvalidInput for a non-positive spot, vol or maturity; the
+     * contract's own fields are not checked (the engine does that first).
+     */
+    PricingResult bs_barrier_analytic(BarrierType barrier_type, bool is_call, Real S0, Real K,
+                                      Real H, Real T, Real r, Real q, Real sigma, Real rebate,
+                                      int n_steps, bool brownian_bridge, Real notional = 1.0);
+
+    /**
+     * Closed-form pricing engine for single-barrier European options under
+     * flat-volatility Black-Scholes (Reiner & Rubinstein 1991).
+     *
+     * Supports all eight combinations of
+     *   UpAndIn / UpAndOut / DownAndIn / DownAndOut  ×  call / put
+     * with a rebate paid at expiry in the "dead" state, matching the
+     * BarrierOption convention used by BSEuroBarrierMCEngine.
+     *
+     * Monitoring:
+     *   - brownian_bridge == true  → continuous monitoring (the MC engine's
+     *     bridge correction approximates the same limit)
+     *   - brownian_bridge == false → discrete monitoring on n_steps dates
+     *     (0 → weekly, as in the MC engine) via the Broadie–Glasserman–Kou
+     *     shift  H → H · exp(±0.5826 σ √Δt), away from spot
+     *
+     * Greeks (delta, gamma, vega, rho, theta) are exact derivatives of the
+     * closed form, including the σ- and T-dependence of the BGK shift.
+     * A spot already through the barrier is treated as knocked.
+     */
+    class BSBarrierAnalyticEngine final : public EngineBase
+    {
+    public:
+        using EngineBase::EngineBase;
+
+        void visit(const BarrierOption &opt) override;
+
+        void visit(const VanillaOption &) override
+        {
+            throw UnsupportedInstrument("BSBarrierAnalyticEngine: use BSEuroVanillaAnalyticEngine for vanilla.");
+        }
+        void visit(const AsianOption &) override
+        {
+            throw UnsupportedInstrument("BSBarrierAnalyticEngine does not support Asian options.");
+        }
+        void visit(const DigitalOption &) override
+        {
+            throw UnsupportedInstrument("BSBarrierAnalyticEngine: use BSDigitalAnalyticEngine for digital options.");
+        }
+        void visit(const EquityFuture &) override
+        {
+            throw UnsupportedInstrument("BSBarrierAnalyticEngine does not support equity futures.");
+        }
+        void visit(const ZeroCouponBond &) override
+        {
+            throw UnsupportedInstrument("BSBarrierAnalyticEngine does not support bonds.");
+        }
+        void visit(const FixedRateBond &) override
+        {
+            throw UnsupportedInstrument("BSBarrierAnalyticEngine does not support bonds.");
+        }
+
+    private:
+        static void validate(const BarrierOption &opt);
+    };
+
+} // namespace quantModeling
+
+#endif // ENGINE_ANALYTIC_BARRIER_HPP
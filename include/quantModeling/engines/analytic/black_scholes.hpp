@@ -14,6 +14,16 @@
 
 namespace quantModeling
 {
+    /**
+     * @brief Black-Scholes price and Greeks of a European vanilla under
+     *        flat r, q, σ — the kernel of BSEuroVanillaAnalyticEngine,
+     *        callable without an instrument, model or engine.
+     *
+     * Inputs are not validated; the engine checks them first.
+     */
+    PricingResult bs_vanilla_analytic(OptionType type, Real S0, Real K, Real T,
+                                      Real r, Real q, Real v, Real notional = 1.0);
+
     class BSEuroVanillaAnalyticEngine final : public EngineBase
     {
     public:
@@ -0,0 +1,62 @@
+#ifndef ENGINE_ANALYTIC_BS_BATCH_HPP
+#define ENGINE_ANALYTIC_BS_BATCH_HPP
+
+#include "quantModeling/core/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace quantModeling
+{
+
+    /**
+     * @brief Structure-of-arrays view over a batch of European vanillas.
+     *
+     * All arrays hold `n` entries and are read-only.  `is_call` is non-zero
+     * for a call, zero for a put.  Flat r, q, σ per option, as in
+     * BSEuroVanillaAnalyticEngine.
+     */
+    struct BSBatchInputView
+    {
+        std::size_t n = 0;
+        const Real *spot = nullptr;
+        const Real *strike = nullptr;
+        const Real *maturity = nullptr;
+        const Real *rate = nullptr;
+        const Real *dividend = nullptr;
+        const Real *vol = nullptr;
+        const std::uint8_t *is_call = nullptr;
+    };
+
+    /**
+     * @brief Output arrays for price_bs_batch (unit notional).
+     *
+     * `npv` is required; any Greek pointer may be null to skip it.
+     */
+    struct BSBatchOutputView
+    {
+        Real *npv = nullptr;
+        Real *delta = nullptr;
+        Real *gamma = nullptr;
+        Real *vega = nullptr;
+        Real *theta = nullptr;
+        Real *rho = nullptr;
+    };
+
+    /**
+     * @brief Price a batch of European vanillas and their Greeks.
+     *
+     * Same formulas as BSEuroVanillaAnalyticEngine, but with no per-option
+     * instrument / model / engine construction.  Options are processed in
+     * fixed-size blocks; within a block every stage (discount factors,
+     * log-moneyness, d1/d2, normal CDF/PDF, payoff assembly) is one loop
+     * over contiguous arrays using the vec:: exp / log kernels.
+     *
+     * @throws InvalidInput if any option has S, K, T or σ ≤ 0, or if a
+     *         required pointer is null
+     */
+    void price_bs_batch(const BSBatchInputView &in, const BSBatchOutputView &out);
+
+} // namespace quantModeling
+
+#endif
@@ -8,6 +8,16 @@
 namespace quantModeling
 {
 
+    /**
+     * @brief Black '76 price and Greeks of an option on the forward F under
+     *        a flat rate r — the kernel of CommodityAnalyticEngine's option
+     *        pricing, callable without an instrument, model or engine.
+     *
+     * Inputs are not validated; the engine checks them first.
+     */
+    PricingResult black76_option_analytic(bool is_call, Real F, Real K, Real T,
+                                          Real r, Real sigma, Real notional = 1.0);
+
     /**
      * @brief Analytic pricing engine for commodity forwards and options.
      *
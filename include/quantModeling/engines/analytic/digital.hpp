@@ -14,6 +14,17 @@
 
 namespace quantModeling
 {
+    /**
+     * @brief Black-Scholes price of a European digital under flat r, q, σ —
+     *        the kernel of BSDigitalAnalyticEngine, callable without an
+     *        instrument, model or engine.
+     *
+     * Inputs are not validated; the engine checks them first.
+     */
+    PricingResult bs_digital_analytic(DigitalPayoffType payoff_type, bool is_call, Real S, Real K,
+                                      Real T, Real r, Real q, Real v, Real cash_amount,
+                                      Real notional = 1.0);
+
     /**
      * Analytic pricing engine for European digital (binary) options.
      *
@@ -8,6 +8,16 @@
 namespace quantModeling
 {
 
+    /**
+     * @brief Garman-Kohlhagen price and Greeks of an FX option under flat
+     *        r_d, r_f, σ — the kernel of FXAnalyticEngine's option pricing,
+     *        callable without an instrument, model or engine.
+     *
+     * Inputs are not validated; the engine checks them first.
+     */
+    PricingResult gk_fx_option_analytic(bool is_call, Real S0, Real K, Real T,
+                                        Real r_d, Real r_f, Real sigma, Real notional = 1.0);
+
     /**
      * @brief Analytic pricing engine for FX forwards and options.
      *
@@ -0,0 +1,83 @@
+#ifndef ENGINE_ANALYTIC_LOOKBACK_HPP
+#define ENGINE_ANALYTIC_LOOKBACK_HPP
+
+#include "quantModeling/engines/base.hpp"
+#include "quantModeling/instruments/equity/asian.hpp"
+#include "quantModeling/instruments/equity/barrier.hpp"
+#include "quantModeling/instruments/equity/digital.hpp"
+#include "quantModeling/instruments/equity/future.hpp"
+#include "quantModeling/instruments/equity/lookback.hpp"
+#include "quantModeling/instruments/equity/vanilla.hpp"
+#include "quantModeling/instruments/rates/fixed_rate_bond.hpp"
+#include "quantModeling/instruments/rates/zero_coupon_bond.hpp"
+#include "quantModeling/models/equity/local_vol_model.hpp"
+
+namespace quantModeling
+{
+
+    /**
+     * Closed-form pricing engine for European lookback options under
+     * flat-volatility Black-Scholes.
+     *
+     *   Floating strike (Goldman, Sosin & Gatto 1979):
+     *     call  S_T − min S,   put  max S − S_T
+     *   Fixed strike (Conze & Viswanathan 1991):
+     *     call on max (M − K)⁺, put on min (K − m)⁺, and the less common
+     *     call on min / put on max through  (m − K)⁺ = m − K + (K − m)⁺.
+     *
+     * The running extremum starts at spot, as in BSEuroLookbackMCEngine.
+     *
+     * Monitoring:
+     *   - continuous_monitoring == true → continuous formulas
+     *   - otherwise discrete on n_steps dates (0 → 252 × T, as in the MC
+     *     engine) via the Broadie–Glasserman–Kou correction: the discrete
+     *     maximum behaves like e^{−βσ√Δt} · max(S e^{βσ√Δt}, continuous max),
+     *     so the continuous formula is evaluated for a seasoned option with
+     *     running extremum S e^{±βσ√Δt} and rescaled.
+     *
+     * Greeks (delta, gamma, vega, rho, theta) are exact derivatives of the
+     * closed form, evaluated on ad::Jet.
+     */
+    class BSLookbackAnalyticEngine final : public EngineBase
+    {
+    public:
+        using EngineBase::EngineBase;
+
+        void visit(const LookbackOption &opt) override;
+
+        void visit(const VanillaOption &) override
+        {
+            throw UnsupportedInstrument("BSLookbackAnalyticEngine: use BSEuroVanillaAnalyticEngine for vanilla.");
+        }
+        void visit(const AsianOption &) override
+        {
+            throw UnsupportedInstrument("BSLookbackAnalyticEngine does not support Asian options.");
+        }
+        void visit(const BarrierOption &) override
+        {
+            throw UnsupportedInstrument("BSLookbackAnalyticEngine: use BSBarrierAnalyticEngine for barrier.");
+        }
+        void visit(const DigitalOption &) override
+        {
+            throw UnsupportedInstrument("BSLookbackAnalyticEngine: use BSDigitalAnalyticEngine for digital options.");
+        }
+        void visit(const EquityFuture &) override
+        {
+            throw UnsupportedInstrument("BSLookbackAnalyticEngine does not support equity futures.");
+        }
+        void visit(const ZeroCouponBond &) override
+        {
+            throw UnsupportedInstrument("BSLookbackAnalyticEngine does not support bonds.");
+        }
+        void visit(const FixedRateBond &) override
+        {
+            throw UnsupportedInstrument("BSLookbackAnalyticEngine does not support bonds.");
+        }
+
+    private:
+        static void validate(const LookbackOption &opt);
+    };
+
+} // namespace quantModeling
+
+#endif // ENGINE_ANALYTIC_LOOKBACK_HPP
@@ -0,0 +1,50 @@
+#ifndef ENGINE_ANALYTIC_RAINBOW_HPP
+#define ENGINE_ANALYTIC_RAINBOW_HPP
+
+#include "quantModeling/engines/base.hpp"
+#include "quantModeling/instruments/equity/rainbow.hpp"
+
+namespace quantModeling
+{
+
+    /**
+     * @brief Closed-form engine for two- and three-asset worst-of / best-of
+     *        options under multi-asset BS (Stulz 1982, Johnson 1987).
+     *
+     * With performances X_i = S_i(T)/S_i(0) and F_i = e^{(r − q_i)T}, a call
+     * on the extreme performance decomposes by which asset is extreme:
+     *
+     *   C = e^{−rT} [ Σ_i F_i Q_i(X_i extreme, X_i > K) − K Q(extreme > K) ]
+     *
+     * where Q_i is the measure with asset i as numéraire.  Each probability
+     * is an n-variate normal CDF in ln(X_i/K) and ln(X_i/X_j), so two assets
+     * need the bivariate CDF (Genz) and three the trivariate.  Puts follow
+     * from put-call parity with E[extreme] = C(K → 0).
+     *
+     * Greeks are exact: vega (all vols, and per asset), rho and theta.  The
+     * payoff is on performance, so the value does not depend on spot levels
+     * and delta / gamma are zero.
+     *
+     * Requires a MultiAssetBSModel with 2 or 3 assets; use RainbowMCEngine
+     * for larger baskets.
+     */
+    class RainbowAnalyticEngine final : public EngineBase
+    {
+    public:
+        using EngineBase::EngineBase;
+
+        void visit(const WorstOfOption &opt) override;
+        void visit(const BestOfOption &opt) override;
+
+        void visit(const VanillaOption &) override;
+        void visit(const AsianOption &) override;
+        void visit(const BarrierOption &) override;
+        void visit(const DigitalOption &) override;
+        void visit(const EquityFuture &) override;
+        void visit(const ZeroCouponBond &) override;
+        void visit(const FixedRateBond &) override;
+    };
+
+} // namespace quantModeling
+
+#endif
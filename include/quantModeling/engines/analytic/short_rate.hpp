@@ -14,17 +14,52 @@
 #include "quantModeling/instruments/rates/zero_coupon_bond.hpp"
 #include "quantModeling/models/rates/short_rate_model.hpp"
 
+#include <vector>
+
 namespace quantModeling
 {
 
+    // ── Free helpers (also used by calibration and batch pricing) ────────────
+
+    /**
+     * @brief European option on a coupon bond via Jamshidian (1989).
+     *
+     * For a one-factor model with P(T, t_i | r) decreasing in r, the option
+     * on Σ c_i P(T, t_i) with strike K equals Σ c_i × ZCB-option(K_i), where
+     * K_i = P(T, t_i | r*) and r* solves Σ c_i P(T, t_i | r*) = K.
+     *
+     * @param times   cash-flow times t_i > T_option
+     * @param amounts cash-flow amounts c_i > 0 (per unit face)
+     * @throws UnsupportedInstrument if the model has no ZCB-option formula
+     */
+    Real jamshidian_coupon_bond_option(const IShortRateModel &m, bool is_call, Real K,
+                                       Time T_option,
+                                       const std::vector<Time> &times,
+                                       const std::vector<Real> &amounts);
+
+    /**
+     * @brief Per-period prices of a caplet (or floorlet) strip on `schedule`.
+     *
+     * For Gaussian models (bond_option_vol available) all discount factors,
+     * d1/d2 terms and normal CDFs are evaluated in contiguous arrays, one
+     * pass each.  Other models fall back to one bond_option_price() call per
+     * period.  Periods with T_i ≤ 0 are expired and priced at 0.
+     *
+     * @return one price per period (unit notional), size schedule.size() − 1
+     */
+    std::vector<Real> price_caplet_strip(const IShortRateModel &m,
+                                         const std::vector<Time> &schedule,
+                                         Real strike, bool is_cap);
+
     /**
      * @brief Analytic engine for instruments priced under short-rate models.
      *
      * Supports:
      *   - ZeroCouponBond   : P(0, T) from model
      *   - FixedRateBond    : sum of ZCB prices for coupons + principal
-     *   - BondOption       : calls model.bond_option_price() (Vasicek/HW)
-     *   - CapFloor         : decomposes into bond options
+     *   - BondOption       : calls model.bond_option_price() (Vasicek/HW);
+     *                        coupon-bond underlyings via Jamshidian
+     *   - CapFloor         : batched caplet strip (price_caplet_strip)
      *
      * Throws for equity instruments.
      */
@@ -13,9 +13,34 @@
 #include "quantModeling/instruments/rates/zero_coupon_bond.hpp"
 #include "quantModeling/utils/greeks.hpp"
 
+#include <Eigen/Core>
+#include <vector>
+
 namespace quantModeling
 {
 
+    /**
+     * @brief The correlated normals z = L u BSBasketMCEngine draws, one
+     *        column per path.
+     *
+     * They depend on the correlation and the simulation settings only, so
+     * a prepared pricer draws them once and reprices every market move on
+     * the same set (see bs_basket_mc()).
+     */
+    Eigen::MatrixXd bs_basket_mc_draws(const Eigen::MatrixXd &chol, int n_paths, int seed,
+                                       bool antithetic);
+
+    /**
+     * @brief BSBasketMCEngine's estimator on given draws: npv, greeks and
+     *        their standard errors.
+     *
+     * With the draws of bs_basket_mc_draws() for the engine's settings the
+     * result is the engine's.  The option is not validated here.
+     */
+    PricingResult bs_basket_mc(const BasketOption &opt, Real r, const std::vector<Real> &spots,
+                               const std::vector<Real> &vols, const std::vector<Real> &dividends,
+                               const Eigen::MatrixXd &z, bool antithetic);
+
     /**
      * @brief Monte Carlo engine for European basket options under multi-asset Black-Scholes.
      *
@@ -68,7 +93,8 @@ namespace quantModeling
             throw UnsupportedInstrument("BSBasketMCEngine does not support bonds.");
         }
 
-    private:
+        /// The checks visit() runs before simulating; callers of
+        /// bs_basket_mc() run them once themselves.
         static void validate(const BasketOption &opt, int n_assets, int n_paths);
     };
 
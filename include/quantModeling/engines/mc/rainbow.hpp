@@ -4,9 +4,36 @@
 #include "quantModeling/engines/base.hpp"
 #include "quantModeling/instruments/equity/rainbow.hpp"
 
+#include <Eigen/Core>
+#include <vector>
+
 namespace quantModeling
 {
 
+    /**
+     * @brief The correlated normals z = L u RainbowMCEngine draws, one
+     *        column per path.
+     *
+     * Settings are read as the engine reads them (non-positive paths or
+     * seed select the defaults).  They depend on the correlation only, so
+     * a prepared pricer draws them once and reprices every market move on
+     * the same set (see rainbow_mc()).
+     */
+    Eigen::MatrixXd rainbow_mc_draws(const Eigen::MatrixXd &chol, int mc_paths, int mc_seed);
+
+    /**
+     * @brief RainbowMCEngine's estimator on given draws.
+     *
+     * With the draws of rainbow_mc_draws() for the engine's settings the
+     * result is the engine's.  The option is not validated here.
+     */
+    PricingResult rainbow_mc(const WorstOfOption &opt, Real r, const std::vector<Real> &spots,
+                             const std::vector<Real> &vols, const std::vector<Real> &dividends,
+                             const Eigen::MatrixXd &z);
+    PricingResult rainbow_mc(const BestOfOption &opt, Real r, const std::vector<Real> &spots,
+                             const std::vector<Real> &vols, const std::vector<Real> &dividends,
+                             const Eigen::MatrixXd &z);
+
     /**
      * @brief MC engine for worst-of and best-of options under multi-asset BS.
      *
@@ -31,6 +58,10 @@ namespace quantModeling
         void visit(const EquityFuture &) override;
         void visit(const ZeroCouponBond &) override;
         void visit(const FixedRateBond &) override;
+
+        /// The checks visit() runs before simulating; callers of
+        /// rainbow_mc() run them once themselves.
+        static void validate(Time maturity, Real notional, int n_assets);
     };
 
 } // namespace quantModeling
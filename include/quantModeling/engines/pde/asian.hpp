@@ -0,0 +1,75 @@
+#ifndef ENGINE_PDE_ASIAN_HPP
+#define ENGINE_PDE_ASIAN_HPP
+
+#include "quantModeling/engines/base.hpp"
+#include "quantModeling/instruments/equity/asian.hpp"
+
+namespace quantModeling
+{
+    /**
+     * @brief Vecer's one-dimensional PDE for European arithmetic Asian
+     *        options (continuous averaging over [0, T], fixed strike)
+     *        under Black-Scholes.
+     *
+     * The payoff A_T − K is replicated by a self-financing portfolio X
+     * holding Δ(t) = (e^{−q(T−t)} − e^{−r(T−t)}) / ((r − q) T) shares.
+     * With e^{qt} S as numeraire, y = X / (e^{qt} S) is a martingale and the
+     * option is worth S₀ u(0, y₀), where
+     *
+     *   u_t + ½σ² (y − Γ(t))² u_yy = 0,   u(T, y) = max(±y, 0),
+     *
+     * Γ(t) = e^{−qt} Δ(t) and y₀ = Γ(0) − e^{−rT} K / S₀.  The equation has no
+     * drift or discounting and both ends are linear (Dirichlet), so the
+     * only error is the grid's: Crank-Nicolson on a sinh-stretched grid
+     * around the kink at y = 0 and y₀ (a node), with the payoff
+     * cell-averaged and Rannacher start-up, as in PDEEuropeanVanillaEngine.
+     * At the default 200 × 200 grid prices are within 2.1e-5 of Linetsky's
+     * continuous-averaging benchmarks.
+     *
+     * Greeks: delta and gamma from u_y and u_yy at y₀ (∂y₀/∂S₀ =
+     * e^{−rT} K / S₀²); vega and rho from sensitivity PDEs in the same sweep,
+     * rho including the r-dependence of Γ and y₀.  Theta follows the
+     * convention of the other Asian engines, −∂V/∂T for an average that
+     * starts today, from a central difference of one day on the same grid.
+     *
+     * Only arithmetic averaging and a flat volatility are supported.
+     */
+    class PDEAsianEngine final : public EngineBase
+    {
+    public:
+        explicit PDEAsianEngine(PricingContext ctx);
+
+        void visit(const AsianOption &opt) override;
+
+        void visit(const VanillaOption &) override
+        {
+            throw UnsupportedInstrument("PDEAsianEngine: use PDEEuropeanVanillaEngine for vanilla options.");
+        }
+        void visit(const BarrierOption &) override
+        {
+            throw UnsupportedInstrument("PDEAsianEngine: use PDEBarrierEngine for barrier options.");
+        }
+        void visit(const DigitalOption &) override
+        {
+            throw UnsupportedInstrument("PDEAsianEngine does not support digital options.");
+        }
+        void visit(const EquityFuture &) override
+        {
+            throw UnsupportedInstrument("PDEAsianEngine does not support equity futures.");
+        }
+        void visit(const ZeroCouponBond &) override
+        {
+            throw UnsupportedInstrument("PDEAsianEngine does not support bonds.");
+        }
+        void visit(const FixedRateBond &) override
+        {
+            throw UnsupportedInstrument("PDEAsianEngine does not support bonds.");
+        }
+
+    private:
+        int M_; // space steps
+        int N_; // time steps
+    };
+} // namespace quantModeling
+
+#endif // ENGINE_PDE_ASIAN_HPP
@@ -0,0 +1,58 @@
+#ifndef ENGINE_PDE_DUPIRE_FORWARD_HPP
+#define ENGINE_PDE_DUPIRE_FORWARD_HPP
+
+#include "quantModeling/core/types.hpp"
+#include "quantModeling/pricers/inputs.hpp"
+
+#include <string>
+#include <vector>
+
+namespace quantModeling
+{
+
+    /**
+     * @brief Call prices (and their Black-Scholes implied vols) on a
+     *        strike × maturity grid.
+     *
+     * K-major like the local-vol input:
+     *   call_prices[i * maturities.size() + j] = C(strikes[i], maturities[j]).
+     * implied_vols is NaN where a price cannot be inverted (a node so far
+     * out of the money that the price underflows the inversion).
+     */
+    struct LocalVolCallSurface
+    {
+        std::vector<Real> strikes;
+        std::vector<Time> maturities;
+        std::vector<Real> call_prices;
+        std::vector<Real> implied_vols;
+        std::string diagnostics;
+    };
+
+    /**
+     * @brief Whole call surface under a Dupire local vol from one forward
+     *        PDE solve.
+     *
+     * C(K, T) solves the forward (Dupire) equation in strike and maturity,
+     *   ∂C/∂T = ½ σ²(K, T) K² ∂²C/∂K² − (r − q) K ∂C/∂K − q C,
+     *   C(K, 0) = (S₀ − K)⁺,
+     * which is the adjoint of the backward pricing PDE.  One sweep from
+     * T = 0 to the last maturity therefore prices every strike at every
+     * maturity on the way, where a backward solve (or a simulation) prices
+     * one contract.
+     *
+     * Same discretisation as PDEEuropeanVanillaEngine: x = ln(K/S₀) on a
+     * sinh grid concentrated at the money and pinned there, spanning four
+     * standard deviations beyond the requested strikes; cell-averaged
+     * initial payoff; Crank-Nicolson with Rannacher start-up; σ sampled at
+     * the nodes at each step's mid-time.  The requested maturities are time
+     * nodes; requested strikes are read off by cubic interpolation in x.
+     * Put prices follow from parity.
+     *
+     * @throws InvalidInput on an empty or unsorted strike / maturity set,
+     *         a malformed surface, or non-positive spot / steps
+     */
+    LocalVolCallSurface price_local_vol_call_surface(const LocalVolCallSurfaceInput &in);
+
+} // namespace quantModeling
+
+#endif // ENGINE_PDE_DUPIRE_FORWARD_HPP
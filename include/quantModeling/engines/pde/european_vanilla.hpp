@@ -17,11 +17,29 @@ namespace quantModeling
      * dV/dt + 0.5 * sigma^2 * S^2 * d2V/dS2 + (r-q) * S * dV/dS - r * V = 0
      *
      * Features:
-     * - Crank-Nicolson time discretization (semi-implicit, unconditionally stable)
-     * - Central differences in space
-     * - Thomas algorithm for efficient tridiagonal solve
-     * - Works with any ILocalVolModel
-     * - European exercise only (no early exercise check)
+     * - Crank-Nicolson time discretization (semi-implicit, unconditionally stable),
+     *   with Rannacher start-up: the first two steps are taken as four fully
+     *   implicit half-steps, which damp the payoff kink instead of letting
+     *   it ring through gamma
+     * - Central differences in x = ln(S/K) on a sinh-stretched grid,
+     *   densest between spot and strike, spanning 4σ√T beyond both; the
+     *   spot is a grid node and the payoff is cell-averaged at the strike
+     * - Takes flat r, q from any ILocalVolModel and σ(S, t) from its vol():
+     *   the surface is sampled at the grid nodes at each step's mid-time
+     * - Thomas factorisation of the CN matrix: done once for a flat vol,
+     *   once per step for a local-vol surface; each solve is then a
+     *   division-free forward/back sweep
+     * - American exercise: each step solves the linear complementarity
+     *   problem V ≥ payoff with the Brennan-Schwartz direct solver (the
+     *   exercise region of a vanilla is one-sided in S)
+     *
+     * Greeks come out of the one backward sweep: delta and gamma are
+     * finite differences on the final time layer at the spot node, theta a
+     * second-order difference of the last three layers, and vega and rho solve the σ- and
+     * r-derivatives of the PDE (same operator, the price layer as source)
+     * alongside the price, reusing its matrix.  All five cost about a third
+     * more than the price alone.  Under local vol, vega is the sensitivity
+     * to a parallel shift of the whole surface.
      */
     class PDEEuropeanVanillaEngine final : public EngineBase
     {
@@ -42,12 +60,6 @@ namespace quantModeling
 
         static void validate(const VanillaOption &opt);
 
-        // Thomas algorithm for tridiagonal system Ax = b
-        static void solve_tridiagonal(const std::vector<Real> &a,
-                                      const std::vector<Real> &b,
-                                      const std::vector<Real> &c,
-                                      const std::vector<Real> &d,
-                                      std::vector<Real> &x);
     };
 } // namespace quantModeling
 
@@ -0,0 +1,143 @@
+#ifndef ENGINE_PDE_GRID_HPP
+#define ENGINE_PDE_GRID_HPP
+
+#include "quantModeling/core/types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace quantModeling
+{
+
+    /**
+     * @brief Sinh-stretched nodes on [x_lo, x_hi], densest around x_c.
+     *
+     * x_j = x_c + w sinh(c_lo + (c_hi − c_lo) j / M), so w sets the width
+     * of the concentration region.
+     */
+    inline std::vector<Real> sinh_nodes(Real x_lo, Real x_hi, Real x_c, Real w, int M)
+    {
+        const Real c_lo = std::asinh((x_lo - x_c) / w);
+        const Real c_hi = std::asinh((x_hi - x_c) / w);
+        std::vector<Real> x(M + 1);
+        for (int j = 0; j <= M; ++j)
+            x[j] = x_c + w * std::sinh(c_lo + (c_hi - c_lo) * j / M);
+        x.front() = x_lo;
+        x.back() = x_hi;
+        return x;
+    }
+
+    /**
+     * @brief Sinh-stretched grid on [x_lo, x_hi], densest around x_c,
+     *        shifted so that x_pin is an interior node (spot or strike, as
+     *        the caller needs).  The shift moves the ends by up to half a
+     *        cell.
+     */
+    inline std::vector<Real> sinh_grid(Real x_lo, Real x_hi, Real x_c, Real w, Real x_pin, int M)
+    {
+        std::vector<Real> x = sinh_nodes(x_lo, x_hi, x_c, w, M);
+
+        const int j_pin = static_cast<int>(
+            std::lower_bound(x.begin() + 1, x.end() - 1, x_pin) - x.begin());
+        int j_near = (x_pin - x[j_pin - 1] < x[j_pin] - x_pin) ? j_pin - 1 : j_pin;
+        j_near = std::clamp(j_near, 1, M - 1);
+        const Real shift = x_pin - x[j_near];
+        for (Real &xj : x)
+            xj += shift;
+        x[j_near] = x_pin;
+        return x;
+    }
+
+    /**
+     * @brief Move a node onto each of `pins`, keeping the end nodes (and
+     *        earlier pins) where they are.
+     *
+     * For each pin, the nearest free node between the two fixed nodes that
+     * bracket it is moved onto it and the nodes on either side are
+     * stretched linearly, so the spacing stays smooth up to O(h).  Used
+     * when the ends are barriers and the spot must be a node as well.
+     *
+     * @return the node index of each pin
+     * @throws InvalidInput if a pin lies outside (x_0, x_M) or no free node
+     *         is left between its fixed neighbours
+     */
+    inline std::vector<int> pin_nodes(std::vector<Real> &x, const std::vector<Real> &pins)
+    {
+        const int M = static_cast<int>(x.size()) - 1;
+        std::vector<int> fixed{0, M};
+        std::vector<int> index;
+        for (Real p : pins)
+        {
+            const auto hi_it = std::upper_bound(fixed.begin(), fixed.end(), p,
+                                                [&](Real v, int j) { return v < x[j]; });
+            if (hi_it == fixed.begin() || hi_it == fixed.end())
+                throw InvalidInput("pin_nodes: pin outside the grid");
+            const int a = *(hi_it - 1);
+            const int b = *hi_it;
+            if (x[a] == p)
+            {
+                index.push_back(a);
+                continue;
+            }
+            if (b - a < 2)
+                throw InvalidInput("pin_nodes: grid too coarse to pin every point");
+
+            int j = static_cast<int>(std::lower_bound(x.begin() + a + 1, x.begin() + b, p) - x.begin());
+            if (j == b || (j > a + 1 && p - x[j - 1] < x[j] - p))
+                --j;
+
+            const Real xa = x[a], xb = x[b], xj = x[j];
+            for (int i = a + 1; i < j; ++i)
+                x[i] = xa + (x[i] - xa) * (p - xa) / (xj - xa);
+            for (int i = j + 1; i < b; ++i)
+                x[i] = p + (x[i] - xj) * (xb - p) / (xb - xj);
+            x[j] = p;
+
+            fixed.insert(hi_it, j);
+            index.push_back(j);
+        }
+        return index;
+    }
+
+    /**
+     * @brief Three-point weights for the first and second derivative at the
+     *        interior nodes of a non-uniform grid.
+     */
+    struct GridStencil
+    {
+        std::vector<Real> d1_lo, d1_mid, d1_hi;
+        std::vector<Real> d2_lo, d2_mid, d2_hi;
+
+        explicit GridStencil(const std::vector<Real> &x)
+        {
+            const int n = static_cast<int>(x.size());
+            for (auto *v : {&d1_lo, &d1_mid, &d1_hi, &d2_lo, &d2_mid, &d2_hi})
+                v->assign(n, 0.0);
+            for (int j = 1; j < n - 1; ++j)
+            {
+                const Real hm = x[j] - x[j - 1];
+                const Real hp = x[j + 1] - x[j];
+                const Real hs = hm + hp;
+                d1_lo[j] = -hp / (hm * hs);
+                d1_mid[j] = (hp - hm) / (hm * hp);
+                d1_hi[j] = hm / (hp * hs);
+                d2_lo[j] = 2.0 / (hm * hs);
+                d2_mid[j] = -2.0 / (hm * hp);
+                d2_hi[j] = 2.0 / (hp * hs);
+            }
+        }
+
+        Real d1(const std::vector<Real> &v, int j) const
+        {
+            return d1_lo[j] * v[j - 1] + d1_mid[j] * v[j] + d1_hi[j] * v[j + 1];
+        }
+        Real d2(const std::vector<Real> &v, int j) const
+        {
+            return d2_lo[j] * v[j - 1] + d2_mid[j] * v[j] + d2_hi[j] * v[j + 1];
+        }
+    };
+
+} // namespace quantModeling
+
+#endif // ENGINE_PDE_GRID_HPP
@@ -0,0 +1,186 @@
+#ifndef ENGINE_PDE_TRIDIAGONAL_HPP
+#define ENGINE_PDE_TRIDIAGONAL_HPP
+
+#include "quantModeling/core/types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace quantModeling
+{
+
+    /**
+     * @brief Thomas factorisation of a tridiagonal matrix, computed once and
+     *        reused for every right-hand side.
+     *
+     * Row i reads a_i x_{i−1} + b_i x_i + c_i x_{i+1} = d_i (a_0 and c_{n−1}
+     * are ignored).  factor() stores the elimination multipliers and the
+     * reciprocal pivots, so each solve is one multiply-add sweep each way
+     * with no divisions and no allocation.  For a time-homogeneous
+     * Crank-Nicolson step this replaces a full re-elimination per step.
+     *
+     * The elimination runs either bottom-up (the usual Thomas order,
+     * substitution from the last row back to the first) or top-down.  Both
+     * give the same solution; the order matters for solve_projected(),
+     * the Brennan-Schwartz solver for the linear complementarity problem
+     * x ≥ obstacle, whose substitution must start inside the region where
+     * the obstacle binds: low indices for top-down elimination, high
+     * indices for bottom-up.
+     */
+    class TridiagonalFactor
+    {
+    public:
+        TridiagonalFactor() = default;
+
+        TridiagonalFactor(const std::vector<Real> &a, const std::vector<Real> &b,
+                          const std::vector<Real> &c, bool top_down = false)
+        {
+            factor(a, b, c, top_down);
+        }
+
+        void factor(const std::vector<Real> &a, const std::vector<Real> &b,
+                    const std::vector<Real> &c, bool top_down = false)
+        {
+            const int n = static_cast<int>(b.size());
+            top_down_ = top_down;
+            lower_.assign(n, 0.0);
+            upper_.assign(n, 0.0);
+            inv_pivot_.assign(n, 0.0);
+
+            // lower_ holds the coupling to the already-eliminated neighbour,
+            // upper_ the multiplier applied in the substitution.
+            if (!top_down)
+            {
+                inv_pivot_[0] = 1.0 / b[0];
+                upper_[0] = c[0] * inv_pivot_[0];
+                for (int i = 1; i < n; ++i)
+                {
+                    lower_[i] = a[i];
+                    inv_pivot_[i] = 1.0 / (b[i] - a[i] * upper_[i - 1]);
+                    upper_[i] = c[i] * inv_pivot_[i];
+                }
+            }
+            else
+            {
+                inv_pivot_[n - 1] = 1.0 / b[n - 1];
+                upper_[n - 1] = a[n - 1] * inv_pivot_[n - 1];
+                for (int i = n - 2; i >= 0; --i)
+                {
+                    lower_[i] = c[i];
+                    inv_pivot_[i] = 1.0 / (b[i] - c[i] * upper_[i + 1]);
+                    upper_[i] = a[i] * inv_pivot_[i];
+                }
+            }
+        }
+
+        int size() const { return static_cast<int>(inv_pivot_.size()); }
+
+        /// Solve A x = d; x may alias d.
+        void solve(const std::vector<Real> &d, std::vector<Real> &x) const
+        {
+            solve_impl<false>(d, x, nullptr);
+        }
+
+        /// Brennan-Schwartz: solve A x = d with each unknown projected onto
+        /// the obstacle during substitution.
+        void solve_projected(const std::vector<Real> &d, const std::vector<Real> &obstacle,
+                             std::vector<Real> &x) const
+        {
+            solve_impl<true>(d, x, obstacle.data());
+        }
+
+        /// Solve A x = d in place for `count` systems stored side by side,
+        /// element i of system k at data[i * stride + k].  The inner loop
+        /// runs across the systems, so sweeping the strided axis of a 2D
+        /// grid stays unit-stride in memory.
+        void solve_batch(Real *data, std::size_t stride, int count) const
+        {
+            const int n = size();
+            const auto row = [&](int i) { return data + static_cast<std::size_t>(i) * stride; };
+
+            if (!top_down_)
+            {
+                for (int k = 0; k < count; ++k)
+                    row(0)[k] *= inv_pivot_[0];
+                for (int i = 1; i < n; ++i)
+                {
+                    Real *xi = row(i);
+                    const Real *xp = row(i - 1);
+                    for (int k = 0; k < count; ++k)
+                        xi[k] = (xi[k] - lower_[i] * xp[k]) * inv_pivot_[i];
+                }
+                for (int i = n - 2; i >= 0; --i)
+                {
+                    Real *xi = row(i);
+                    const Real *xn = row(i + 1);
+                    for (int k = 0; k < count; ++k)
+                        xi[k] -= upper_[i] * xn[k];
+                }
+            }
+            else
+            {
+                for (int k = 0; k < count; ++k)
+                    row(n - 1)[k] *= inv_pivot_[n - 1];
+                for (int i = n - 2; i >= 0; --i)
+                {
+                    Real *xi = row(i);
+                    const Real *xn = row(i + 1);
+                    for (int k = 0; k < count; ++k)
+                        xi[k] = (xi[k] - lower_[i] * xn[k]) * inv_pivot_[i];
+                }
+                for (int i = 1; i < n; ++i)
+                {
+                    Real *xi = row(i);
+                    const Real *xp = row(i - 1);
+                    for (int k = 0; k < count; ++k)
+                        xi[k] -= upper_[i] * xp[k];
+                }
+            }
+        }
+
+    private:
+        std::vector<Real> lower_;
+        std::vector<Real> upper_;
+        std::vector<Real> inv_pivot_;
+        bool top_down_ = false;
+
+        template <bool Projected>
+        void solve_impl(const std::vector<Real> &d, std::vector<Real> &x, const Real *obstacle) const
+        {
+            const int n = size();
+            x.resize(n);
+            const auto project = [obstacle](int i, Real v)
+            {
+                if constexpr (Projected)
+                    return std::max(v, obstacle[i]);
+                else
+                    return v;
+            };
+
+            if (!top_down_)
+            {
+                x[0] = d[0] * inv_pivot_[0];
+                for (int i = 1; i < n; ++i)
+                    x[i] = (d[i] - lower_[i] * x[i - 1]) * inv_pivot_[i];
+
+                x[n - 1] = project(n - 1, x[n - 1]);
+                for (int i = n - 2; i >= 0; --i)
+                    x[i] = project(i, x[i] - upper_[i] * x[i + 1]);
+            }
+            else
+            {
+                x[n - 1] = d[n - 1] * inv_pivot_[n - 1];
+                for (int i = n - 2; i >= 0; --i)
+                    x[i] = (d[i] - lower_[i] * x[i + 1]) * inv_pivot_[i];
+
+                x[0] = project(0, x[0]);
+                for (int i = 1; i < n; ++i)
+                    x[i] = project(i, x[i] - upper_[i] * x[i - 1]);
+            }
+        }
+    };
+
+} // namespace quantModeling
+
+#endif // ENGINE_PDE_TRIDIAGONAL_HPP
@@ -0,0 +1,85 @@
+#ifndef ENGINE_PDE_TWO_ASSET_HPP
+#define ENGINE_PDE_TWO_ASSET_HPP
+
+#include "quantModeling/engines/base.hpp"
+#include "quantModeling/instruments/equity/basket.hpp"
+#include "quantModeling/instruments/equity/rainbow.hpp"
+
+namespace quantModeling
+{
+    /**
+     * @brief ADI finite-difference engine for European options on two
+     *        assets under multi-asset Black-Scholes (MultiAssetBSModel).
+     *
+     * Solves, in log-performances x_i = ln(S_i / S_i(0)) and time to expiry τ,
+     *
+     *   V_τ = ½σ₁² V_11 + ½σ₂² V_22 + ρσ₁σ₂ V_12 + μ₁ V_1 + μ₂ V_2 − r V,
+     *
+     * μ_i = r − q_i − ½σ_i², on a sinh-stretched grid per axis (the spot a
+     * node, 4σ_i√T either side) with the Hundsdorfer-Verwer scheme,
+     * θ = ½ + √3/6: the mixed term is explicit and each direction is one
+     * batch of tridiagonal solves, factored once.  The first two steps are
+     * taken as two Douglas θ = 1 half-steps each to damp the payoff kink,
+     * which is also cell-averaged.  The edges carry the discounted payoff
+     * of the forwards.
+     *
+     * The grid lines of each sweep are independent and are split across
+     * settings.pde_threads workers (0 → hardware concurrency, or 1 inside a
+     * WorkStealingPool task such as a price_batch request); every line is
+     * solved the same way whatever the split, so results do not depend on
+     * the thread count.
+     *
+     * Covers BasketOption (any two weights, K ≥ 0, so spreads and exchange
+     * options too), WorstOfOption and BestOfOption.  Greeks come from the
+     * grid: delta and gamma at the spot node (per asset, plus the basket
+     * conventions of BSBasketAnalyticEngine; zero for the performance
+     * payoffs, as in RainbowAnalyticEngine), theta from the last three
+     * layers, and vega (all vols shifted together) and rho from sensitivity
+     * PDEs advanced in the same ADI sweeps.
+     */
+    class PDETwoAssetEngine final : public EngineBase
+    {
+    public:
+        explicit PDETwoAssetEngine(PricingContext ctx);
+
+        void visit(const BasketOption &opt) override;
+        void visit(const WorstOfOption &opt) override;
+        void visit(const BestOfOption &opt) override;
+
+        void visit(const VanillaOption &) override
+        {
+            throw UnsupportedInstrument("PDETwoAssetEngine: use PDEEuropeanVanillaEngine for vanilla options.");
+        }
+        void visit(const AsianOption &) override
+        {
+            throw UnsupportedInstrument("PDETwoAssetEngine does not support Asian options.");
+        }
+        void visit(const BarrierOption &) override
+        {
+            throw UnsupportedInstrument("PDETwoAssetEngine does not support barrier options.");
+        }
+        void visit(const DigitalOption &) override
+        {
+            throw UnsupportedInstrument("PDETwoAssetEngine does not support digital options.");
+        }
+        void visit(const EquityFuture &) override
+        {
+            throw UnsupportedInstrument("PDETwoAssetEngine does not support equity futures.");
+        }
+        void visit(const ZeroCouponBond &) override
+        {
+            throw UnsupportedInstrument("PDETwoAssetEngine does not support bonds.");
+        }
+        void visit(const FixedRateBond &) override
+        {
+            throw UnsupportedInstrument("PDETwoAssetEngine does not support bonds.");
+        }
+
+    private:
+        int M_;       // space steps per axis
+        int N_;       // time steps
+        int threads_; // line-sweep workers
+    };
+} // namespace quantModeling
+
+#endif // ENGINE_PDE_TWO_ASSET_HPP
@@ -17,7 +17,24 @@ namespace quantModeling
      * - N time steps (configurable, default 100)
      * - Works with any ILocalVolModel (Black-Scholes, local vol surfaces, etc.)
      * - Supports both American and European exercise styles
+     * - Spot lattice built once by recurrence; the tree starts two steps before
+     *   t = 0 so delta, gamma and theta are read off the nodes at t = 0
+     *   (only vega needs a second, bumped tree)
      * - Backward induction from maturity with early exercise check
+     *
+     * settings.tree_scheme selects Leisen-Reimer instead: Peizer-Pratt
+     * inversion of Φ(d1) and Φ(d2) on an odd number of steps, which centres
+     * the strike and converges as O(1/N²) for Europeans.  settings.tree_richardson
+     * adds two-point Richardson extrapolation of the price (Greeks stay those
+     * of the N-step tree) against a tree of about N/2 steps; it is meant for
+     * Leisen-Reimer, since CRR's oscillation in the strike position defeats it.
+     *
+     * Leisen-Reimer with Richardson is accurate to about 1e-6 for Europeans
+     * at 101 steps.  For American exercise the error is not a clean power of
+     * N, because the exercise boundary moves across the nodes.  On the
+     * S = K = 100, T = 1 put it is about 3e-4 at 201 steps and reaches 1e-4
+     * only at about 400.  Away from the money it can oscillate by several
+     * 1e-4 at those step counts.
      */
     class BinomialVanillaEngine final : public EngineBase
     {
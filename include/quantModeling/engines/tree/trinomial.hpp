@@ -17,6 +17,9 @@ namespace quantModeling
      * - N time steps (configurable, default 100)
      * - Works with any ILocalVolModel (Black-Scholes, local vol surfaces, etc.)
      * - Supports both American and European exercise styles
+     * - Spot lattice built once by recurrence; the tree starts one step before
+     *   t = 0 so delta, gamma and theta are read off the nodes at t = 0
+     *   (only vega needs a second, bumped tree)
      * - Three branches per node for better convergence
      */
     class TrinomialVanillaEngine final : public EngineBase
@@ -9,6 +9,7 @@ namespace quantModeling
   struct VanillaOption; // fwd
   struct AsianOption;
   struct BarrierOption;
+  struct DoubleBarrierOption;
   struct DigitalOption;
   struct LookbackOption;
   struct BasketOption;
@@ -68,6 +69,7 @@ namespace quantModeling
     virtual void visit(const AsianOption &) = 0;
     virtual void visit(const BarrierOption &) = 0;
     virtual void visit(const DigitalOption &) = 0;
+    virtual void visit(const DoubleBarrierOption &) { throw UnsupportedInstrument("Double barrier option is not supported by this engine."); }
     virtual void visit(const LookbackOption &) { throw UnsupportedInstrument("Lookback option is not supported by this engine."); }
     virtual void visit(const BasketOption &) { throw UnsupportedInstrument("Basket option is not supported by this engine."); }
     virtual void visit(const BondOption &) { throw UnsupportedInstrument("Bond option is not supported by this engine."); }
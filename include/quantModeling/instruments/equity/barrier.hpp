@@ -62,6 +62,53 @@ namespace quantModeling
         void accept(IInstrumentVisitor &v) const override { v.visit(*this); }
     };
 
+    /**
+     * Double barrier knock flavour.
+     *
+     *  KnockOut — killed    when spot touches either barrier
+     *  KnockIn  — activated when spot touches either barrier
+     */
+    enum class DoubleBarrierType
+    {
+        KnockIn,
+        KnockOut
+    };
+
+    /**
+     * Double barrier option instrument: a European vanilla call or put with
+     * a lower barrier L and an upper barrier U, L < U.
+     *
+     * Same conventions as BarrierOption: the rebate is paid at expiry in
+     * the "dead" state, and monitoring is continuous when brownian_bridge
+     * is true, otherwise on n_steps equally spaced dates (0 → weekly).
+     */
+    struct DoubleBarrierOption final : Instrument
+    {
+        std::shared_ptr<const IPayoff> payoff;     ///< vanilla payoff (call/put, strike)
+        std::shared_ptr<const IExercise> exercise; ///< European exercise date (maturity)
+        DoubleBarrierType barrier_type;
+        Real lower_barrier; ///< L
+        Real upper_barrier; ///< U
+        Real rebate = 0.0;  ///< paid at expiry if in "dead" state
+        Real notional = 1.0;
+        int n_steps = 0;             ///< 0 → weekly (52×T)
+        bool brownian_bridge = true; ///< continuous monitoring
+
+        DoubleBarrierOption(std::shared_ptr<const IPayoff> p,
+                            std::shared_ptr<const IExercise> e,
+                            DoubleBarrierType bt,
+                            Real L,
+                            Real U,
+                            Real reb = 0.0,
+                            Real ntl = 1.0)
+            : payoff(std::move(p)), exercise(std::move(e)),
+              barrier_type(bt), lower_barrier(L), upper_barrier(U), rebate(reb), notional(ntl)
+        {
+        }
+
+        void accept(IInstrumentVisitor &v) const override { v.visit(*this); }
+    };
+
 } // namespace quantModeling
 
 #endif // INSTRUMENT_EQUITY_BARRIER_HPP
@@ -27,6 +27,7 @@ namespace quantModeling
         LookbackExtremum extremum = LookbackExtremum::Maximum;
         Real notional = 1.0;
         int n_steps = 0; // 0 => auto (252 * T)
+        bool continuous_monitoring = false; // analytic engine: continuous limit, n_steps ignored
 
         LookbackOption(std::shared_ptr<const IPayoff> p,
                        std::shared_ptr<const IExercise> e,
@@ -3,18 +3,26 @@
 
 #include "quantModeling/instruments/base.hpp"
 
+#include <vector>
+
 namespace quantModeling
 {
 
     /**
-     * @brief European option on a zero-coupon bond.
+     * @brief European option on a zero-coupon or fixed-coupon bond.
      *
      * Payoff at T_option:
-     *   Call: max(P(T_option, T_bond) − K, 0)
-     *   Put:  max(K − P(T_option, T_bond), 0)
+     *   Call: max(B(T_option) − K, 0)
+     *   Put:  max(K − B(T_option), 0)
+     *
+     * With coupon_rate = 0 the underlying is the ZCB P(T_option, T_bond).
+     * Otherwise it is a FixedRateBond maturing at T_bond (same coupon grid
+     * as FixedRateBond), B is its dirty price per unit face and only cash
+     * flows paid strictly after T_option are included.
      *
-     * Priced analytically under Vasicek and Hull-White, via Monte Carlo
-     * for CIR and other short-rate models.
+     * Priced analytically under Vasicek and Hull-White (coupon bonds via
+     * Jamshidian's decomposition), via Monte Carlo for CIR and other
+     * short-rate models.
      */
     struct BondOption final : Instrument
     {
@@ -23,12 +31,23 @@ namespace quantModeling
         Real strike;          ///< K
         bool is_call;
         Real notional = 1.0;
+        Real coupon_rate = 0.0;   ///< annual coupon rate; 0 = zero-coupon underlying
+        int coupon_frequency = 1; ///< coupons per year (coupon bonds only)
 
         BondOption(Time option_mat, Time bond_mat, Real strike_,
                    bool is_call_, Real notional_ = 1.0)
             : option_maturity(option_mat), bond_maturity(bond_mat),
               strike(strike_), is_call(is_call_), notional(notional_) {}
 
+        /**
+         * @brief Underlying cash flows per unit face paid after T_option.
+         *
+         * ZCB: a single unit flow at T_bond.  Coupon bond: c·Δ at each
+         * coupon date i·Δ > T_option, plus the principal at T_bond.
+         */
+        void cash_flows_after_expiry(std::vector<Time> &times,
+                                     std::vector<Real> &amounts) const;
+
         void accept(IInstrumentVisitor &v) const override { v.visit(*this); }
     };
 
@@ -4,6 +4,8 @@
 #include "quantModeling/core/types.hpp"
 #include "quantModeling/models/base.hpp"
 
+#include <optional>
+
 namespace quantModeling
 {
 
@@ -59,6 +61,20 @@ namespace quantModeling
                 "Analytic bond option pricing not available for " + model_name());
         }
 
+        /**
+         * @brief Log-normal volatility σ_p of P(T_option, T_bond) under the
+         *        T_option-forward measure, for Gaussian models.
+         *
+         * Lets batch evaluators (caplet strips) build Black-type d1/d2 arrays
+         * without a virtual call per option.  Returns std::nullopt for models
+         * without a Gaussian bond-price distribution (default).
+         */
+        virtual std::optional<Real> bond_option_vol(Time /*T_option*/,
+                                                    Time /*T_bond*/) const
+        {
+            return std::nullopt;
+        }
+
         // ── MC Euler step ───────────────────────────────────────────────────
 
         /**
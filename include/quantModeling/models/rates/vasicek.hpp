@@ -52,6 +52,9 @@ namespace quantModeling
         Real bond_option_price(bool is_call, Real K,
                                Time T_option, Time T_bond) const override;
 
+        /// σ_p = (σ/a)(1 − e^{−a(S−T)}) √((1 − e^{−2aT}) / (2a))
+        std::optional<Real> bond_option_vol(Time T_option, Time T_bond) const override;
+
         Real euler_step(Real r, Real t, Real dt, Real dW) const override;
 
         std::string model_name() const noexcept override { return "VasicekModel"; }
@@ -6,6 +6,8 @@
 namespace quantModeling
 {
     PricingResult price_equity_barrier_bs_mc(const BarrierBSInput &in);
+    PricingResult price_equity_barrier_bs_analytic(const BarrierBSInput &in);
+    PricingResult price_equity_barrier_bs_pde(const BarrierBSInput &in);
 
 } // namespace quantModeling
 
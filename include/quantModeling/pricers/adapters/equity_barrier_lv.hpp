@@ -6,6 +6,8 @@
 namespace quantModeling
 {
     PricingResult price_equity_barrier_lv_mc(const BarrierLocalVolInput &in);
+    PricingResult price_equity_barrier_lv_pde(const BarrierLocalVolInput &in);
+    PricingResult price_equity_double_barrier_lv_pde(const DoubleBarrierLocalVolInput &in);
 } // namespace quantModeling
 
 #endif
@@ -1,12 +1,24 @@
 #ifndef PRICERS_ADAPTERS_EQUITY_BASKET_HPP
 #define PRICERS_ADAPTERS_EQUITY_BASKET_HPP
 
+#include "quantModeling/instruments/equity/basket.hpp"
 #include "quantModeling/pricers/registry.hpp"
 
+#include <memory>
+
 namespace quantModeling
 {
 
+    struct MultiAssetBSModel;
+
+    /// The model and option every basket route prices (dimension checks and
+    /// the Cholesky factorisation happen here).
+    std::shared_ptr<MultiAssetBSModel> make_basket_bs_model(const BasketBSInput &in);
+    BasketOption make_basket_bs_option(const BasketBSInput &in);
+
     PricingResult price_equity_basket_bs_mc(const BasketBSInput &in);
+    PricingResult price_equity_basket_bs_analytic(const BasketBSInput &in);
+    PricingResult price_equity_basket_bs_pde(const BasketBSInput &in);
 
 } // namespace quantModeling
 
@@ -7,6 +7,7 @@ namespace quantModeling
 {
 
     PricingResult price_equity_lookback_bs_mc(const LookbackBSInput &in);
+    PricingResult price_equity_lookback_bs_analytic(const LookbackBSInput &in);
 
 } // namespace quantModeling
 
@@ -3,11 +3,23 @@
 
 #include "quantModeling/pricers/registry.hpp"
 
+#include <memory>
+
 namespace quantModeling
 {
 
+    struct MultiAssetBSModel;
+
+    /// The model every worst-of/best-of route prices (dimension checks and
+    /// the Cholesky factorisation happen here).
+    std::shared_ptr<MultiAssetBSModel> make_rainbow_bs_model(const RainbowBSInput &in);
+
     PricingResult price_worst_of_bs_mc(const RainbowBSInput &in);
     PricingResult price_best_of_bs_mc(const RainbowBSInput &in);
+    PricingResult price_worst_of_bs_analytic(const RainbowBSInput &in);
+    PricingResult price_best_of_bs_analytic(const RainbowBSInput &in);
+    PricingResult price_worst_of_bs_pde(const RainbowBSInput &in);
+    PricingResult price_best_of_bs_pde(const RainbowBSInput &in);
 
 } // namespace quantModeling
 
@@ -8,6 +8,9 @@ namespace quantModeling
 
     PricingResult price_equity_vanilla_bs(const VanillaBSInput &in, EngineKind engine);
 
+    /// Analytic NPV + Greeks for a whole option chain via price_bs_batch().
+    VanillaBSBatchResult price_equity_vanilla_bs_batch(const VanillaBSBatchInput &in);
+
 } // namespace quantModeling
 
 #endif
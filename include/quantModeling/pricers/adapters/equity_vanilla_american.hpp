@@ -8,7 +8,9 @@ namespace quantModeling
     /**
      * @brief Price American vanilla options using Black-Scholes model
      *
-     * Supports three numerical methods:
+     * Supports four numerical methods:
+     * - Analytic: Andersen-Lake-Offengelt boundary collocation
+     *   (Barone-Adesi-Whaley when in.baw_approximation is set)
      * - BinomialTree: Cox-Ross-Rubinstein binomial tree
      * - TrinomialTree: Boyle's trinomial tree
      * - PDEFiniteDifference: Crank-Nicolson finite difference scheme
@@ -0,0 +1,11 @@
+#ifndef PRICERS_ADAPTERS_EQUITY_VANILLA_LV_HPP
+#define PRICERS_ADAPTERS_EQUITY_VANILLA_LV_HPP
+
+#include "quantModeling/pricers/registry.hpp"
+
+namespace quantModeling
+{
+    PricingResult price_equity_vanilla_lv_pde(const LocalVolInput &in, bool american);
+} // namespace quantModeling
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef PRICERS_CACHE_HPP
+#define PRICERS_CACHE_HPP
+
+#include "quantModeling/pricers/registry.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace quantModeling
+{
+    /**
+     * @brief Canonical byte encoding of a request: its RegistryKey, the
+     *        input alternative and every field of the input, in declaration
+     *        order.
+     *
+     * Numbers are encoded by value (no padding bytes), strings and vectors
+     * by length then contents, nested structs field by field.  Two requests
+     * have the same encoding exactly when they would be priced identically,
+     * so the seed, path counts and grid sizes — the pricing settings, which
+     * all live in the inputs — are part of it.
+     */
+    std::string canonical_request_key(const PricingRequest &request);
+
+    /**
+     * @brief Thread-safe LRU cache of pricing results, bounded by memory.
+     *
+     * Keyed by canonical_request_key(): a hit is a request equal field for
+     * field to one priced before, never merely one with the same hash.
+     * Entries are charged for their key, their result and the bookkeeping
+     * around them; inserting past the capacity evicts least recently used
+     * entries first.  Errors are not cached.
+     *
+     * Results depend only on the request, so nothing goes stale on its own:
+     * invalidate() or clear() when results should be recomputed anyway
+     * (a library upgrade, or to bound the age of what is served).
+     *
+     * Two threads missing on the same key both price it; the second insert
+     * refreshes the entry.
+     */
+    class PricingCache
+    {
+    public:
+        struct Stats
+        {
+            std::uint64_t hits = 0;
+            std::uint64_t misses = 0;
+            std::uint64_t evictions = 0;
+            std::size_t entries = 0;
+            std::size_t bytes = 0;
+            std::size_t capacity_bytes = 0;
+        };
+
+        /// capacity_bytes == 0 disables caching (every lookup misses).
+        explicit PricingCache(std::size_t capacity_bytes = std::size_t{64} << 20);
+
+        PricingCache(const PricingCache &) = delete;
+        PricingCache &operator=(const PricingCache &) = delete;
+
+        /// The cached result for `request`, or price it with `registry` and
+        /// keep the result.
+        PricingResult price(const PricingRequest &request,
+                            const PricingRegistry &registry = default_registry());
+
+        std::optional<PricingResult> find(const PricingRequest &request);
+        void insert(const PricingRequest &request, const PricingResult &result);
+
+        /// Drop the entry for `request`; false if there was none.
+        bool invalidate(const PricingRequest &request);
+        void clear();
+
+        /// Shrinking evicts down to the new capacity.
+        void set_capacity(std::size_t capacity_bytes);
+
+        Stats stats() const;
+        void reset_stats();
+
+    private:
+        struct Entry
+        {
+            std::string key;
+            std::size_t hash;
+            std::size_t bytes;
+            PricingResult result;
+        };
+
+        // Views into Entry::key (list nodes do not move), with the hash
+        // computed before taking the lock.
+        struct KeyRef
+        {
+            std::string_view bytes;
+            std::size_t hash;
+
+            bool operator==(const KeyRef &other) const { return bytes == other.bytes; }
+        };
+        struct KeyRefHash
+        {
+            std::size_t operator()(const KeyRef &key) const noexcept { return key.hash; }
+        };
+
+        std::optional<PricingResult> find(const std::string &key, std::size_t hash);
+        void insert(std::string key, std::size_t hash, const PricingResult &result);
+        void evict_to(std::size_t capacity_bytes);
+
+        mutable std::mutex mutex_;
+        std::list<Entry> lru_; // most recently used first
+        std::unordered_map<KeyRef, std::list<Entry>::iterator, KeyRefHash> index_;
+        std::size_t capacity_bytes_;
+        std::size_t bytes_ = 0;
+        Stats stats_;
+    };
+
+    /// Process-wide cache used by the Python bindings.
+    PricingCache &default_pricing_cache();
+
+} // namespace quantModeling
+
+#endif
@@ -13,6 +13,13 @@ namespace quantModeling
   struct VolSurface;
   struct Fixings;
 
+  /// Lattice parameterisation of BinomialVanillaEngine.
+  enum class TreeScheme
+  {
+    CRR,         ///< Cox-Ross-Rubinstein, u = e^{σ√Δt}
+    LeisenReimer ///< Leisen-Reimer (Peizer-Pratt inversion, odd steps)
+  };
+
   struct PricingSettings
   {
     int mc_paths = 0;
@@ -21,6 +28,9 @@ namespace quantModeling
     int tree_steps = 0;
     int pde_space_steps = 0;
     int pde_time_steps = 0;
+    int pde_threads = 0; // 2D PDE line sweeps; 0 = hardware concurrency (1 in a pool task)
+    TreeScheme tree_scheme = TreeScheme::CRR;
+    bool tree_richardson = false; // extrapolate with a tree of ~half the steps
   };
 
   struct MarketView
@@ -6,6 +6,7 @@
 #include "quantModeling/instruments/equity/barrier.hpp"
 #include "quantModeling/instruments/equity/digital.hpp"
 #include "quantModeling/instruments/equity/lookback.hpp"
+#include <cstdint>
 #include <vector>
 
 namespace quantModeling
@@ -27,6 +28,28 @@ namespace quantModeling
         int tree_steps = 100;
         int pde_space_steps = 100;
         int pde_time_steps = 100;
+
+        /// Binomial engine only: Leisen-Reimer lattice instead of CRR, and
+        /// Richardson extrapolation against a tree of about half the steps.
+        bool tree_leisen_reimer = false;
+        bool tree_richardson = false;
+    };
+
+    /**
+     * @brief Batch of European vanillas for the SoA analytic pricer.
+     *
+     * All vectors must have the same length; is_call is 1 for a call and
+     * 0 for a put (std::vector<bool> has no contiguous storage).
+     */
+    struct VanillaBSBatchInput
+    {
+        std::vector<Real> spot;
+        std::vector<Real> strike;
+        std::vector<Time> maturity;
+        std::vector<Real> rate;
+        std::vector<Real> dividend;
+        std::vector<Real> vol;
+        std::vector<std::uint8_t> is_call;
     };
 
     struct AmericanVanillaBSInput
@@ -42,6 +65,15 @@ namespace quantModeling
         int tree_steps = 100;      // For binomial/trinomial trees
         int pde_space_steps = 100; // For PDE
         int pde_time_steps = 100;  // For PDE
+
+        /// Binomial engine only: Leisen-Reimer lattice instead of CRR, and
+        /// Richardson extrapolation against a tree of about half the steps.
+        bool tree_leisen_reimer = false;
+        bool tree_richardson = false;
+
+        /// Analytic engine only: Barone-Adesi–Whaley quadratic approximation
+        /// instead of the ALO boundary solve (faster, ~1e-2 accuracy).
+        bool baw_approximation = false;
     };
 
     struct AsianBSInput
@@ -58,6 +90,10 @@ namespace quantModeling
         int n_paths = 200000;
         int seed = 1;
         Real mc_epsilon = 0.0;
+
+        /// PDE engine only (arithmetic averaging).
+        int pde_space_steps = 200;
+        int pde_time_steps = 200;
     };
 
     struct EquityFutureInput
@@ -90,6 +126,9 @@ namespace quantModeling
         int n_paths = 50000;
         int seed = 1;
         Real mc_epsilon = 0.0;
+
+        int pde_space_steps = 200;
+        int pde_time_steps = 200;
     };
 
     struct DigitalBSInput
@@ -120,6 +159,7 @@ namespace quantModeling
         // (Float Call -> S_min, Float Put -> S_max) and this field is ignored.
         LookbackExtremum extremum = LookbackExtremum::Maximum;
         int n_steps = 0; ///< monitoring steps per path; 0 = auto (252 × T)
+        bool continuous_monitoring = false; ///< analytic engine only; MC is always discrete
 
         int n_paths = 200000;
         int seed = 1;
@@ -145,6 +185,16 @@ namespace quantModeling
         int n_paths = 200000;
         int seed = 1;
         bool mc_antithetic = true;
+
+        /// Analytic engine only: add Ju's Taylor-expansion correction on top of
+        /// the two-moment (Levy) lognormal match.
+        bool ju_correction = true;
+
+        /// PDE engine only (two assets): grid per axis, time steps and
+        /// line-sweep threads (0 = hardware concurrency, 1 under price_batch).
+        int pde_space_steps = 100;
+        int pde_time_steps = 100;
+        int pde_threads = 0;
     };
 
     struct ZeroCouponBondInput
@@ -202,6 +252,37 @@ namespace quantModeling
 
         int n_paths = 50000;
         int seed = 1;
+
+        int pde_space_steps = 200;
+        int pde_time_steps = 200;
+    };
+
+    /**
+     * @brief Double barrier (knock-out or knock-in on either of L < U)
+     *        under a Dupire local-vol surface, priced by the PDE engine.
+     *
+     * Monitoring follows BarrierLocalVolInput: continuous when
+     * brownian_bridge is true, otherwise on n_steps dates (0 = weekly).
+     */
+    struct DoubleBarrierLocalVolInput
+    {
+        Real spot;
+        Real strike;
+        Time maturity;
+        Real rate;
+        Real dividend;
+        bool is_call;
+        DoubleBarrierType barrier_type = DoubleBarrierType::KnockOut;
+        Real lower_barrier = 0.0;
+        Real upper_barrier = 0.0;
+        Real rebate = 0.0;
+        int n_steps = 0; ///< discrete monitoring dates; 0 = weekly
+        bool brownian_bridge = true;
+
+        LocalVolSurface surface;
+
+        int pde_space_steps = 200;
+        int pde_time_steps = 200;
     };
 
     struct LookbackLocalVolInput
@@ -249,6 +330,9 @@ namespace quantModeling
      *
      * Grid layout: sigma_loc_flat[i * n_T + j] = σ_loc(K_grid[i], T_grid[j]).
      * The C++ engine bilinearly interpolates on this grid for every Euler step.
+     *
+     * The same input drives the local-vol PDE engine (European and American
+     * vanillas); the PDE ignores the MC fields and vice versa.
      */
     struct LocalVolInput
     {
@@ -274,6 +358,33 @@ namespace quantModeling
         int seed = 1;
         bool mc_antithetic = true;
         bool compute_greeks = true;
+
+        int pde_space_steps = 100;
+        int pde_time_steps = 100;
+    };
+
+    /**
+     * @brief Input for the forward Dupire PDE: one solve in (K, T) gives the
+     *        call price for every (strike, maturity) pair requested.
+     *
+     * `surface` uses the same K-major layout as LocalVolInput.  The output
+     * surface is laid out the same way over (strikes, maturities).
+     * pde_time_steps is the step count to the last maturity; every
+     * requested maturity is a time node.
+     */
+    struct LocalVolCallSurfaceInput
+    {
+        Real spot = 100.0;
+        Real rate = 0.05;
+        Real dividend = 0.0;
+
+        LocalVolSurface surface;
+
+        std::vector<Real> strikes;    ///< strictly increasing, > 0
+        std::vector<Time> maturities; ///< strictly increasing, > 0
+
+        int pde_space_steps = 400;
+        int pde_time_steps = 200;
     };
 
     // ─────────────────────────────────────────────────────────────────────────
@@ -321,13 +432,16 @@ namespace quantModeling
         Real sigma;
         Real r0;
         Time option_maturity; ///< option expiry T
-        Time bond_maturity;   ///< underlying ZCB maturity S  (S > T)
-        Real strike;          ///< option strike K
+        Time bond_maturity;   ///< underlying bond maturity S  (S > T)
+        Real strike;          ///< option strike K (dirty price per unit face)
         bool is_call = true;
         Real notional = 1.0;
 
         int n_paths = 200000; ///< MC paths (used only by MC engine)
         int seed = 1;
+
+        Real coupon_rate = 0.0;   ///< 0 = zero-coupon underlying
+        int coupon_frequency = 1; ///< coupons per year (coupon bonds only)
     };
 
     /**
@@ -571,6 +685,12 @@ namespace quantModeling
 
         int n_paths = 200000;
         int seed = 1;
+
+        /// PDE engine only (two assets): grid per axis, time steps and
+        /// line-sweep threads (0 = hardware concurrency, 1 under price_batch).
+        int pde_space_steps = 100;
+        int pde_time_steps = 100;
+        int pde_threads = 0;
     };
 
 } // namespace quantModeling
@@ -0,0 +1,156 @@
+#ifndef UTILS_JET_HPP
+#define UTILS_JET_HPP
+
+#include "quantModeling/core/types.hpp"
+#include "quantModeling/utils/stats.hpp"
+
+#include <cmath>
+
+namespace quantModeling
+{
+
+    /**
+     * @brief Forward-mode jet for closed-form Black-Scholes Greeks.
+     *
+     * Carries a value with its first derivatives in (S, σ, r, T) and the
+     * second derivative in S.  Evaluating a closed-form price on jets yields
+     * delta, gamma, vega, rho and ∂/∂T exactly, without bump sizes — useful
+     * for formulas whose hand-derived Greeks are long (barriers, lookbacks).
+     *
+     * Functions are found by ADL, so code in namespace quantModeling keeps
+     * using std::exp / std::log on plain doubles unaffected.
+     */
+    namespace ad
+    {
+
+        struct Jet
+        {
+            Real v = 0.0;   ///< value
+            Real s = 0.0;   ///< ∂/∂S
+            Real ss = 0.0;  ///< ∂²/∂S²
+            Real sig = 0.0; ///< ∂/∂σ
+            Real r = 0.0;   ///< ∂/∂r
+            Real t = 0.0;   ///< ∂/∂T
+        };
+
+        inline Jet constant(Real c)
+        {
+            Jet j;
+            j.v = c;
+            return j;
+        }
+
+        /// The four independent variables at their current values.
+        inline Jet spot_var(Real S)
+        {
+            Jet j = constant(S);
+            j.s = 1.0;
+            return j;
+        }
+        inline Jet vol_var(Real sigma)
+        {
+            Jet j = constant(sigma);
+            j.sig = 1.0;
+            return j;
+        }
+        inline Jet rate_var(Real r)
+        {
+            Jet j = constant(r);
+            j.r = 1.0;
+            return j;
+        }
+        inline Jet time_var(Real T)
+        {
+            Jet j = constant(T);
+            j.t = 1.0;
+            return j;
+        }
+
+        /// f(a) given f, f', f'' at a.v.
+        inline Jet chain(const Jet &a, Real f, Real f1, Real f2)
+        {
+            return {f, f1 * a.s, f2 * a.s * a.s + f1 * a.ss, f1 * a.sig, f1 * a.r, f1 * a.t};
+        }
+
+        inline Jet operator+(const Jet &a, const Jet &b)
+        {
+            return {a.v + b.v, a.s + b.s, a.ss + b.ss, a.sig + b.sig, a.r + b.r, a.t + b.t};
+        }
+
+        inline Jet operator-(const Jet &a, const Jet &b)
+        {
+            return {a.v - b.v, a.s - b.s, a.ss - b.ss, a.sig - b.sig, a.r - b.r, a.t - b.t};
+        }
+
+        inline Jet operator-(const Jet &a)
+        {
+            return {-a.v, -a.s, -a.ss, -a.sig, -a.r, -a.t};
+        }
+
+        inline Jet operator*(Real c, const Jet &a)
+        {
+            return {c * a.v, c * a.s, c * a.ss, c * a.sig, c * a.r, c * a.t};
+        }
+
+        inline Jet operator*(const Jet &a, Real c) { return c * a; }
+
+        inline Jet operator*(const Jet &a, const Jet &b)
+        {
+            return {a.v * b.v,
+                    a.s * b.v + a.v * b.s,
+                    a.ss * b.v + 2.0 * a.s * b.s + a.v * b.ss,
+                    a.sig * b.v + a.v * b.sig,
+                    a.r * b.v + a.v * b.r,
+                    a.t * b.v + a.v * b.t};
+        }
+
+        inline Jet inverse(const Jet &a)
+        {
+            const Real inv = 1.0 / a.v;
+            return chain(a, inv, -inv * inv, 2.0 * inv * inv * inv);
+        }
+
+        inline Jet operator/(const Jet &a, const Jet &b) { return a * inverse(b); }
+        inline Jet operator/(const Jet &a, Real c) { return (1.0 / c) * a; }
+        inline Jet operator/(Real c, const Jet &a) { return c * inverse(a); }
+
+        inline Jet operator+(const Jet &a, Real c) { return a + constant(c); }
+        inline Jet operator+(Real c, const Jet &a) { return constant(c) + a; }
+        inline Jet operator-(const Jet &a, Real c) { return a - constant(c); }
+        inline Jet operator-(Real c, const Jet &a) { return constant(c) - a; }
+
+        inline Jet exp(const Jet &a)
+        {
+            const Real e = std::exp(a.v);
+            return chain(a, e, e, e);
+        }
+
+        inline Jet log(const Jet &a)
+        {
+            return chain(a, std::log(a.v), 1.0 / a.v, -1.0 / (a.v * a.v));
+        }
+
+        inline Jet sqrt(const Jet &a)
+        {
+            const Real q = std::sqrt(a.v);
+            return chain(a, q, 0.5 / q, -0.25 / (q * a.v));
+        }
+
+        /// Standard normal CDF.
+        inline Jet ncdf(const Jet &a)
+        {
+            const Real n = norm_pdf(a.v);
+            return chain(a, norm_cdf(a.v), n, -a.v * n);
+        }
+
+        /// base^e = exp(e ln base), base > 0.
+        inline Jet pow(const Jet &base, const Jet &e)
+        {
+            return exp(e * log(base));
+        }
+
+    } // namespace ad
+
+} // namespace quantModeling
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef UTILS_THREAD_POOL_HPP
+#define UTILS_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace quantModeling
+{
+    /**
+     * @brief Fixed pool of worker threads with one task deque per worker
+     *        and work stealing.
+     *
+     * parallel_for() deals its indices round-robin onto the workers'
+     * deques.  A worker takes from the back of its own deque; when that is
+     * empty it steals from the front of the others'.  A long task (a 200k
+     * path Monte Carlo) therefore only holds up its own worker: the tasks
+     * queued behind it are taken by whoever runs dry first, so cheap and
+     * expensive work can be mixed in one call without head-of-line blocking.
+     *
+     * The calling thread runs its own call's tasks while it waits, so
+     * parallel_for() may be called from inside a task (or from several
+     * threads at once) without starving the pool.  It never takes another
+     * call's tasks: a cheap batch does not wait behind an unrelated long one.
+     */
+    class WorkStealingPool
+    {
+    public:
+        /// n_threads <= 0 → std::thread::hardware_concurrency() (at least 1).
+        explicit WorkStealingPool(int n_threads = 0);
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool &) = delete;
+        WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+        int size() const { return static_cast<int>(threads_.size()); }
+
+        /// Run fn(i) for every i in [0, n) and return once all have run.
+        /// The first exception thrown by any fn(i) is rethrown here, after
+        /// the remaining indices have run.
+        void parallel_for(std::size_t n, const std::function<void(std::size_t)> &fn);
+
+        /// True while the calling thread is running a parallel_for() task of
+        /// any pool, as a worker or as a caller helping out.  Code that would
+        /// start its own threads can use this to stay single-threaded
+        /// instead of multiplying the pool's.  A single-index call runs
+        /// inline on the caller and does not count.
+        static bool in_task();
+
+    private:
+        struct Job;
+        struct Task
+        {
+            Job *job;
+            std::size_t index;
+        };
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        bool try_pop(std::size_t self, Task &task);
+        bool try_pop_job(const Job *job, Task &task);
+        void run(const Task &task);
+        void worker_loop(std::size_t self);
+
+        std::vector<std::unique_ptr<Queue>> queues_;
+        std::vector<std::thread> threads_;
+        std::atomic<std::size_t> next_queue_{0};
+
+        // Tasks sitting in the deques; workers sleep while it is zero.
+        std::atomic<std::size_t> queued_{0};
+        std::mutex sleep_mutex_;
+        std::condition_variable wake_;
+        bool stop_ = false;
+    };
+
+} // namespace quantModeling
+
+#endif // UTILS_THREAD_POOL_HPP
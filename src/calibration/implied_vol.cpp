@@ -0,0 +1,370 @@
+#include "quantModeling/calibration/implied_vol.hpp"
+
+#include "quantModeling/utils/stats.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace quantModeling
+{
+
+    namespace
+    {
+
+        constexpr Real kInvSqrt2 = 0.70710678118654752440;
+        constexpr Real kInvSqrtPi = 0.56418958354775628695;
+        constexpr Real kInvSqrt2Pi = 0.39894228040143267794;
+        constexpr Real kEps = std::numeric_limits<Real>::epsilon();
+        constexpr int kMaxIterations = 32;
+
+        // ── erfcx(y) = e^{y²} erfc(y), y ≥ 0 ────────────────────────────────
+        //
+        //  Reuses the Cody rational pieces behind norm_cdf: for y > 0.46875
+        //  they already return erfc(y) e^{y²}.
+
+        Real erfcx_pos(Real y)
+        {
+            Real n, d;
+            if (y <= 0.46875)
+            {
+                detail::ncdf_small(y, n, d);
+                return std::exp(y * y) * (1.0 - y * (n / d));
+            }
+            if (y <= 4.0)
+                detail::ncdf_mid(y, n, d);
+            else
+                detail::ncdf_tail(y, n, d);
+            return n / d;
+        }
+
+        // erfcx(a − δ) − erfcx(a + δ) as a Taylor series in δ around a:
+        //
+        //   g^{(k)}(a) = (−2)^k k! u_k,   u_k = e^{a²} i^k erfc(a)
+        //   ⇒ difference = 2 Σ_{k odd} (2δ)^k u_k
+        //
+        //  The u_k (scaled repeated erfc integrals) satisfy
+        //  u_{k−2} = 2k u_k + 2a u_{k−1}.  That recurrence is only weakly
+        //  unstable upwards for small a, so it is run forward from
+        //  u_0 = erfcx(a), u_1 = 1/√π − a u_0 there; for larger a the
+        //  downward direction is the stable one and Miller's algorithm
+        //  (start high, normalise with u_0 = erfcx(a)) is used instead.
+
+        Real erfcx_diff_series(Real a, Real dl)
+        {
+            constexpr int kTop = 120;
+            std::array<Real, kTop + 2> u{};
+            if (a <= 1.25)
+            {
+                u[0] = erfcx_pos(a);
+                u[1] = kInvSqrtPi - a * u[0];
+                for (int k = 2; k <= kTop; ++k)
+                    u[k] = (u[k - 2] - 2.0 * a * u[k - 1]) / (2.0 * k);
+            }
+            else
+            {
+                u[kTop] = 1e-300;
+                for (int k = kTop; k >= 2; --k)
+                {
+                    u[k - 2] = 2.0 * k * u[k] + 2.0 * a * u[k - 1];
+                    if (u[k - 2] > 1e250)
+                        for (int j = k - 2; j <= kTop; ++j)
+                            u[j] *= 1e-250;
+                }
+                const Real scale = erfcx_pos(a) / u[0];
+                for (Real &v : u)
+                    v *= scale;
+            }
+
+            const Real two_dl = 2.0 * dl;
+            const Real two_dl_sq = two_dl * two_dl;
+            Real pw = two_dl;
+            Real sum = 0.0;
+            for (int k = 1; k <= kTop - 40; k += 2)
+            {
+                const Real term = pw * u[k];
+                sum += term;
+                if (std::abs(term) <= 1e-17 * std::abs(sum))
+                    break;
+                pw *= two_dl_sq;
+            }
+            return 2.0 * sum;
+        }
+
+        // ── Out-of-the-money normalised call (x ≤ 0) ─────────────────────────
+        //
+        //  With h = x/s, t = s/2, a = −h/√2, δ = t/√2:
+        //    b = ½ e^{−(a² + δ²)} [erfcx(a − δ) − erfcx(a + δ)]
+        //  which keeps relative precision however small b is.  Once h + t ≥ 0
+        //  the direct N(·) form has no cancellation and is used instead.
+
+        Real otm_call(Real x, Real s)
+        {
+            if (!(s > 0.0))
+                return 0.0;
+            const Real h = x / s;
+            const Real t = 0.5 * s;
+            if (h + t >= 0.0)
+                return std::exp(0.5 * x) * norm_cdf(h + t) - std::exp(-0.5 * x) * norm_cdf(h - t);
+
+            const Real a = -h * kInvSqrt2;
+            const Real dl = t * kInvSqrt2;
+
+            // e^{−(h² + t²)/2} is ill-conditioned in h for deep OTM quotes
+            // (relative error ≈ h² · ulp), so carry the rounding of x/s and
+            // of the squares as a first-order correction.
+            const Real h_lo = std::fma(-h, s, x) / s;
+            const Real hh = h * h;
+            const Real tt = t * t;
+            const Real sum = hh + tt;
+            const Real sum_bb = sum - hh;
+            const Real sum_lo = (hh - (sum - sum_bb)) + (tt - sum_bb);
+            const Real expo = 0.5 * sum;
+            const Real expo_lo = 0.5 * (std::fma(h, h, -hh) + 2.0 * h * h_lo +
+                                        std::fma(t, t, -tt) + sum_lo);
+            if (expo > 745.0)
+                return 0.0;
+
+            const Real diff = (dl <= 0.5 * std::max(a, 0.5))
+                                  ? erfcx_diff_series(a, dl)
+                                  : erfcx_pos(a - dl) - erfcx_pos(a + dl);
+            return 0.5 * std::exp(-expo) * (1.0 - expo_lo) * diff;
+        }
+
+        /// ∂b/∂s = e^{−(h² + t²)/2} / √(2π)
+        Real otm_vega(Real x, Real s)
+        {
+            const Real h = x / s;
+            const Real t = 0.5 * s;
+            return kInvSqrt2Pi * std::exp(-0.5 * (h * h + t * t));
+        }
+
+        // ── Solver in normalised coordinates ─────────────────────────────────
+        //
+        //  Branches (Jäckel 2015, §3-4): with s_c = √(2|x|) the inflection
+        //  point, the tangent at s_c meets b = 0 at s_l and b = b_max at s_u.
+        //    β < b(s_l)          : f = 1/ln b − 1/ln β      (b ~ e^{−x²/2s²})
+        //    β > b(s_u)          : f = ln(b_max − β) − ln(b_max − b)
+        //    otherwise           : f = b − β
+        //  Each transform is close to linear in s on its branch, so third-order
+        //  Householder steps converge in two or three iterations.
+
+        enum class Branch
+        {
+            Low,
+            Mid,
+            High
+        };
+
+        Real solve_normalised(Real beta, Real x)
+        {
+            const Real b_max = std::exp(0.5 * x);
+            const Real ax = std::abs(x);
+
+            const Real s_c = std::sqrt(2.0 * ax);
+            const Real b_c = otm_call(x, s_c);
+            const Real v_c = otm_vega(x, s_c);
+            const Real s_l = s_c - b_c / v_c;
+            const Real s_u = s_c + (b_max - b_c) / v_c;
+            const Real b_l = s_l > 0.0 ? otm_call(x, s_l) : 0.0;
+            const Real b_u = otm_call(x, s_u);
+
+            Branch branch = Branch::Mid;
+            Real s;
+            if (beta < b_l)
+            {
+                branch = Branch::Low;
+                s = std::min(ax / std::sqrt(-2.0 * std::log(beta)), s_l);
+            }
+            else if (beta > b_u)
+            {
+                branch = Branch::High;
+                const Real p = std::min((b_max - beta) / (2.0 * std::cosh(0.5 * x)), 0.5);
+                s = std::max(-2.0 * inverse_norm_cdf(p), s_u);
+            }
+            else
+            {
+                s = s_c + (beta - b_c) / v_c;
+                s = std::clamp(s, std::max(s_l, 0.0), s_u);
+                if (!(s > 0.0))
+                    s = 0.5 * s_u;
+            }
+
+            const Real ln_beta = std::log(beta);
+            const Real ln_gap = std::log(b_max - beta);
+
+            Real lo = 0.0;
+            Real hi = std::numeric_limits<Real>::infinity();
+
+            for (int it = 0; it < kMaxIterations; ++it)
+            {
+                const Real b = otm_call(x, s);
+                if (b == beta)
+                    return s;
+                if (b < beta)
+                    lo = std::max(lo, s);
+                else
+                    hi = std::min(hi, s);
+
+                const Real gap = b_max - b;
+                Real s_new;
+                if ((branch == Branch::Low && !(b > 0.0)) ||
+                    (branch == Branch::High && !(gap > 0.0)))
+                {
+                    s_new = std::isfinite(hi) ? 0.5 * (lo + hi) : 2.0 * s;
+                }
+                else
+                {
+                    const Real b1 = otm_vega(x, s);
+                    const Real w = x * x / (s * s * s) - 0.25 * s;
+                    const Real b2 = b1 * w;
+                    const Real b3 = b1 * (w * w - 3.0 * x * x / (s * s * s * s) - 0.25);
+
+                    Real f, f1, f2, f3;
+                    if (branch == Branch::Low)
+                    {
+                        const Real L = std::log(b);
+                        const Real L1 = b1 / b;
+                        const Real L2 = b2 / b - L1 * L1;
+                        const Real L3 = b3 / b - 3.0 * (b2 / b) * L1 + 2.0 * L1 * L1 * L1;
+                        f = 1.0 / L - 1.0 / ln_beta;
+                        f1 = -L1 / (L * L);
+                        f2 = -L2 / (L * L) + 2.0 * L1 * L1 / (L * L * L);
+                        f3 = -L3 / (L * L) + 6.0 * L1 * L2 / (L * L * L) -
+                             6.0 * L1 * L1 * L1 / (L * L * L * L);
+                    }
+                    else if (branch == Branch::High)
+                    {
+                        const Real M1 = -b1 / gap;
+                        const Real M2 = -b2 / gap - M1 * M1;
+                        const Real M3 = -b3 / gap + 3.0 * (b2 / gap) * M1 + 2.0 * M1 * M1 * M1;
+                        f = ln_gap - std::log(gap);
+                        f1 = -M1;
+                        f2 = -M2;
+                        f3 = -M3;
+                    }
+                    else
+                    {
+                        f = b - beta;
+                        f1 = b1;
+                        f2 = b2;
+                        f3 = b3;
+                    }
+
+                    const Real nu = -f / f1;
+                    const Real h2 = f2 / f1;
+                    const Real h3 = f3 / f1;
+                    s_new = s + nu * (1.0 + 0.5 * h2 * nu) / (1.0 + nu * (h2 + h3 * nu / 6.0));
+
+                    // A converged step may graze the bracket it just set.
+                    if (std::abs(s_new - s) <= 2.0 * kEps * s)
+                        return s_new;
+                    if (!(s_new > lo && s_new < hi))
+                        s_new = std::isfinite(hi) ? 0.5 * (lo + hi) : 2.0 * s;
+                }
+
+                if (std::abs(s_new - s) <= 2.0 * kEps * s_new)
+                    return s_new;
+                s = s_new;
+            }
+            return s;
+        }
+
+    } // anonymous namespace
+
+    // ── Normalised Black ─────────────────────────────────────────────────────
+    //
+    //  b_put(x, s) = b_call(−x, s);  b_call(x, s) = 2 sinh(x/2) + b_call(−x, s)
+    //  for x > 0 (put-call parity), so everything reduces to otm_call.
+
+    Real normalised_black(Real x, Real s, bool is_call)
+    {
+        if (!is_call)
+            x = -x;
+        if (x <= 0.0)
+            return otm_call(x, s);
+        return 2.0 * std::sinh(0.5 * x) + otm_call(-x, s);
+    }
+
+    // ── Scalar implied vol ───────────────────────────────────────────────────
+
+    Real implied_vol_black(Real price, Real forward, Real strike, Time T,
+                           Real discount, bool is_call)
+    {
+        if (!(forward > 0.0))
+            throw InvalidInput("implied_vol_black: forward must be > 0");
+        if (!(strike > 0.0))
+            throw InvalidInput("implied_vol_black: strike must be > 0");
+        if (!(T > 0.0))
+            throw InvalidInput("implied_vol_black: T must be > 0");
+        if (!(discount > 0.0))
+            throw InvalidInput("implied_vol_black: discount must be > 0");
+        if (!std::isfinite(price))
+            throw InvalidInput("implied_vol_black: price must be finite");
+
+        const Real p = price / discount;
+        const Real intrinsic = std::max(is_call ? forward - strike : strike - forward, 0.0);
+        const Real upper = is_call ? forward : strike;
+
+        if (p >= upper)
+            throw InvalidInput("implied_vol_black: price is above the no-arbitrage maximum");
+        if (p <= intrinsic)
+        {
+            if (intrinsic - p <= 4.0 * kEps * upper)
+                return 0.0;
+            throw InvalidInput("implied_vol_black: price is below intrinsic value");
+        }
+
+        // Normalise and reduce to an out-of-the-money call (x ≤ 0).
+        Real x = std::log(forward / strike);
+        Real beta = p / std::sqrt(forward * strike);
+        const Real theta = is_call ? 1.0 : -1.0;
+        bool call = is_call;
+        if (theta * x > 0.0)
+        {
+            beta -= theta * 2.0 * std::sinh(0.5 * x);
+            call = !call;
+        }
+        if (!call)
+            x = -x;
+        if (!(beta > 0.0))
+            return 0.0;
+
+        return solve_normalised(beta, x) / std::sqrt(T);
+    }
+
+    Real implied_vol_bs(Real price, Real spot, Real strike, Time T,
+                        Real r, Real q, bool is_call)
+    {
+        if (!(spot > 0.0))
+            throw InvalidInput("implied_vol_bs: spot must be > 0");
+        const Real forward = spot * std::exp((r - q) * T);
+        return implied_vol_black(price, forward, strike, T, std::exp(-r * T), is_call);
+    }
+
+    // ── Batch ────────────────────────────────────────────────────────────────
+
+    void implied_vol_bs_batch(const ImpliedVolBatchInputView &in, Real *vol)
+    {
+        if (in.n == 0)
+            return;
+        if (!in.price || !in.spot || !in.strike || !in.maturity || !in.rate ||
+            !in.dividend || !in.is_call || !vol)
+            throw InvalidInput("implied_vol_bs_batch: array is null");
+
+        for (std::size_t i = 0; i < in.n; ++i)
+        {
+            try
+            {
+                vol[i] = implied_vol_bs(in.price[i], in.spot[i], in.strike[i], in.maturity[i],
+                                        in.rate[i], in.dividend[i], in.is_call[i] != 0);
+            }
+            catch (const InvalidInput &)
+            {
+                vol[i] = std::numeric_limits<Real>::quiet_NaN();
+            }
+        }
+    }
+
+} // namespace quantModeling
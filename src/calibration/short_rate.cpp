@@ -0,0 +1,502 @@
+#include "quantModeling/calibration/short_rate.hpp"
+
+#include "quantModeling/models/rates/cir.hpp"
+#include "quantModeling/models/rates/hull_white.hpp"
+#include "quantModeling/models/rates/vasicek.hpp"
+#include "quantModeling/utils/stats.hpp"
+
+#include <Eigen/Cholesky>
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace quantModeling
+{
+
+    namespace
+    {
+
+        using Params = std::array<Real, 3>; // (a, b, σ)
+
+        enum class ModelFamily
+        {
+            Gaussian, // Vasicek / Hull-White (b = θ / a)
+            CIR
+        };
+
+        struct QuoteEval
+        {
+            Real price = 0.0;
+            Params grad{}; // ∂price / ∂(a, b, σ)
+        };
+
+        /// Spread [0, n) over up to n_threads std::threads in contiguous chunks.
+        /// The first exception thrown by any worker is rethrown on the caller.
+        template <class Fn>
+        void parallel_for(std::size_t n, int n_threads, Fn &&fn)
+        {
+            const std::size_t workers = std::min<std::size_t>(
+                static_cast<std::size_t>(std::max(1, n_threads)), n);
+            if (workers <= 1)
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                    fn(i);
+                return;
+            }
+
+            const std::size_t chunk = (n + workers - 1) / workers;
+            std::exception_ptr error;
+            std::mutex error_mutex;
+
+            auto run_chunk = [&](std::size_t begin, std::size_t end)
+            {
+                try
+                {
+                    for (std::size_t i = begin; i < end; ++i)
+                        fn(i);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error)
+                        error = std::current_exception();
+                }
+            };
+
+            std::vector<std::thread> pool;
+            pool.reserve(workers - 1);
+            for (std::size_t w = 1; w < workers; ++w)
+            {
+                const std::size_t begin = w * chunk;
+                const std::size_t end = std::min(n, begin + chunk);
+                if (begin < end)
+                    pool.emplace_back(run_chunk, begin, end);
+            }
+            run_chunk(0, std::min(n, chunk));
+            for (auto &t : pool)
+                t.join();
+
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+        // ── Gaussian affine (Vasicek / Hull-White) closed forms + gradients ──
+        //
+        //   B(τ)    = (1 − e^{−aτ}) / a
+        //   ln A(τ) = (B − τ)(b − σ²/(2a²)) − σ² B² / (4a)
+        //   ln P(τ) = ln A(τ) − B(τ) r0
+
+        struct GaussianAffine
+        {
+            Real a, b, sigma, r0;
+
+            Real B(Real tau) const { return (1.0 - std::exp(-a * tau)) / a; }
+
+            /// ∂B/∂a = (τ e^{−aτ} − B) / a
+            Real dB_da(Real tau) const
+            {
+                return (tau * std::exp(-a * tau) - B(tau)) / a;
+            }
+
+            Real ln_zcb(Real tau) const
+            {
+                const Real Bv = B(tau);
+                const Real s2 = sigma * sigma;
+                return (Bv - tau) * (b - 0.5 * s2 / (a * a)) - s2 * Bv * Bv / (4.0 * a) - Bv * r0;
+            }
+
+            /// ∇_(a, b, σ) ln P(0, τ)
+            Params d_ln_zcb(Real tau) const
+            {
+                const Real Bv = B(tau);
+                const Real Ba = dB_da(tau);
+                const Real s2 = sigma * sigma;
+                const Real a2 = a * a;
+                return {
+                    Ba * (b - 0.5 * s2 / a2) + (Bv - tau) * s2 / (a2 * a) - s2 * Bv * Ba / (2.0 * a) + s2 * Bv * Bv / (4.0 * a2) - Ba * r0,
+                    Bv - tau,
+                    -(Bv - tau) * sigma / a2 - sigma * Bv * Bv / (2.0 * a)};
+            }
+
+            /// European option on P(T, S) and its (a, b, σ) gradient.
+            /// Same formula as VasicekModel::bond_option_price(); by the
+            /// Black-formula identities ∂C/∂P_S = N(h), ∂C/∂(K P_T) = −N(h − σ_p)
+            /// and ∂C/∂σ_p = P_S φ(h).
+            QuoteEval bond_option(bool is_call, Real K, Real T, Real S) const
+            {
+                const Real PS = std::exp(ln_zcb(S));
+                const Real PT = std::exp(ln_zcb(T));
+                const Params dPS = scale(d_ln_zcb(S), PS);
+                const Params dPT = scale(d_ln_zcb(T), PT);
+
+                const Real tau = S - T;
+                const Real V = (1.0 - std::exp(-2.0 * a * T)) / (2.0 * a);
+                const Real sqrtV = std::sqrt(V);
+                const Real dV_da = (T * std::exp(-2.0 * a * T) - V) / a;
+                const Real Btau = B(tau);
+                const Real sigma_p = sigma * Btau * sqrtV;
+                const Params dsp = {
+                    sigma * (dB_da(tau) * sqrtV + Btau * dV_da / (2.0 * sqrtV)),
+                    0.0,
+                    Btau * sqrtV};
+
+                const Real h = std::log(PS / (K * PT)) / sigma_p + 0.5 * sigma_p;
+                const Real vega = PS * norm_pdf(h);
+
+                QuoteEval out;
+                if (is_call)
+                {
+                    const Real Nh = norm_cdf(h);
+                    const Real Nh2 = norm_cdf(h - sigma_p);
+                    out.price = PS * Nh - K * PT * Nh2;
+                    for (std::size_t j = 0; j < 3; ++j)
+                        out.grad[j] = Nh * dPS[j] - K * Nh2 * dPT[j] + vega * dsp[j];
+                }
+                else
+                {
+                    const Real Nmh = norm_cdf(-h);
+                    const Real Nmh2 = norm_cdf(sigma_p - h);
+                    out.price = K * PT * Nmh2 - PS * Nmh;
+                    for (std::size_t j = 0; j < 3; ++j)
+                        out.grad[j] = -Nmh * dPS[j] + K * Nmh2 * dPT[j] + vega * dsp[j];
+                }
+                return out;
+            }
+
+            static Params scale(Params v, Real s)
+            {
+                for (auto &x : v)
+                    x *= s;
+                return v;
+            }
+        };
+
+        // ── CIR ZCB (no Feller check, so FD bumps near the boundary work) ────
+        //
+        //   Same closed form as CIRModel::zcb_price(), with ln A evaluated in
+        //   the cancellation-free form used by CIRModel::A().
+
+        Real cir_zcb(const Params &p, Real r0, Real tau)
+        {
+            const Real a = p[0], b = p[1], s = p[2];
+            const Real g = std::sqrt(a * a + 2.0 * s * s);
+            const Real eps = 2.0 * s * s / (g + a); // g − a
+            const Real egt = std::exp(g * tau);
+            const Real B = 2.0 * (egt - 1.0) / ((g + a) * (egt - 1.0) + 2.0 * g);
+            const Real ln_ratio = std::log1p(eps / (g + a)) - 0.5 * eps * tau -
+                                  std::log1p(eps / ((g + a) * egt));
+            return std::exp((2.0 * a * b / (s * s)) * ln_ratio - B * r0);
+        }
+
+        // ── Quote evaluation ─────────────────────────────────────────────────
+
+        void validate_quote(const ShortRateQuote &q, ModelFamily family)
+        {
+            if (family == ModelFamily::CIR && q.type != ShortRateQuoteType::ZeroCouponBond)
+                throw UnsupportedInstrument(
+                    "calibrate_short_rate: CIR has no analytic option formula; "
+                    "only ZeroCouponBond quotes are supported");
+
+            switch (q.type)
+            {
+            case ShortRateQuoteType::ZeroCouponBond:
+                if (q.end <= 0.0)
+                    throw InvalidInput("calibrate_short_rate: ZCB quote maturity must be > 0");
+                break;
+            case ShortRateQuoteType::BondOption:
+                if (q.start <= 0.0 || q.end <= q.start)
+                    throw InvalidInput("calibrate_short_rate: bond option quote needs 0 < start < end");
+                if (q.strike <= 0.0)
+                    throw InvalidInput("calibrate_short_rate: bond option quote strike must be > 0");
+                break;
+            case ShortRateQuoteType::Caplet:
+                if (q.start <= 0.0 || q.end <= q.start)
+                    throw InvalidInput("calibrate_short_rate: caplet quote needs 0 < start < end");
+                break;
+            case ShortRateQuoteType::CapFloor:
+                if (q.schedule.size() < 2)
+                    throw InvalidInput("calibrate_short_rate: cap/floor quote schedule needs >= 2 dates");
+                for (std::size_t i = 0; i + 1 < q.schedule.size(); ++i)
+                    if (q.schedule[i + 1] <= q.schedule[i])
+                        throw InvalidInput("calibrate_short_rate: cap/floor schedule must be increasing");
+                break;
+            }
+        }
+
+        /// Caplet = (1 + Kδ) · Put(1/(1 + Kδ), T_start, T_end), floorlet = Call.
+        QuoteEval gaussian_caplet(const GaussianAffine &m, bool is_cap, Real K,
+                                  Real start, Real end)
+        {
+            const Real factor = 1.0 + K * (end - start);
+            QuoteEval bo = m.bond_option(!is_cap, 1.0 / factor, start, end);
+            bo.price *= factor;
+            bo.grad = GaussianAffine::scale(bo.grad, factor);
+            return bo;
+        }
+
+        QuoteEval eval_gaussian(const ShortRateQuote &q, const Params &p, Real r0)
+        {
+            const GaussianAffine m{p[0], p[1], p[2], r0};
+            QuoteEval out;
+
+            switch (q.type)
+            {
+            case ShortRateQuoteType::ZeroCouponBond:
+                out.price = std::exp(m.ln_zcb(q.end));
+                out.grad = GaussianAffine::scale(m.d_ln_zcb(q.end), out.price);
+                break;
+            case ShortRateQuoteType::BondOption:
+                out = m.bond_option(q.is_call, q.strike, q.start, q.end);
+                break;
+            case ShortRateQuoteType::Caplet:
+                out = gaussian_caplet(m, q.is_call, q.strike, q.start, q.end);
+                break;
+            case ShortRateQuoteType::CapFloor:
+                // Same caplet decomposition as ShortRateAnalyticEngine: expired
+                // periods (T_i ≤ 0) are skipped.
+                for (std::size_t i = 0; i + 1 < q.schedule.size(); ++i)
+                {
+                    if (q.schedule[i] <= 0.0)
+                        continue;
+                    const QuoteEval c = gaussian_caplet(m, q.is_call, q.strike,
+                                                        q.schedule[i], q.schedule[i + 1]);
+                    out.price += c.price;
+                    for (std::size_t j = 0; j < 3; ++j)
+                        out.grad[j] += c.grad[j];
+                }
+                break;
+            }
+
+            out.price *= q.notional;
+            out.grad = GaussianAffine::scale(out.grad, q.notional);
+            return out;
+        }
+
+        QuoteEval eval_cir(const ShortRateQuote &q, const Params &p, Real r0)
+        {
+            QuoteEval out;
+            out.price = q.notional * cir_zcb(p, r0, q.end);
+            for (std::size_t j = 0; j < 3; ++j)
+            {
+                const Real h = 1e-6 * std::max(std::abs(p[j]), 1e-4);
+                Params up = p, dn = p;
+                up[j] += h;
+                dn[j] -= h;
+                out.grad[j] = q.notional * (cir_zcb(up, r0, q.end) - cir_zcb(dn, r0, q.end)) / (2.0 * h);
+            }
+            return out;
+        }
+
+        // ── Parameter admissibility — delegated to the model constructors ────
+
+        std::string admissible_model_name(const std::string &model_type,
+                                          const Params &p, Real r0)
+        {
+            if (model_type == "vasicek")
+                return VasicekModel(p[0], p[1], p[2], r0).model_name();
+            if (model_type == "cir")
+                return CIRModel(p[0], p[1], p[2], r0).model_name();
+            return HullWhiteModel(p[0], p[2], r0, p[0] * p[1]).model_name();
+        }
+
+        bool admissible(const std::string &model_type, const Params &p, Real r0)
+        {
+            try
+            {
+                admissible_model_name(model_type, p, r0);
+                return std::isfinite(p[0]) && std::isfinite(p[1]) && std::isfinite(p[2]);
+            }
+            catch (const InvalidInput &)
+            {
+                return false;
+            }
+        }
+
+        double ms_since(std::chrono::steady_clock::time_point t0)
+        {
+            return std::chrono::duration<double, std::milli>(
+                       std::chrono::steady_clock::now() - t0)
+                .count();
+        }
+
+    } // anonymous namespace
+
+    ShortRateCalibrationResult calibrate_short_rate(const ShortRateCalibrationInput &in)
+    {
+        const auto t_start = std::chrono::steady_clock::now();
+
+        ModelFamily family;
+        if (in.model_type == "vasicek" || in.model_type == "hull_white")
+            family = ModelFamily::Gaussian;
+        else if (in.model_type == "cir")
+            family = ModelFamily::CIR;
+        else
+            throw InvalidInput("calibrate_short_rate: unknown short-rate model type: " + in.model_type);
+
+        if (in.quotes.empty())
+            throw InvalidInput("calibrate_short_rate: no quotes supplied");
+        for (const auto &q : in.quotes)
+            validate_quote(q, family);
+
+        Params p = {in.a, in.b, in.sigma};
+        const std::string model_name = admissible_model_name(in.model_type, p, in.r0);
+
+        // Free parameter indices into (a, b, σ)
+        std::vector<std::size_t> free = {0};
+        if (in.calibrate_long_term)
+            free.push_back(1);
+        free.push_back(2);
+        const auto n_free = static_cast<Eigen::Index>(free.size());
+
+        const std::size_t n_quotes = in.quotes.size();
+        const int hw = static_cast<int>(std::thread::hardware_concurrency());
+        const int n_threads = in.n_threads > 0 ? in.n_threads : std::max(1, hw);
+
+        std::vector<QuoteEval> evals(n_quotes);
+        auto evaluate = [&](const Params &x)
+        {
+            parallel_for(n_quotes, n_threads, [&](std::size_t i)
+                         { evals[i] = family == ModelFamily::Gaussian
+                                          ? eval_gaussian(in.quotes[i], x, in.r0)
+                                          : eval_cir(in.quotes[i], x, in.r0); });
+        };
+
+        // Weighted residuals r_i = w_i (model_i − market_i) and Jacobian rows.
+        // a and σ are stepped in log-space (x = ln a, ln σ) so that LM never
+        // has to walk along the positivity bound; b is stepped directly.
+        Eigen::VectorXd r(static_cast<Eigen::Index>(n_quotes));
+        Eigen::MatrixXd J(static_cast<Eigen::Index>(n_quotes), n_free);
+        auto assemble = [&](const Params &x)
+        {
+            for (std::size_t i = 0; i < n_quotes; ++i)
+            {
+                const auto row = static_cast<Eigen::Index>(i);
+                const Real w = in.quotes[i].weight;
+                r(row) = w * (evals[i].price - in.quotes[i].market_price);
+                for (Eigen::Index j = 0; j < n_free; ++j)
+                {
+                    const std::size_t k = free[static_cast<std::size_t>(j)];
+                    J(row, j) = w * evals[i].grad[k] * (k == 1 ? 1.0 : x[k]);
+                }
+            }
+            return 0.5 * r.squaredNorm();
+        };
+
+        evaluate(p);
+        Real objective = assemble(p);
+
+        ShortRateCalibrationResult out;
+        Real lambda = in.initial_lambda;
+        std::string stop_reason = "max iterations reached";
+
+        for (int it = 1; it <= in.max_iterations; ++it)
+        {
+            const auto t_iter = std::chrono::steady_clock::now();
+            out.iterations = it;
+
+            const Eigen::MatrixXd A = J.transpose() * J;
+            const Eigen::VectorXd g = J.transpose() * r;
+
+            if (objective == 0.0 || g.lpNorm<Eigen::Infinity>() <= in.tolerance * in.tolerance)
+            {
+                out.converged = true;
+                stop_reason = "gradient vanished";
+                out.history.push_back({it, objective, lambda, false, ms_since(t_iter)});
+                break;
+            }
+
+            // (JᵀJ + λ diag(JᵀJ)) δ = −Jᵀr   (Marquardt scaling)
+            Eigen::MatrixXd M = A;
+            for (Eigen::Index j = 0; j < n_free; ++j)
+                M(j, j) += lambda * std::max(A(j, j), 1e-30);
+            const Eigen::VectorXd delta = M.ldlt().solve(-g);
+
+            Params trial = p;
+            for (Eigen::Index j = 0; j < n_free; ++j)
+            {
+                const std::size_t k = free[static_cast<std::size_t>(j)];
+                trial[k] = (k == 1) ? trial[k] + delta(j) : trial[k] * std::exp(delta(j));
+            }
+
+            bool accepted = false;
+            if (delta.allFinite() && admissible(in.model_type, trial, in.r0))
+            {
+                const std::vector<QuoteEval> saved = evals;
+                const Eigen::VectorXd r_saved = r;
+                const Eigen::MatrixXd J_saved = J;
+
+                evaluate(trial);
+                const Real trial_objective = assemble(trial);
+
+                if (std::isfinite(trial_objective) && trial_objective < objective)
+                {
+                    accepted = true;
+                    const Real reduction = objective - trial_objective;
+                    Real rel_step = 0.0;
+                    for (std::size_t j : free)
+                        rel_step = std::max(rel_step, std::abs(trial[j] - p[j]) / (std::abs(p[j]) + in.tolerance));
+                    p = trial;
+                    objective = trial_objective;
+                    lambda = std::max(lambda / 10.0, 1e-15);
+
+                    if (rel_step <= in.tolerance || reduction <= in.tolerance * objective)
+                    {
+                        out.converged = true;
+                        stop_reason = "relative step / objective change below tolerance";
+                    }
+                }
+                else
+                {
+                    evals = saved;
+                    r = r_saved;
+                    J = J_saved;
+                }
+            }
+
+            if (!accepted)
+                lambda *= 10.0;
+
+            out.history.push_back({it, objective, lambda, accepted, ms_since(t_iter)});
+
+            if (out.converged)
+                break;
+            if (lambda > 1e15)
+            {
+                // No step is accepted any more, however short.  That is not a
+                // convergence test: the fit may be stuck far from the quotes.
+                stop_reason = "damping saturated at a local minimum";
+                break;
+            }
+        }
+
+        out.a = p[0];
+        out.b = p[1];
+        out.sigma = p[2];
+        out.r0 = in.r0;
+        out.objective = objective;
+        out.model_prices.resize(n_quotes);
+        out.residuals.resize(n_quotes);
+        Real sq = 0.0;
+        for (std::size_t i = 0; i < n_quotes; ++i)
+        {
+            out.model_prices[i] = evals[i].price;
+            out.residuals[i] = evals[i].price - in.quotes[i].market_price;
+            sq += out.residuals[i] * out.residuals[i];
+        }
+        out.rmse = std::sqrt(sq / static_cast<Real>(n_quotes));
+        out.total_ms = ms_since(t_start);
+        out.diagnostics = "Levenberg-Marquardt short-rate calibration (" + model_name + "), " +
+                          std::to_string(out.iterations) + " iterations, " +
+                          std::to_string(std::min<std::size_t>(static_cast<std::size_t>(n_threads), n_quotes)) +
+                          " threads: " + stop_reason;
+        return out;
+    }
+
+} // namespace quantModeling
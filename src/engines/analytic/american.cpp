@@ -0,0 +1,719 @@
+#include "quantModeling/engines/analytic/american.hpp"
+#include "quantModeling/core/types.hpp"
+#include "quantModeling/utils/jet.hpp"
+#include "quantModeling/utils/stats.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace quantModeling
+{
+
+    namespace
+    {
+
+        using ad::Jet;
+        using ad::constant;
+
+        constexpr Real kPi = 3.14159265358979323846;
+
+        // ── Gauss-Legendre rule on [0, 1] in the angle ─────────────────────────
+        //
+        //  x = cos²θ, θ ∈ [0, π/2]:  ∫₀¹ f(x) dx = ∫₀^{π/2} f(cos²θ) sin 2θ dθ.
+        //  √x = cos θ and √(1 − x) = sin θ are both smooth in θ, which
+        //  absorbs the 1/√(τ − u) and √u-type end-point behaviour of the ALO
+        //  integrands, so Gauss-Legendre in θ converges geometrically.  The
+        //  complement 1 − x is kept separately so that τ − u stays exact.
+
+        struct UnitRule
+        {
+            std::vector<Real> x;  ///< nodes
+            std::vector<Real> xc; ///< 1 − nodes
+            std::vector<Real> w;  ///< weights (Jacobian included)
+        };
+
+        UnitRule make_sine_legendre(int order)
+        {
+            UnitRule rule;
+            for (int i = 0; i < order; ++i)
+            {
+                // Newton on P_order from Tricomi's estimate of the i-th root.
+                Real y = std::cos(kPi * (i + 0.75) / (order + 0.5));
+                Real dp = 1.0;
+                for (int it = 0; it < 100; ++it)
+                {
+                    Real p0 = 1.0, p1 = y;
+                    for (int k = 2; k <= order; ++k)
+                    {
+                        const Real p2 = ((2 * k - 1) * y * p1 - (k - 1) * p0) / k;
+                        p0 = p1;
+                        p1 = p2;
+                    }
+                    dp = order * (y * p1 - p0) / (y * y - 1.0);
+                    const Real dy = p1 / dp;
+                    y -= dy;
+                    if (std::abs(dy) < 1e-16)
+                        break;
+                }
+                const Real wy = 2.0 / ((1.0 - y * y) * dp * dp);
+                const Real theta = 0.25 * kPi * (1.0 + y);
+                const Real c = std::cos(theta), sn = std::sin(theta);
+                rule.x.push_back(c * c);
+                rule.xc.push_back(sn * sn);
+                rule.w.push_back(0.25 * kPi * wy * 2.0 * sn * c);
+            }
+            return rule;
+        }
+
+        /// The rule of each order used, built once per process.
+        template <int Order>
+        const UnitRule &sine_legendre()
+        {
+            static const UnitRule rule = make_sine_legendre(Order);
+            return rule;
+        }
+
+        // ── Collocation grid ───────────────────────────────────────────────────
+        //
+        //  The boundary is interpolated as H(z) = (ln B/X)², z = 2√(τ/T) − 1,
+        //  through the Chebyshev nodes z_i = cos(iπ/n): i = 0 is τ = T, i = n is τ = 0.
+        //  In units of T, the nodes, the quadrature points u = τ_i x_k of the
+        //  integrals at each node and the maps from node values to H at those
+        //  points depend on n and the rule only.
+
+        using RowMatrix = Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+        struct ALOGrid
+        {
+            int n;
+            const UnitRule *quad;
+            std::vector<Real> node; ///< τ_i / T
+            Eigen::MatrixXd C;      ///< Chebyshev coefficients from node values: c = C h
+            RowMatrix P;            ///< H at point (i, k) from c: P(i l + k, j) = T_j(z_ik)
+        };
+
+        ALOGrid make_alo_grid(int n, const UnitRule &quad)
+        {
+            const std::size_t nq = quad.x.size();
+            ALOGrid grid{n, &quad, std::vector<Real>(n + 1), Eigen::MatrixXd(n + 1, n + 1),
+                         RowMatrix(n * nq, n + 1)};
+
+            // End terms halved: H(z) = Σ_k c_k T_k(z) interpolates h_i at z_i.
+            for (int k = 0; k <= n; ++k)
+                for (int i = 0; i <= n; ++i)
+                    grid.C(k, i) = (2.0 / n) * std::cos(kPi * ((i * k) % (2 * n)) / n) *
+                                   (i == 0 || i == n ? 0.5 : 1.0) * (k == 0 || k == n ? 0.5 : 1.0);
+
+            for (int i = 0; i <= n; ++i)
+            {
+                const Real xi = 0.5 * (1.0 + std::cos(kPi * i / n));
+                grid.node[i] = xi * xi;
+                if (i == n)
+                    break;
+                for (std::size_t k = 0; k < nq; ++k)
+                {
+                    const std::size_t row = i * nq + k;
+                    const Real z = 2.0 * xi * std::sqrt(quad.x[k]) - 1.0;
+                    grid.P(row, 0) = 1.0;
+                    grid.P(row, 1) = z;
+                    for (int j = 2; j <= n; ++j)
+                        grid.P(row, j) = 2.0 * z * grid.P(row, j - 1) - grid.P(row, j - 2);
+                }
+            }
+            return grid;
+        }
+
+        /// The grid of each (n, l) used, built once per process.
+        template <int N, int Order>
+        const ALOGrid &alo_grid()
+        {
+            static const ALOGrid grid = make_alo_grid(N, sine_legendre<Order>());
+            return grid;
+        }
+
+        /// ALO discretisation, the paper's (l, m, n, p): the grid (n nodes,
+        /// boundary integrals of order l), a cap m on the Newton steps (they
+        /// stop once the boundary has converged), and the rule of the
+        /// early-exercise premium (order p).
+        struct ALOSettings
+        {
+            const ALOGrid *grid;
+            int iterations;
+            const UnitRule *premium;
+        };
+
+        ALOSettings alo_settings(AmericanAnalyticScheme scheme)
+        {
+            switch (scheme)
+            {
+            case AmericanAnalyticScheme::ALOFast:
+                return {&alo_grid<8, 12>(), 6, &sine_legendre<16>()};
+            case AmericanAnalyticScheme::ALOHighPrecision:
+                return {&alo_grid<48, 64>(), 8, &sine_legendre<96>()};
+            default:
+                return {&alo_grid<20, 16>(), 8, &sine_legendre<32>()};
+            }
+        }
+
+        // ── Unit-strike American put ───────────────────────────────────────────
+        //
+        //  Both options reduce to p(x; r, q) = P(x, 1; r, q):
+        //    put   P(S, K; r, q) = K p(S/K; r, q)
+        //    call  C(S, K; r, q) = S p(K/S; q, r)
+        //  The boundary is solved once per (r, q, σ, T); spot only enters
+        //  through x, so p is cheap to evaluate on a jet in x.  The jet's
+        //  rate slot is the model's rate: r of the put frame for a put, q of
+        //  it for a call.
+
+        class UnitAmericanPut
+        {
+        public:
+            UnitAmericanPut(Real r, Real q, Real sigma, Real T, AmericanAnalyticScheme scheme,
+                            bool rate_is_q)
+                : r_(r), q_(q), sigma_(sigma), T_(T), rate_is_q_(rate_is_q)
+            {
+                if (r_ <= 0.0)
+                {
+                    if (q_ < r_)
+                        throw UnsupportedInstrument(
+                            "BSAmericanAnalyticEngine: q < r < 0 has two exercise boundaries");
+                    mode_ = Mode::European;
+                    return;
+                }
+
+                X_ = (q_ > 0.0) ? std::min(1.0, r_ / q_) : 1.0;
+                if (scheme == AmericanAnalyticScheme::BaroneAdesiWhaley)
+                {
+                    mode_ = Mode::BAW;
+                    baw_x_ = baw_boundary(T_);
+                    const Real st = sigma_ * std::sqrt(T_);
+                    const Real d1 = (std::log(baw_x_) + (r_ - q_ + 0.5 * sigma_ * sigma_) * T_) / st;
+                    baw_q1_ = baw_exponent(T_);
+                    baw_A_ = -(baw_x_ / baw_q1_) * (1.0 - std::exp(-q_ * T_) * norm_cdf(-d1));
+                    return;
+                }
+
+                mode_ = Mode::ALO;
+                log_X_ = std::log(X_);
+                // X = r/q below the strike moves with the rates.
+                if (q_ > 0.0 && r_ < q_)
+                    dlog_X_rate_ = rate_is_q_ ? -1.0 / q_ : 1.0 / r_;
+                solve_boundary(alo_settings(scheme));
+            }
+
+            /// Price at moneyness x = S/K of the put frame, with its
+            /// sensitivities to σ and to the model's rate (see exact_greeks()).
+            Jet value(const Jet &x) const
+            {
+                const Jet sig = ad::vol_var(sigma_);
+                const Jet r = rate_is_q_ ? constant(r_) : ad::rate_var(r_);
+                const Jet q = rate_is_q_ ? ad::rate_var(q_) : constant(q_);
+                switch (mode_)
+                {
+                case Mode::European:
+                    return european(x, r, q, sig);
+                case Mode::BAW:
+                    if (x.v <= baw_x_)
+                        return 1.0 - x;
+                    return european(x, r, q, sig) + baw_A_ * exp(baw_q1_ * log(x / baw_x_));
+                case Mode::ALO:
+                    break;
+                }
+
+                if (x.v <= boundary(T_))
+                    return 1.0 - x;
+
+                // The boundary is held at its converged values and moved
+                // along its tangents, so σ and r differentiate through it.
+                const Jet lx = log(x);
+                const Jet mu = r - q + 0.5 * sig * sig;
+                const UnitRule &rule = *premium_quad_;
+                Jet premium = constant(0.0);
+                for (std::size_t k = 0; k < rule.x.size(); ++k)
+                {
+                    const Real u = T_ * rule.x[k];
+                    const Real s = T_ * rule.xc[k];
+                    const Jet ss = std::sqrt(s) * sig;
+                    const Jet dp = (lx - log_boundary_jet(2.0 * std::sqrt(u / T_) - 1.0) + s * mu) / ss;
+                    const Jet dm = dp - ss;
+                    premium = premium + (T_ * rule.w[k]) *
+                                            (r * exp(-s * r) * ncdf(-dm) -
+                                             q * exp(-s * q) * x * ncdf(-dp));
+                }
+                return european(x, r, q, sig) + premium;
+            }
+
+            /// True when the value solves the Black-Scholes PDE wherever it is
+            /// not intrinsic, so that theta follows from delta and gamma, and
+            /// its jet carries exact σ and rate sensitivities.  Not for BAW.
+            bool exact_greeks() const { return mode_ != Mode::BAW; }
+
+            /// True when x lies in the exercise region at inception.
+            bool exercised(Real x) const
+            {
+                switch (mode_)
+                {
+                case Mode::European:
+                    return false;
+                case Mode::BAW:
+                    return x <= baw_x_;
+                case Mode::ALO:
+                    break;
+                }
+                return x <= boundary(T_);
+            }
+
+            std::string describe() const
+            {
+                switch (mode_)
+                {
+                case Mode::European:
+                    return "European (early exercise never optimal)";
+                case Mode::BAW:
+                    return "Barone-Adesi-Whaley";
+                case Mode::ALO:
+                    break;
+                }
+                return std::string("ALO FP-B Newton") +
+                       ", n=" + std::to_string(cheb_.size() - 1) +
+                       ", m=" + std::to_string(steps_) + "/" + std::to_string(iterations_) +
+                       ", l=" + std::to_string(quad_points_) +
+                       ", p=" + std::to_string(premium_quad_->x.size());
+            }
+
+        private:
+            enum class Mode
+            {
+                European,
+                BAW,
+                ALO
+            };
+
+            Real r_, q_, sigma_, T_;
+            bool rate_is_q_;
+            Mode mode_ = Mode::European;
+            Real X_ = 1.0, log_X_ = 0.0;
+            Real dlog_X_rate_ = 0.0; ///< ∂ ln X / ∂ model rate
+
+            Real baw_x_ = 0.0, baw_q1_ = 0.0, baw_A_ = 0.0;
+
+            int iterations_ = 0;
+            int steps_ = 0;
+            std::vector<Real> cheb_;       ///< Chebyshev coefficients of H(z)
+            std::vector<Real> cheb_sig_;   ///< ... of ∂H/∂σ
+            std::vector<Real> cheb_rate_;  ///< ... of ∂H/∂ model rate
+            std::size_t quad_points_ = 0;
+            const UnitRule *premium_quad_ = nullptr;
+
+            Jet european(const Jet &x, const Jet &r, const Jet &q, const Jet &sig) const
+            {
+                const Jet st = std::sqrt(T_) * sig;
+                const Jet dp = (log(x) + T_ * (r - q + 0.5 * sig * sig)) / st;
+                const Jet dm = dp - st;
+                return exp(-T_ * r) * ncdf(-dm) - exp(-T_ * q) * x * ncdf(-dp);
+            }
+
+            // ── Barone-Adesi–Whaley ────────────────────────────────────────────
+            //
+            //  p ≈ p_E(x) + A (x/x*)^{q1} above x*,  1 − x below, with
+            //    q1 = [−(N−1) − √((N−1)² + 4M/k)] / 2,
+            //    M = 2r/σ², N = 2(r−q)/σ², k = 1 − e^{−rτ}
+            //  and x* the root of value matching
+            //    1 − x = p_E(x) − (1 − e^{−qτ} Φ(−d1(x))) x / q1.
+
+            Real baw_exponent(Real tau) const
+            {
+                const Real v2 = sigma_ * sigma_;
+                const Real M = 2.0 * r_ / v2;
+                const Real N = 2.0 * (r_ - q_) / v2;
+                const Real k = -std::expm1(-r_ * tau);
+                return 0.5 * (-(N - 1.0) - std::sqrt((N - 1.0) * (N - 1.0) + 4.0 * M / k));
+            }
+
+            Real baw_boundary(Real tau) const
+            {
+                const Real v2 = sigma_ * sigma_;
+                const Real st = sigma_ * std::sqrt(tau);
+                const Real b = r_ - q_;
+                const Real M = 2.0 * r_ / v2;
+                const Real N = 2.0 * b / v2;
+                const Real q1 = baw_exponent(tau);
+                const Real dq = std::exp(-q_ * tau);
+                const Real dr = std::exp(-r_ * tau);
+
+                // Seed: the perpetual boundary blended towards the strike.
+                const Real q_inf = 0.5 * (-(N - 1.0) - std::sqrt((N - 1.0) * (N - 1.0) + 4.0 * M));
+                const Real x_inf = 1.0 / (1.0 - 1.0 / q_inf);
+                Real x = x_inf + (1.0 - x_inf) * std::exp((b * tau - 2.0 * st) / (1.0 - x_inf));
+
+                for (int it = 0; it < 100; ++it)
+                {
+                    const Real d1 = (std::log(x) + (b + 0.5 * v2) * tau) / st;
+                    const Real d2 = d1 - st;
+                    const Real Nd1 = dq * norm_cdf(-d1);
+                    const Real pe = dr * norm_cdf(-d2) - x * Nd1;
+                    const Real f = 1.0 - x - pe + (1.0 - Nd1) * x / q1;
+                    const Real df = -1.0 + Nd1 + (1.0 - Nd1) / q1 + dq * norm_pdf(d1) / (q1 * st);
+                    const Real next = std::clamp(x - f / df, 0.5 * x, 0.5 * (x + 1.0));
+                    if (std::abs(next - x) < 1e-14 * x)
+                        return next;
+                    x = next;
+                }
+                return x;
+            }
+
+            // ── ALO boundary ───────────────────────────────────────────────────
+
+            /// Clenshaw sum of Σ_k c_k T_k(z).
+            static Real chebyshev(const std::vector<Real> &c, Real z)
+            {
+                Real b1 = 0.0, b2 = 0.0;
+                for (std::size_t k = c.size() - 1; k >= 1; --k)
+                {
+                    const Real b0 = c[k] + 2.0 * z * b1 - b2;
+                    b2 = b1;
+                    b1 = b0;
+                }
+                return c[0] + z * b1 - b2;
+            }
+
+            /// ln B at z = 2√(τ/T) − 1 from the Chebyshev interpolant of H.
+            Real log_boundary_at(Real z) const
+            {
+                return log_X_ - std::sqrt(std::max(chebyshev(cheb_, z), 0.0));
+            }
+
+            /// ln B at z with its σ and rate tangents: ln B = ln X − √H.
+            Jet log_boundary_jet(Real z) const
+            {
+                const Real root = std::sqrt(std::max(chebyshev(cheb_, z), 0.0));
+                Jet lb = constant(log_X_ - root);
+                lb.r = dlog_X_rate_;
+                if (root > 0.0)
+                {
+                    lb.sig = -0.5 * chebyshev(cheb_sig_, z) / root;
+                    lb.r -= 0.5 * chebyshev(cheb_rate_, z) / root;
+                }
+                return lb;
+            }
+
+            Real boundary(Real tau) const
+            {
+                return std::exp(log_boundary_at(2.0 * std::sqrt(tau / T_) - 1.0));
+            }
+
+            /// Quadrature point of the integrals at one collocation node:
+            /// u = τ x, s = τ − u, with everything that does not depend on
+            /// the boundary folded in.
+            struct KernelPoint
+            {
+                Real u;   ///< boundary time of the point
+                Real ss;  ///< σ√s
+                Real iss; ///< 1/σ√s
+                Real ms;  ///< (r − q + σ²/2) s
+                Real er;  ///< weight · e^{ru}
+                Real eq;  ///< weight · e^{qu}
+            };
+
+            /// Work arrays for one node's integrals, sized to the rule.
+            struct Scratch
+            {
+                std::vector<Real> ep, em, a, b, c, d, e;
+                explicit Scratch(std::size_t n) : ep(n), em(n), a(n), b(n), c(n), d(n), e(n) {}
+            };
+
+            /// The FP-B residual R_i = ln c + ln N − ln D − g_i at each node
+            /// (g = ln B), its Jacobian in g through the interpolated ln B(u),
+            /// and −∂R/∂(σ, rate).
+            struct Linearisation
+            {
+                Eigen::VectorXd R;
+                Eigen::MatrixXd A;
+                Eigen::MatrixXd rhs; ///< columns: σ, rate
+                RowMatrix beta;      ///< row i: ∂R_i/∂H at the points, mapped to coefficients
+                Eigen::MatrixXd G;   ///< β C
+
+                explicit Linearisation(int n) : R(n), A(n, n), rhs(n, 2), beta(n, n + 1), G(n, n) {}
+            };
+
+            /// Linearises the collocated FP-B system at the boundary g, whose
+            /// interpolant gives ln B = L = ln X − √H at the quadrature points
+            /// (Ih = 1/√H there, 0 where H vanishes).
+            void linearise(const ALOGrid &grid, const std::vector<KernelPoint> &kernel,
+                           const std::vector<Real> &g, const Eigen::VectorXd &L,
+                           const Eigen::VectorXd &Ih, Linearisation &lin, Scratch &w) const
+            {
+                const int n = grid.n;
+                const std::size_t nq = grid.quad->x.size();
+                const Real mu = r_ - q_ + 0.5 * sigma_ * sigma_;
+
+                for (int i = 0; i < n; ++i)
+                {
+                    const Real tau = T_ * grid.node[i];
+                    const KernelPoint *kp = &kernel[i * nq];
+                    const Real *Lk = &L[i * nq];
+                    const Real sq = std::sqrt(tau);
+                    const Real st = sigma_ * sq;
+                    const Real dp = (g[i] + mu * tau) / st;
+                    const Real dm = dp - st;
+                    const Real pdp = norm_pdf(dp), pdm = norm_pdf(dm);
+
+                    for (std::size_t k = 0; k < nq; ++k)
+                    {
+                        w.ep[k] = (g[i] - Lk[k] + kp[k].ms) * kp[k].iss;
+                        w.em[k] = w.ep[k] - kp[k].ss;
+                    }
+                    norm_cdf(w.ep.data(), w.a.data(), nq);
+                    norm_cdf(w.em.data(), w.b.data(), nq);
+                    norm_pdf(w.ep.data(), w.c.data(), nq);
+                    norm_pdf(w.em.data(), w.d.data(), nq);
+
+                    // N = Φ(d₋) + r∫e^{ru}Φ(d₋),  D = Φ(d₊) + q∫e^{qu}Φ(d₊), and
+                    // their partials in ln B(τ), σ, r and q.  The sums are
+                    // kept free of divisions so that they vectorise.
+                    Real In = 0.0, Id = 0.0, Inu = 0.0, Idu = 0.0;
+                    Real Ing = 0.0, Idg = 0.0, Ins = 0.0, Ids = 0.0, Inv = 0.0, Idv = 0.0;
+                    for (std::size_t k = 0; k < nq; ++k)
+                    {
+                        const Real fr = kp[k].er * w.d[k], fq = kp[k].eq * w.c[k];
+                        In += kp[k].er * w.b[k];
+                        Id += kp[k].eq * w.a[k];
+                        Inu += kp[k].u * kp[k].er * w.b[k];
+                        Idu += kp[k].u * kp[k].eq * w.a[k];
+                        Ing += fr * kp[k].iss;
+                        Idg += fq * kp[k].iss;
+                        Ins += fr * w.ep[k];
+                        Ids += fq * (kp[k].ss - w.ep[k]);
+                        Inv += fr * kp[k].ss;
+                        Idv += fq * kp[k].ss;
+                    }
+                    const Real v2 = sigma_ * sigma_;
+                    const Real N = norm_cdf(dm) + r_ * In, D = norm_cdf(dp) + q_ * Id;
+                    const Real N_g = pdm / st + r_ * Ing, D_g = pdp / st + q_ * Idg;
+                    const Real N_s = -(pdm * dp + r_ * Ins) / sigma_;
+                    const Real D_s = pdp * (sq - dp / sigma_) + q_ * Ids / sigma_;
+                    const Real N_r = pdm * sq / sigma_ + r_ * Inv / v2 + In + r_ * Inu;
+                    const Real D_r = pdp * sq / sigma_ + q_ * Idv / v2;
+                    const Real N_q = -pdm * sq / sigma_ - r_ * Inv / v2;
+                    const Real D_q = -pdp * sq / sigma_ - q_ * Idv / v2 + Id + q_ * Idu;
+                    lin.R[i] = -(r_ - q_) * tau + std::log(N / D) - g[i];
+
+                    // ∂R/∂L_k = −(∂N/∂g)_k/N + (∂D/∂g)_k/D, spread on the
+                    // node values through L = ln X − √H, H = P C h:
+                    //   δL_k = δln X − (P_k C δh)/(2√H_k),  δh_j = 2 l_j (δg_j − δln X).
+                    const Real iN = r_ / N, iD = q_ / D;
+                    Real a_sum = 0.0;
+                    for (std::size_t k = 0; k < nq; ++k)
+                    {
+                        const Real a = (iD * kp[k].eq * w.c[k] - iN * kp[k].er * w.d[k]) * kp[k].iss;
+                        a_sum += a;
+                        w.e[k] = a * Ih[i * nq + k];
+                    }
+                    lin.beta.row(i).noalias() = Eigen::Map<const Eigen::RowVectorXd>(w.e.data(), nq) *
+                                                grid.P.middleRows(i * nq, nq);
+                    lin.A(i, i) = N_g / N - D_g / D - 1.0;
+
+                    const Real R_s = N_s / N - D_s / D;
+                    const Real R_r = rate_is_q_ ? tau + N_q / N - D_q / D
+                                                : -tau + N_r / N - D_r / D;
+                    lin.rhs(i, 0) = -R_s;
+                    lin.rhs(i, 1) = -R_r - dlog_X_rate_ * a_sum;
+                }
+
+                // Through the fit, ∂R_i/∂g_j = −(β_i C)_j l_j with l = g − ln X.
+                Eigen::VectorXd l(n);
+                for (int j = 0; j < n; ++j)
+                    l[j] = g[j] - log_X_;
+                lin.G.noalias() = lin.beta * grid.C.leftCols(n);
+                const Eigen::VectorXd diag = lin.A.diagonal();
+                lin.A.noalias() = -lin.G * l.asDiagonal();
+                lin.A.diagonal() += diag;
+                lin.rhs.col(1).noalias() -= dlog_X_rate_ * (lin.G * l);
+            }
+
+            /// Solves the FP-B fixed point B = c N/D on the collocation nodes
+            /// by Newton's method, from the Barone-Adesi–Whaley boundary.
+            /// The last Jacobian also gives the boundary's tangents: with
+            /// (∂R/∂g) δg = −∂R/∂θ, vega and rho need no re-solve.
+            void solve_boundary(const ALOSettings &cfg)
+            {
+                const ALOGrid &grid = *cfg.grid;
+                const int n = grid.n;
+                const UnitRule &quad = *grid.quad;
+                const std::size_t nq = quad.x.size();
+                const std::size_t np = static_cast<std::size_t>(n) * nq;
+                premium_quad_ = cfg.premium;
+                quad_points_ = nq;
+                iterations_ = cfg.iterations;
+
+                const Real mu = r_ - q_ + 0.5 * sigma_ * sigma_;
+                std::vector<KernelPoint> kernel(np);
+                for (int i = 0; i < n; ++i)
+                {
+                    const Real tau = T_ * grid.node[i];
+                    for (std::size_t k = 0; k < nq; ++k)
+                    {
+                        const Real u = tau * quad.x[k];
+                        const Real s = tau * quad.xc[k];
+                        const Real w = tau * quad.w[k];
+                        const Real ss = sigma_ * std::sqrt(s);
+                        kernel[i * nq + k] = {u, ss, 1.0 / ss, mu * s, w * std::exp(r_ * u),
+                                              w * std::exp(q_ * u)};
+                    }
+                }
+
+                std::vector<Real> g(n + 1);
+                Eigen::VectorXd h(n + 1), c(n + 1), L(np), Ih(np);
+                const auto fit = [&]
+                {
+                    for (int i = 0; i <= n; ++i)
+                        h[i] = (g[i] - log_X_) * (g[i] - log_X_);
+                    c.noalias() = grid.C * h;
+                    L.noalias() = grid.P * c;
+                    for (std::size_t k = 0; k < np; ++k)
+                    {
+                        const Real root = std::sqrt(std::max(L[k], 0.0));
+                        L[k] = log_X_ - root;
+                        Ih[k] = root > 0.0 ? 1.0 / root : 0.0;
+                    }
+                };
+
+                g[n] = log_X_;
+                for (int i = 0; i < n; ++i)
+                    g[i] = std::log(std::min(baw_boundary(T_ * grid.node[i]), X_));
+                fit();
+
+                // Newton converges quadratically from there (steps of about
+                // 1e-2, 1e-3, 1e-5, 1e-7), so a step below 1e-5 leaves ln B
+                // within about 1e-8, under the discretisation error, and its
+                // factorisation is still good enough for the tangents.
+                Linearisation lin(n);
+                Scratch work(nq);
+                Eigen::PartialPivLU<Eigen::MatrixXd> lu(n);
+                const Real floor = log_X_ + std::log(1e-12);
+                for (int it = 0; it < iterations_; ++it)
+                {
+                    linearise(grid, kernel, g, L, Ih, lin, work);
+                    lu.compute(lin.A);
+                    const Eigen::VectorXd step = lu.solve(lin.R);
+                    for (int i = 0; i < n; ++i)
+                        g[i] = std::clamp(g[i] - step[i], floor, log_X_);
+                    fit();
+                    steps_ = it + 1;
+                    if (step.cwiseAbs().maxCoeff() < 1e-5)
+                        break;
+                }
+                cheb_.assign(c.data(), c.data() + n + 1);
+
+                const Eigen::MatrixXd dg = lu.solve(lin.rhs);
+                Eigen::VectorXd dh_s = Eigen::VectorXd::Zero(n + 1), dh_r = Eigen::VectorXd::Zero(n + 1);
+                for (int j = 0; j < n; ++j)
+                {
+                    dh_s[j] = 2.0 * (g[j] - log_X_) * dg(j, 0);
+                    dh_r[j] = 2.0 * (g[j] - log_X_) * (dg(j, 1) - dlog_X_rate_);
+                }
+                const Eigen::VectorXd cs = grid.C * dh_s, cr = grid.C * dh_r;
+                cheb_sig_.assign(cs.data(), cs.data() + n + 1);
+                cheb_rate_.assign(cr.data(), cr.data() + n + 1);
+            }
+        };
+
+        UnitAmericanPut unit_put(Real r, Real q, Real sigma, Real T, bool is_call,
+                                 AmericanAnalyticScheme scheme)
+        {
+            return is_call ? UnitAmericanPut(q, r, sigma, T, scheme, true)
+                           : UnitAmericanPut(r, q, sigma, T, scheme, false);
+        }
+
+        /// American option value as a jet in spot (other inputs fixed).
+        Jet american_value(const UnitAmericanPut &p, const Jet &S, Real K, bool is_call)
+        {
+            return is_call ? S * p.value(K / S) : K * p.value(S / K);
+        }
+
+    } // anonymous namespace
+
+    // ─── validation ────────────────────────────────────────────────────────────
+
+    void BSAmericanAnalyticEngine::validate(const VanillaOption &opt)
+    {
+        if (!opt.payoff)
+            throw InvalidInput("VanillaOption: payoff is null");
+        if (!opt.exercise || opt.exercise->dates().empty())
+            throw InvalidInput("VanillaOption: exercise is null or has no dates");
+        if (opt.exercise->type() != ExerciseType::American)
+            throw UnsupportedInstrument("BSAmericanAnalyticEngine: use BSEuroVanillaAnalyticEngine for European exercise");
+        if (opt.exercise->dates().front() <= 0.0)
+            throw InvalidInput("VanillaOption: maturity must be > 0");
+        if (opt.notional == 0.0)
+            throw InvalidInput("VanillaOption: notional must be non-zero");
+        if (opt.payoff->strike() <= 0.0)
+            throw InvalidInput("VanillaOption: strike must be > 0");
+    }
+
+    // ─── pricing ───────────────────────────────────────────────────────────────
+
+    void BSAmericanAnalyticEngine::visit(const VanillaOption &opt)
+    {
+        validate(opt);
+        const auto &m = require_model<ILocalVolModel>("BSAmericanAnalyticEngine");
+
+        const Real S0 = m.spot0();
+        const Real r = m.rate_r();
+        const Real q = m.yield_q();
+        const Real sigma = m.vol_sigma();
+        const Real T = opt.exercise->dates().front();
+        const Real K = opt.payoff->strike();
+        const bool is_call = (opt.payoff->type() == OptionType::Call);
+
+        if (S0 <= 0.0)
+            throw InvalidInput("BSAmericanAnalyticEngine: spot must be > 0");
+        if (sigma <= 0.0)
+            throw InvalidInput("BSAmericanAnalyticEngine: volatility must be > 0");
+
+        const UnitAmericanPut p = unit_put(r, q, sigma, T, is_call, scheme_);
+        const Jet v = american_value(p, ad::spot_var(S0), K, is_call);
+
+        PricingResult out;
+        out.npv = opt.notional * v.v;
+        out.greeks.delta = opt.notional * v.s;
+        out.greeks.gamma = opt.notional * v.ss;
+
+        // Theta: in the continuation region the price solves the
+        // Black-Scholes PDE, so ∂V/∂t = rV − (r−q)SΔ − ½σ²S²Γ; in the
+        // exercise region it is intrinsic and does not decay.  Vega and rho
+        // come with the jet.  BAW only approximates the PDE and has no
+        // boundary tangents, so it is differenced instead.
+        Real theta = 0.0;
+        if (p.exact_greeks())
+        {
+            if (!p.exercised(is_call ? K / S0 : S0 / K))
+                theta = r * v.v - (r - q) * S0 * v.s - 0.5 * sigma * sigma * S0 * S0 * v.ss;
+            out.greeks.vega = opt.notional * v.sig;
+            out.greeks.rho = opt.notional * v.r;
+        }
+        else
+        {
+            const auto at = [&](Real r_, Real q_, Real sigma_, Real T_)
+            {
+                return american_value(unit_put(r_, q_, sigma_, T_, is_call, scheme_), constant(S0), K, is_call).v;
+            };
+            const Real h_sig = 1e-4;
+            const Real h_r = 1e-5;
+            const Real h_T = std::min(1e-4, 0.5 * T);
+            theta = -(at(r, q, sigma, T + h_T) - at(r, q, sigma, T - h_T)) / (2.0 * h_T);
+            out.greeks.vega = opt.notional * (at(r, q, sigma + h_sig, T) - at(r, q, sigma - h_sig, T)) / (2.0 * h_sig);
+            out.greeks.rho = opt.notional * (at(r + h_r, q, sigma, T) - at(r - h_r, q, sigma, T)) / (2.0 * h_r);
+        }
+        out.greeks.theta = opt.notional * theta;
+        out.mc_std_error = 0.0;
+        out.diagnostics = "American analytic (" + p.describe() + "): " + (is_call ? "call" : "put") +
+                          ", K=" + std::to_string(K) + ", T=" + std::to_string(T);
+        res_ = out;
+    }
+
+} // namespace quantModeling
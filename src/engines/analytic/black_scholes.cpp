@@ -9,22 +9,11 @@
 
 namespace quantModeling
 {
-    void BSEuroVanillaAnalyticEngine::visit(const VanillaOption &opt)
+    PricingResult bs_vanilla_analytic(OptionType type, Real S0, Real K, Real T,
+                                      Real r, Real q, Real v, Real notional)
     {
-        validate(opt);
-        const auto &m = require_model<ILocalVolModel>("BSEuroVanillaAnalyticEngine");
-        const Real S0 = m.spot0();
-        const Real r = m.rate_r();
-        const Real q = m.yield_q();
-        const Real v = m.vol_sigma();
-
-        const Real T = opt.exercise->dates().front();
-        const auto &payoff = *opt.payoff;
-        const OptionType type = payoff.type();
-        const Real K = payoff.strike();
-
         // Forward and discount factors
-        const Real df_r = m.discount_curve().discount(T);
+        const Real df_r = std::exp(-r * T);
         const Real df_q = std::exp(-q * T);
         const Real F = S0 * df_q / df_r; // forward under continuous carry
 
@@ -39,32 +28,43 @@ namespace quantModeling
 
         if (type == OptionType::Call)
         {
-            out.npv = opt.notional * (df_r * (F * norm_cdf(d1) - K * norm_cdf(d2)));
+            out.npv = notional * (df_r * (F * norm_cdf(d1) - K * norm_cdf(d2)));
             const Real Nd1 = norm_cdf(d1);
             const Real nd1 = norm_pdf(d1);
 
-            out.greeks.delta = opt.notional * (df_q * Nd1);
-            out.greeks.gamma = opt.notional * (df_q * nd1 / (S0 * stddev));
-            out.greeks.vega = opt.notional * (S0 * df_q * nd1 * std::sqrt(T));
-            out.greeks.rho = opt.notional * (T * K * df_r * norm_cdf(d2));
-            out.greeks.theta = opt.notional * (-(S0 * df_q * nd1 * v) / (2.0 * std::sqrt(T)) -
-                                               r * K * df_r * norm_cdf(d2) + q * S0 * df_q * Nd1);
+            out.greeks.delta = notional * (df_q * Nd1);
+            out.greeks.gamma = notional * (df_q * nd1 / (S0 * stddev));
+            out.greeks.vega = notional * (S0 * df_q * nd1 * std::sqrt(T));
+            out.greeks.rho = notional * (T * K * df_r * norm_cdf(d2));
+            out.greeks.theta = notional * (-(S0 * df_q * nd1 * v) / (2.0 * std::sqrt(T)) -
+                                           r * K * df_r * norm_cdf(d2) + q * S0 * df_q * Nd1);
         }
         else
         {
-            out.npv = opt.notional * (df_r * (K * norm_cdf(-d2) - F * norm_cdf(-d1)));
+            out.npv = notional * (df_r * (K * norm_cdf(-d2) - F * norm_cdf(-d1)));
             const Real Nmd1 = norm_cdf(-d1);
             const Real nd1 = norm_pdf(d1);
 
-            out.greeks.delta = opt.notional * (df_q * (norm_cdf(d1) - 1.0));
-            out.greeks.gamma = opt.notional * (df_q * nd1 / (S0 * stddev));
-            out.greeks.vega = opt.notional * (S0 * df_q * nd1 * std::sqrt(T));
-            out.greeks.rho = opt.notional * (-T * K * df_r * norm_cdf(-d2));
-            out.greeks.theta = opt.notional * (-(S0 * df_q * nd1 * v) / (2.0 * std::sqrt(T)) +
-                                               r * K * df_r * norm_cdf(-d2) - q * S0 * df_q * Nmd1);
+            out.greeks.delta = notional * (df_q * (norm_cdf(d1) - 1.0));
+            out.greeks.gamma = notional * (df_q * nd1 / (S0 * stddev));
+            out.greeks.vega = notional * (S0 * df_q * nd1 * std::sqrt(T));
+            out.greeks.rho = notional * (-T * K * df_r * norm_cdf(-d2));
+            out.greeks.theta = notional * (-(S0 * df_q * nd1 * v) / (2.0 * std::sqrt(T)) +
+                                           r * K * df_r * norm_cdf(-d2) - q * S0 * df_q * Nmd1);
         }
+        return out;
+    }
+
+    void BSEuroVanillaAnalyticEngine::visit(const VanillaOption &opt)
+    {
+        validate(opt);
+        const auto &m = require_model<ILocalVolModel>("BSEuroVanillaAnalyticEngine");
 
-        res_ = out;
+        // The model's curve is flat at r, so the kernel's e^{-rT} is its
+        // discount factor.
+        res_ = bs_vanilla_analytic(opt.payoff->type(), m.spot0(), opt.payoff->strike(),
+                                   opt.exercise->dates().front(), m.rate_r(), m.yield_q(),
+                                   m.vol_sigma(), opt.notional);
     }
 
     void BSEuroVanillaAnalyticEngine::visit(const AsianOption &)
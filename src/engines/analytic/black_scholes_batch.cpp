@@ -0,0 +1,130 @@
+#include "quantModeling/engines/analytic/black_scholes_batch.hpp"
+
+#include "quantModeling/utils/stats.hpp"
+#include "quantModeling/utils/vec_math.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+
+namespace quantModeling
+{
+
+    namespace
+    {
+
+        // Block size: 12 scratch arrays × 256 doubles = 24 KiB, fits in L1.
+        constexpr std::size_t kBlock = 256;
+
+        void validate(const BSBatchInputView &in, const BSBatchOutputView &out)
+        {
+            if (in.n == 0)
+                return;
+            if (!in.spot || !in.strike || !in.maturity || !in.rate ||
+                !in.dividend || !in.vol || !in.is_call)
+                throw InvalidInput("price_bs_batch: input array is null");
+            if (!out.npv)
+                throw InvalidInput("price_bs_batch: npv output array is null");
+
+            for (std::size_t i = 0; i < in.n; ++i)
+            {
+                if (!(in.spot[i] > 0.0))
+                    throw InvalidInput("price_bs_batch: option " + std::to_string(i) + ": spot must be > 0");
+                if (!(in.strike[i] > 0.0))
+                    throw InvalidInput("price_bs_batch: option " + std::to_string(i) + ": strike must be > 0");
+                if (!(in.maturity[i] > 0.0))
+                    throw InvalidInput("price_bs_batch: option " + std::to_string(i) + ": maturity must be > 0");
+                if (!(in.vol[i] > 0.0))
+                    throw InvalidInput("price_bs_batch: option " + std::to_string(i) + ": vol must be > 0");
+            }
+        }
+
+    } // anonymous namespace
+
+    void price_bs_batch(const BSBatchInputView &in, const BSBatchOutputView &out)
+    {
+        validate(in, out);
+
+        std::array<Real, kBlock> sqrt_t, df_r, df_q, stddev, fwd, d1, d2, omega;
+        std::array<Real, kBlock> cdf1, cdf2, pdf1, tmp;
+
+        for (std::size_t b = 0; b < in.n; b += kBlock)
+        {
+            const std::size_t m = std::min(kBlock, in.n - b);
+            const Real *S = in.spot + b;
+            const Real *K = in.strike + b;
+            const Real *T = in.maturity + b;
+            const Real *r = in.rate + b;
+            const Real *q = in.dividend + b;
+            const Real *v = in.vol + b;
+            const std::uint8_t *call = in.is_call + b;
+
+            // ── Discount factors and total volatility ───────────────────────
+            for (std::size_t i = 0; i < m; ++i)
+            {
+                sqrt_t[i] = std::sqrt(T[i]);
+                stddev[i] = v[i] * sqrt_t[i];
+                df_r[i] = -r[i] * T[i];
+                df_q[i] = -q[i] * T[i];
+                omega[i] = call[i] ? 1.0 : -1.0;
+            }
+            vec::exp(df_r.data(), df_r.data(), m);
+            vec::exp(df_q.data(), df_q.data(), m);
+
+            // ── Forward and log-moneyness ───────────────────────────────────
+            for (std::size_t i = 0; i < m; ++i)
+            {
+                fwd[i] = S[i] * df_q[i] / df_r[i];
+                tmp[i] = fwd[i] / K[i];
+            }
+            vec::log(tmp.data(), tmp.data(), m);
+
+            for (std::size_t i = 0; i < m; ++i)
+            {
+                d1[i] = tmp[i] / stddev[i] + 0.5 * stddev[i];
+                d2[i] = d1[i] - stddev[i];
+            }
+
+            // ── Normal CDF / PDF ────────────────────────────────────────────
+            norm_pdf(d1.data(), pdf1.data(), m);
+            for (std::size_t i = 0; i < m; ++i)
+            {
+                tmp[i] = omega[i] * d1[i];
+                d2[i] *= omega[i];
+            }
+            norm_cdf(tmp.data(), cdf1.data(), m);
+            norm_cdf(d2.data(), cdf2.data(), m);
+
+            // ── Price and Greeks ────────────────────────────────────────────
+            //  V     = ω df_r (F N(ωd1) − K N(ωd2))
+            //  Δ     = ω df_q N(ωd1)
+            //  Γ     = df_q n(d1) / (S σ√T)
+            //  vega  = S df_q n(d1) √T
+            //  θ     = −S df_q n(d1) σ / (2√T) − ω r K df_r N(ωd2) + ω q S df_q N(ωd1)
+            //  ρ     = ω T K df_r N(ωd2)
+
+            for (std::size_t i = 0; i < m; ++i)
+                out.npv[b + i] = omega[i] * df_r[i] * (fwd[i] * cdf1[i] - K[i] * cdf2[i]);
+
+            if (out.delta)
+                for (std::size_t i = 0; i < m; ++i)
+                    out.delta[b + i] = omega[i] * df_q[i] * cdf1[i];
+            if (out.gamma)
+                for (std::size_t i = 0; i < m; ++i)
+                    out.gamma[b + i] = df_q[i] * pdf1[i] / (S[i] * stddev[i]);
+            if (out.vega)
+                for (std::size_t i = 0; i < m; ++i)
+                    out.vega[b + i] = S[i] * df_q[i] * pdf1[i] * sqrt_t[i];
+            if (out.theta)
+                for (std::size_t i = 0; i < m; ++i)
+                    out.theta[b + i] = -(S[i] * df_q[i] * pdf1[i] * v[i]) / (2.0 * sqrt_t[i]) -
+                                       omega[i] * r[i] * K[i] * df_r[i] * cdf2[i] +
+                                       omega[i] * q[i] * S[i] * df_q[i] * cdf1[i];
+            if (out.rho)
+                for (std::size_t i = 0; i < m; ++i)
+                    out.rho[b + i] = omega[i] * T[i] * K[i] * df_r[i] * cdf2[i];
+        }
+    }
+
+} // namespace quantModeling
@@ -9,6 +9,39 @@
 namespace quantModeling
 {
 
+    PricingResult black76_option_analytic(bool is_call, Real F, Real K, Real T,
+                                          Real r, Real sigma, Real notional)
+    {
+        const Real df = std::exp(-r * T);
+
+        const Real sqrt_T = std::sqrt(T);
+        const Real d1 = (std::log(F / K) + 0.5 * sigma * sigma * T) / (sigma * sqrt_T);
+        const Real d2 = d1 - sigma * sqrt_T;
+
+        PricingResult out;
+        if (is_call)
+        {
+            out.npv = notional * df * (F * norm_cdf(d1) - K * norm_cdf(d2));
+        }
+        else
+        {
+            out.npv = notional * df * (K * norm_cdf(-d2) - F * norm_cdf(-d1));
+        }
+
+        // Greeks (Black '76 sensitivities)
+        out.greeks.delta = notional * df * (is_call ? norm_cdf(d1) : norm_cdf(d1) - 1.0);
+        out.greeks.gamma = notional * df * norm_pdf(d1) / (F * sigma * sqrt_T);
+        out.greeks.vega = notional * df * F * norm_pdf(d1) * sqrt_T;
+        out.greeks.theta = notional * (-df * F * norm_pdf(d1) * sigma / (2.0 * sqrt_T) -
+                                       r * out.npv / notional);
+        out.greeks.rho = -T * out.npv;
+
+        out.diagnostics = "CommodityAnalyticEngine:Black76 (F=" +
+                          std::to_string(F) + ", d1=" + std::to_string(d1) +
+                          ", d2=" + std::to_string(d2) + ")";
+        return out;
+    }
+
     // ─── Commodity Forward ───────────────────────────────────────────────────
 
     void CommodityAnalyticEngine::visit(const CommodityForward &fwd)
@@ -42,39 +75,10 @@ namespace quantModeling
         if (opt.strike <= 0.0)
             throw InvalidInput("CommodityOption: strike must be > 0");
 
-        const Real T = opt.maturity;
-        const Real K = opt.strike;
-        const Real F = m.forward(T);
-        const Real sigma = m.vol_sigma();
-        const Real r = m.rate();
-        const Real df = m.discount_curve().discount(T);
-
-        const Real sqrt_T = std::sqrt(T);
-        const Real d1 = (std::log(F / K) + 0.5 * sigma * sigma * T) / (sigma * sqrt_T);
-        const Real d2 = d1 - sigma * sqrt_T;
-
-        PricingResult out;
-        if (opt.is_call)
-        {
-            out.npv = opt.notional * df * (F * norm_cdf(d1) - K * norm_cdf(d2));
-        }
-        else
-        {
-            out.npv = opt.notional * df * (K * norm_cdf(-d2) - F * norm_cdf(-d1));
-        }
-
-        // Greeks (Black '76 sensitivities)
-        out.greeks.delta = opt.notional * df * (opt.is_call ? norm_cdf(d1) : norm_cdf(d1) - 1.0);
-        out.greeks.gamma = opt.notional * df * norm_pdf(d1) / (F * sigma * sqrt_T);
-        out.greeks.vega = opt.notional * df * F * norm_pdf(d1) * sqrt_T;
-        out.greeks.theta = opt.notional * (-df * F * norm_pdf(d1) * sigma / (2.0 * sqrt_T) -
-                                           r * out.npv / opt.notional);
-        out.greeks.rho = -T * out.npv;
-
-        out.diagnostics = "CommodityAnalyticEngine:Black76 (F=" +
-                          std::to_string(F) + ", d1=" + std::to_string(d1) +
-                          ", d2=" + std::to_string(d2) + ")";
-        res_ = out;
+        // CommodityBlackModel's curve is flat at rate(), so the kernel's
+        // e^{-rT} is its discount factor.
+        res_ = black76_option_analytic(opt.is_call, m.forward(opt.maturity), opt.strike,
+                                       opt.maturity, m.rate(), m.vol_sigma(), opt.notional);
     }
 
     // ─── rejections ──────────────────────────────────────────────────────────
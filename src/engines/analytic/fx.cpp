@@ -9,6 +9,43 @@
 namespace quantModeling
 {
 
+    PricingResult gk_fx_option_analytic(bool is_call, Real S0, Real K, Real T,
+                                        Real r_d, Real r_f, Real sigma, Real notional)
+    {
+        const Real sqrt_T = std::sqrt(T);
+        const Real d1 = (std::log(S0 / K) + (r_d - r_f + 0.5 * sigma * sigma) * T) /
+                        (sigma * sqrt_T);
+        const Real d2 = d1 - sigma * sqrt_T;
+
+        const Real df_d = std::exp(-r_d * T);
+        const Real df_f = std::exp(-r_f * T);
+
+        PricingResult out;
+        if (is_call)
+        {
+            out.npv = notional * (S0 * df_f * norm_cdf(d1) - K * df_d * norm_cdf(d2));
+        }
+        else
+        {
+            out.npv = notional * (K * df_d * norm_cdf(-d2) - S0 * df_f * norm_cdf(-d1));
+        }
+
+        // Greeks
+        out.greeks.delta = notional * df_f * (is_call ? norm_cdf(d1) : norm_cdf(d1) - 1.0);
+        out.greeks.gamma = notional * df_f * norm_pdf(d1) / (S0 * sigma * sqrt_T);
+        out.greeks.vega = notional * S0 * df_f * norm_pdf(d1) * sqrt_T;
+        out.greeks.theta = notional * (-(S0 * df_f * norm_pdf(d1) * sigma) / (2.0 * sqrt_T) +
+                                       (is_call
+                                            ? (r_f * S0 * df_f * norm_cdf(d1) - r_d * K * df_d * norm_cdf(d2))
+                                            : (-r_f * S0 * df_f * norm_cdf(-d1) + r_d * K * df_d * norm_cdf(-d2))));
+        out.greeks.rho = notional * K * T * df_d *
+                         (is_call ? norm_cdf(d2) : -norm_cdf(-d2));
+
+        out.diagnostics = "FXAnalyticEngine:GarmanKohlhagen (d1=" +
+                          std::to_string(d1) + ", d2=" + std::to_string(d2) + ")";
+        return out;
+    }
+
     // ─── FX Forward ──────────────────────────────────────────────────────────
 
     void FXAnalyticEngine::visit(const FXForward &fwd)
@@ -46,45 +83,10 @@ namespace quantModeling
         if (opt.strike <= 0.0)
             throw InvalidInput("FXOption: strike must be > 0");
 
-        const Real S0 = m.spot0();
-        const Real r_d = m.rate_r();
-        const Real r_f = m.yield_q();
-        const Real sigma = m.vol_sigma();
-        const Real T = opt.maturity;
-        const Real K = opt.strike;
-
-        const Real sqrt_T = std::sqrt(T);
-        const Real d1 = (std::log(S0 / K) + (r_d - r_f + 0.5 * sigma * sigma) * T) /
-                        (sigma * sqrt_T);
-        const Real d2 = d1 - sigma * sqrt_T;
-
-        const Real df_d = m.discount_curve().discount(T);
-        const Real df_f = std::exp(-r_f * T);
-
-        PricingResult out;
-        if (opt.is_call)
-        {
-            out.npv = opt.notional * (S0 * df_f * norm_cdf(d1) - K * df_d * norm_cdf(d2));
-        }
-        else
-        {
-            out.npv = opt.notional * (K * df_d * norm_cdf(-d2) - S0 * df_f * norm_cdf(-d1));
-        }
-
-        // Greeks
-        out.greeks.delta = opt.notional * df_f * (opt.is_call ? norm_cdf(d1) : norm_cdf(d1) - 1.0);
-        out.greeks.gamma = opt.notional * df_f * norm_pdf(d1) / (S0 * sigma * sqrt_T);
-        out.greeks.vega = opt.notional * S0 * df_f * norm_pdf(d1) * sqrt_T;
-        out.greeks.theta = opt.notional * (-(S0 * df_f * norm_pdf(d1) * sigma) / (2.0 * sqrt_T) +
-                                           (opt.is_call
-                                                ? (r_f * S0 * df_f * norm_cdf(d1) - r_d * K * df_d * norm_cdf(d2))
-                                                : (-r_f * S0 * df_f * norm_cdf(-d1) + r_d * K * df_d * norm_cdf(-d2))));
-        out.greeks.rho = opt.notional * K * T * df_d *
-                         (opt.is_call ? norm_cdf(d2) : -norm_cdf(-d2));
-
-        out.diagnostics = "FXAnalyticEngine:GarmanKohlhagen (d1=" +
-                          std::to_string(d1) + ", d2=" + std::to_string(d2) + ")";
-        res_ = out;
+        // Both supported models discount on a curve flat at r_d, so the
+        // kernel's e^{-r_d T} is the model's discount factor.
+        res_ = gk_fx_option_analytic(opt.is_call, m.spot0(), opt.strike, opt.maturity,
+                                     m.rate_r(), m.yield_q(), m.vol_sigma(), opt.notional);
     }
 
     // ─── rejections ──────────────────────────────────────────────────────────
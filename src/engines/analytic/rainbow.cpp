@@ -0,0 +1,298 @@
+#include "quantModeling/engines/analytic/rainbow.hpp"
+
+#include "quantModeling/models/equity/multi_asset_bs_model.hpp"
+#include "quantModeling/utils/jet.hpp"
+#include "quantModeling/utils/stats.hpp"
+
+#include <Eigen/Core>
+#include <array>
+#include <cmath>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace quantModeling
+{
+
+    // ─── helpers ────────────────────────────────────────────────────────
+    namespace
+    {
+        using ad::Jet;
+        using ad::constant;
+
+        constexpr Real kTwoPi = 6.28318530717958647693;
+
+        enum class RainbowType
+        {
+            WorstOf,
+            BestOf
+        };
+
+        Real bvn_density(Real a, Real b, Real r)
+        {
+            const Real s = 1.0 - r * r;
+            return std::exp(-0.5 * (a * a - 2.0 * r * a * b + b * b) / s) / (kTwoPi * std::sqrt(s));
+        }
+
+        // f(x) + Σ g_k (x_k − x_k.v): the jet of a function known by value and
+        // gradient.  No rainbow input depends on spot, so ∂²/∂S² needs no
+        // cross terms.
+        Jet from_gradient(Real f, std::initializer_list<std::pair<Real, const Jet *>> grad)
+        {
+            Jet out = constant(f);
+            for (const auto &[g, x] : grad)
+                out = out + g * (*x - x->v);
+            return out;
+        }
+
+        /// P(Z_k ≤ b_k, k < m) for m ≤ 3 standard normals with correlations r.
+        struct Orthant
+        {
+            int m = 0;
+            std::array<Jet, 3> b;
+            std::array<std::array<Jet, 3>, 3> r;
+        };
+
+        Jet mvn_cdf(const Orthant &o)
+        {
+            if (o.m == 1)
+                return ncdf(o.b[0]);
+
+            if (o.m == 2)
+            {
+                const Real a = o.b[0].v, b = o.b[1].v, r = o.r[0][1].v;
+                const Real s = std::sqrt(1.0 - r * r);
+                return from_gradient(bivariate_norm_cdf(a, b, r),
+                                     {{norm_pdf(a) * norm_cdf((b - r * a) / s), &o.b[0]},
+                                      {norm_pdf(b) * norm_cdf((a - r * b) / s), &o.b[1]},
+                                      {bvn_density(a, b, r), &o.r[0][1]}});
+            }
+
+            // Trivariate: ∂/∂b_k = φ(b_k) N2(conditional on Z_k = b_k),
+            //             ∂/∂r_ij = φ2(b_i, b_j; r_ij) Φ(Z_k | Z_i = b_i, Z_j = b_j).
+            const Real b[3] = {o.b[0].v, o.b[1].v, o.b[2].v};
+            const auto rv = [&](int i, int j)
+            { return o.r[i][j].v; };
+            const Real det = 1.0 - rv(0, 1) * rv(0, 1) - rv(0, 2) * rv(0, 2) - rv(1, 2) * rv(1, 2) +
+                             2.0 * rv(0, 1) * rv(0, 2) * rv(1, 2);
+
+            Real gb[3], gr[3];
+            for (int k = 0; k < 3; ++k)
+            {
+                const int i = (k + 1) % 3, j = (k + 2) % 3;
+                const Real si = std::sqrt(1.0 - rv(k, i) * rv(k, i));
+                const Real sj = std::sqrt(1.0 - rv(k, j) * rv(k, j));
+                gb[k] = norm_pdf(b[k]) * bivariate_norm_cdf((b[i] - rv(k, i) * b[k]) / si,
+                                                            (b[j] - rv(k, j) * b[k]) / sj,
+                                                            (rv(i, j) - rv(k, i) * rv(k, j)) / (si * sj));
+
+                // pair (i, j), conditioning variable k
+                const Real u = 1.0 - rv(i, j) * rv(i, j);
+                const Real mu = ((rv(i, k) - rv(i, j) * rv(j, k)) * b[i] +
+                                 (rv(j, k) - rv(i, j) * rv(i, k)) * b[j]) /
+                                u;
+                gr[k] = bvn_density(b[i], b[j], rv(i, j)) * norm_cdf((b[k] - mu) / std::sqrt(det / u));
+            }
+            return from_gradient(trivariate_norm_cdf(b[0], b[1], b[2], rv(0, 1), rv(0, 2), rv(1, 2)),
+                                 {{gb[0], &o.b[0]}, {gb[1], &o.b[1]}, {gb[2], &o.b[2]},
+                                  {gr[0], &o.r[1][2]}, {gr[1], &o.r[2][0]}, {gr[2], &o.r[0][1]}});
+        }
+
+        struct RainbowMarket
+        {
+            std::vector<Jet> lnF; ///< ln F_i = (r − q_i) T
+            std::vector<Jet> s;   ///< σ_i √T
+            Eigen::MatrixXd rho;
+        };
+
+        /// P(Σ_a c_ka ln X_a > θ_k for every row k) when E[ln X_a] = mean[a].
+        Jet prob_all_above(const RainbowMarket &mk, const std::vector<Jet> &mean,
+                           const std::vector<std::vector<Real>> &c, const std::vector<Jet> &theta)
+        {
+            const int n = static_cast<int>(mk.s.size());
+            const int m = static_cast<int>(c.size());
+            const auto cov = [&](const std::vector<Real> &x, const std::vector<Real> &y)
+            {
+                Jet v = constant(0.0);
+                for (int a = 0; a < n; ++a)
+                    for (int b = 0; b < n; ++b)
+                        if (x[a] != 0.0 && y[b] != 0.0)
+                            v = v + (x[a] * y[b] * mk.rho(a, b)) * mk.s[a] * mk.s[b];
+                return v;
+            };
+
+            Orthant o;
+            o.m = m;
+            std::array<Jet, 3> sd;
+            for (int k = 0; k < m; ++k)
+            {
+                Jet mu = constant(0.0);
+                for (int a = 0; a < n; ++a)
+                    if (c[k][a] != 0.0)
+                        mu = mu + c[k][a] * mean[a];
+                sd[k] = sqrt(cov(c[k], c[k]));
+                o.b[k] = (mu - theta[k]) / sd[k];
+            }
+            for (int k = 0; k < m; ++k)
+                for (int l = k + 1; l < m; ++l)
+                    o.r[k][l] = o.r[l][k] = cov(c[k], c[l]) / (sd[k] * sd[l]);
+            return mvn_cdf(o);
+        }
+
+        /// Undiscounted E[(X_ext − K)⁺]; K == 0 gives E[X_ext].
+        Jet extreme_call(const RainbowMarket &mk, Real K, RainbowType rainbow)
+        {
+            const int n = static_cast<int>(mk.s.size());
+            const bool best = (rainbow == RainbowType::BestOf);
+            const Jet lnK = constant(K > 0.0 ? std::log(K) : 0.0);
+
+            Jet value = constant(0.0);
+            for (int i = 0; i < n; ++i)
+            {
+                // Under Q_i (asset i as numéraire): E[ln X_a] = ln F_a − s_a²/2 + ρ_ia s_i s_a.
+                std::vector<Jet> mean(n);
+                for (int a = 0; a < n; ++a)
+                    mean[a] = mk.lnF[a] - 0.5 * mk.s[a] * mk.s[a] + mk.rho(i, a) * mk.s[i] * mk.s[a];
+
+                std::vector<std::vector<Real>> c;
+                std::vector<Jet> theta;
+                if (K > 0.0)
+                {
+                    c.emplace_back(n, 0.0);
+                    c.back()[i] = 1.0; // X_i > K
+                    theta.push_back(lnK);
+                }
+                for (int j = 0; j < n; ++j)
+                {
+                    if (j == i)
+                        continue;
+                    c.emplace_back(n, 0.0); // best: X_i > X_j, worst: X_j > X_i
+                    c.back()[i] = best ? 1.0 : -1.0;
+                    c.back()[j] = best ? -1.0 : 1.0;
+                    theta.push_back(constant(0.0));
+                }
+                value = value + exp(mk.lnF[i]) * prob_all_above(mk, mean, c, theta);
+            }
+            if (K <= 0.0)
+                return value;
+
+            // Strike leg under Q: best → 1 − P(all X_a ≤ K), worst → P(all X_a > K).
+            std::vector<Jet> mean(n);
+            for (int a = 0; a < n; ++a)
+                mean[a] = mk.lnF[a] - 0.5 * mk.s[a] * mk.s[a];
+            std::vector<std::vector<Real>> c(n, std::vector<Real>(n, 0.0));
+            std::vector<Jet> theta(n, best ? -lnK : lnK);
+            for (int a = 0; a < n; ++a)
+                c[a][a] = best ? -1.0 : 1.0;
+            const Jet p = prob_all_above(mk, mean, c, theta);
+            return value - K * (best ? 1.0 - p : p);
+        }
+
+        Jet rainbow_value(const MultiAssetBSModel &m, const Eigen::MatrixXd &rho,
+                          const std::vector<Jet> &sig, const Jet &r, const Jet &T,
+                          Real K, bool is_call, RainbowType rainbow)
+        {
+            const int n = m.n_assets();
+            RainbowMarket mk{std::vector<Jet>(n), std::vector<Jet>(n), rho};
+            const Jet sqrt_T = sqrt(T);
+            for (int a = 0; a < n; ++a)
+            {
+                mk.lnF[a] = (r - m.dividends[a]) * T;
+                mk.s[a] = sig[a] * sqrt_T;
+            }
+
+            const Jet call = extreme_call(mk, K, rainbow);
+            const Jet undiscounted = is_call ? call : call - extreme_call(mk, 0.0, rainbow) + K;
+            return exp(-(r * T)) * undiscounted;
+        }
+
+        PricingResult price_rainbow(const MultiAssetBSModel &m, Time maturity, Real strike,
+                                    bool is_call, Real notional, RainbowType rainbow)
+        {
+            const int n = m.n_assets();
+            if (n < 2 || n > 3)
+                throw UnsupportedInstrument("RainbowAnalyticEngine: closed form needs 2 or 3 assets "
+                                            "(use RainbowMCEngine)");
+            if (maturity <= 0.0)
+                throw InvalidInput("Rainbow option: maturity must be > 0");
+            if (strike <= 0.0)
+                throw InvalidInput("Rainbow option: strike must be > 0");
+            if (notional == 0.0)
+                throw InvalidInput("Rainbow option: notional must be non-zero");
+            for (int a = 0; a < n; ++a)
+                if (m.vols[a] <= 0.0)
+                    throw InvalidInput("RainbowAnalyticEngine: volatilities must be > 0");
+
+            const Eigen::MatrixXd rho = m.chol * m.chol.transpose();
+
+            // Parallel pass: every vol shifted by the same θ.
+            const Jet shift = ad::vol_var(0.0);
+            std::vector<Jet> sig(n);
+            for (int a = 0; a < n; ++a)
+                sig[a] = m.vols[a] + shift;
+            const Jet total = rainbow_value(m, rho, sig, ad::rate_var(m.rate_r), ad::time_var(maturity),
+                                            strike, is_call, rainbow);
+
+            // Per-asset vegas.
+            PricingResult out;
+            out.greeks.delta_per_asset.assign(n, 0.0);
+            out.greeks.gamma_per_asset.assign(n, 0.0);
+            out.greeks.vega_per_asset.resize(n);
+            for (int a = 0; a < n; ++a)
+            {
+                for (int b = 0; b < n; ++b)
+                    sig[b] = constant(m.vols[b]);
+                sig[a] = ad::vol_var(m.vols[a]);
+                const Jet va = rainbow_value(m, rho, sig, constant(m.rate_r), constant(maturity),
+                                             strike, is_call, rainbow);
+                out.greeks.vega_per_asset[a] = notional * va.sig;
+            }
+
+            out.npv = notional * total.v;
+            out.mc_std_error = 0.0;
+            out.greeks.delta = 0.0;
+            out.greeks.gamma = 0.0;
+            out.greeks.vega = notional * total.sig;
+            out.greeks.rho = notional * total.r;
+            out.greeks.theta = -notional * total.t;
+
+            const char *type_str = (rainbow == RainbowType::WorstOf)
+                                       ? "WorstOf"
+                                       : "BestOf";
+            out.diagnostics = std::string("RainbowAnalyticEngine:") + type_str +
+                              (n == 2 ? " (Stulz" : " (Johnson") +
+                              ", assets=" + std::to_string(n) + ")";
+            return out;
+        }
+    } // anonymous namespace
+
+    // ─── Worst-of visit ─────────────────────────────────────────────────
+
+    void RainbowAnalyticEngine::visit(const WorstOfOption &opt)
+    {
+        const auto &m = require_model<MultiAssetBSModel>("RainbowAnalyticEngine");
+        res_ = price_rainbow(m, opt.maturity, opt.strike, opt.is_call, opt.notional,
+                             RainbowType::WorstOf);
+    }
+
+    // ─── Best-of visit ──────────────────────────────────────────────────
+
+    void RainbowAnalyticEngine::visit(const BestOfOption &opt)
+    {
+        const auto &m = require_model<MultiAssetBSModel>("RainbowAnalyticEngine");
+        res_ = price_rainbow(m, opt.maturity, opt.strike, opt.is_call, opt.notional,
+                             RainbowType::BestOf);
+    }
+
+    // ─── rejections ─────────────────────────────────────────────────────
+
+    void RainbowAnalyticEngine::visit(const VanillaOption &) { unsupported("VanillaOption"); }
+    void RainbowAnalyticEngine::visit(const AsianOption &) { unsupported("AsianOption"); }
+    void RainbowAnalyticEngine::visit(const BarrierOption &) { unsupported("BarrierOption"); }
+    void RainbowAnalyticEngine::visit(const DigitalOption &) { unsupported("DigitalOption"); }
+    void RainbowAnalyticEngine::visit(const EquityFuture &) { unsupported("EquityFuture"); }
+    void RainbowAnalyticEngine::visit(const ZeroCouponBond &) { unsupported("ZeroCouponBond"); }
+    void RainbowAnalyticEngine::visit(const FixedRateBond &) { unsupported("FixedRateBond"); }
+
+} // namespace quantModeling
@@ -1,6 +1,7 @@
 #include "quantModeling/engines/analytic/short_rate.hpp"
 
 #include "quantModeling/models/rates/short_rate_model.hpp"
+#include "quantModeling/utils/stats.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -8,6 +9,165 @@
 namespace quantModeling
 {
 
+    // ── Jamshidian decomposition ─────────────────────────────────────────────
+    //
+    //  f(r) = Σ c_i P(T, t_i | r) − K is strictly decreasing in r for any
+    //  affine model with B(τ) > 0.  Bracket r* by doubling outward from r0,
+    //  then refine with Illinois false position.
+
+    Real jamshidian_coupon_bond_option(const IShortRateModel &m, bool is_call, Real K,
+                                       Time T_option,
+                                       const std::vector<Time> &times,
+                                       const std::vector<Real> &amounts)
+    {
+        if (T_option <= 0.0)
+            throw InvalidInput("jamshidian_coupon_bond_option: T_option must be > 0");
+        if (K <= 0.0)
+            throw InvalidInput("jamshidian_coupon_bond_option: strike K must be > 0");
+        if (times.empty() || times.size() != amounts.size())
+            throw InvalidInput("jamshidian_coupon_bond_option: need matching, non-empty cash flows");
+        for (std::size_t i = 0; i < times.size(); ++i)
+        {
+            if (times[i] <= T_option)
+                throw InvalidInput("jamshidian_coupon_bond_option: cash flows must be after T_option");
+            if (amounts[i] <= 0.0)
+                throw InvalidInput("jamshidian_coupon_bond_option: cash-flow amounts must be > 0");
+        }
+
+        // Single cash flow: plain ZCB option on c·P(T, t) with strike K.
+        if (times.size() == 1)
+            return amounts[0] * m.bond_option_price(is_call, K / amounts[0], T_option, times[0]);
+
+        auto f = [&](Real r)
+        {
+            Real v = -K;
+            for (std::size_t i = 0; i < times.size(); ++i)
+                v += amounts[i] * m.zcb_price(T_option, times[i], r);
+            return v;
+        };
+
+        Real lo = m.r0() - 0.05, hi = m.r0() + 0.05;
+        Real f_lo = f(lo), f_hi = f(hi);
+        for (int k = 0; f_lo < 0.0 && k < 60; ++k)
+        {
+            lo -= (hi - lo);
+            f_lo = f(lo);
+        }
+        for (int k = 0; f_hi > 0.0 && k < 60; ++k)
+        {
+            hi += (hi - lo);
+            f_hi = f(hi);
+        }
+        if (f_lo < 0.0 || f_hi > 0.0)
+            throw InvalidInput("jamshidian_coupon_bond_option: could not bracket critical rate");
+
+        Real r_star = lo;
+        int side = 0;
+        for (int it = 0; it < 200; ++it)
+        {
+            r_star = (lo * f_hi - hi * f_lo) / (f_hi - f_lo);
+            const Real f_star = f(r_star);
+            if (std::abs(f_star) <= 1e-15 * K || (hi - lo) <= 1e-15)
+                break;
+            if (f_star > 0.0)
+            {
+                lo = r_star;
+                f_lo = f_star;
+                if (side == 1)
+                    f_hi *= 0.5;
+                side = 1;
+            }
+            else
+            {
+                hi = r_star;
+                f_hi = f_star;
+                if (side == -1)
+                    f_lo *= 0.5;
+                side = -1;
+            }
+        }
+
+        Real total = 0.0;
+        for (std::size_t i = 0; i < times.size(); ++i)
+        {
+            const Real K_i = m.zcb_price(T_option, times[i], r_star);
+            total += amounts[i] * m.bond_option_price(is_call, K_i, T_option, times[i]);
+        }
+        return total;
+    }
+
+    // ── Caplet strip ─────────────────────────────────────────────────────────
+    //
+    //  Caplet_i   = factor_i · (G_i N(−d2) − F_i N(−d1))
+    //  Floorlet_i = factor_i · (F_i N(d1) − G_i N(d2))
+    //  with F_i = P(0, T_{i+1}), G_i = K_p,i P(0, T_i), K_p,i = 1 / factor_i,
+    //  d1 = ln(F/G)/σ_p + σ_p/2, d2 = d1 − σ_p.
+
+    std::vector<Real> price_caplet_strip(const IShortRateModel &m,
+                                         const std::vector<Time> &schedule,
+                                         Real strike, bool is_cap)
+    {
+        if (schedule.size() < 2)
+            throw InvalidInput("price_caplet_strip: schedule needs ≥ 2 dates");
+
+        const std::size_t n = schedule.size() - 1;
+        for (std::size_t i = 0; i < n; ++i)
+            if (schedule[i + 1] <= schedule[i])
+                throw InvalidInput("price_caplet_strip: schedule dates must be increasing");
+
+        std::vector<Real> out(n, 0.0);
+
+        // First live period; everything before it has already fixed.
+        std::size_t first = 0;
+        while (first < n && schedule[first] <= 0.0)
+            ++first;
+        if (first == n)
+            return out;
+
+        if (!m.bond_option_vol(schedule[first], schedule[first + 1]))
+        {
+            for (std::size_t i = first; i < n; ++i)
+            {
+                const Real factor = 1.0 + strike * (schedule[i + 1] - schedule[i]);
+                out[i] = factor * m.bond_option_price(!is_cap, 1.0 / factor,
+                                                      schedule[i], schedule[i + 1]);
+            }
+            return out;
+        }
+
+        const std::size_t live = n - first;
+        std::vector<Real> P(live + 1), factor(live), d1(live), d2(live);
+
+        for (std::size_t j = 0; j <= live; ++j)
+            P[j] = m.zcb_price(schedule[first + j]);
+
+        for (std::size_t j = 0; j < live; ++j)
+        {
+            const Time Ti = schedule[first + j];
+            const Time Ti1 = schedule[first + j + 1];
+            factor[j] = 1.0 + strike * (Ti1 - Ti);
+            const Real sigma_p = *m.bond_option_vol(Ti, Ti1);
+            d1[j] = std::log(P[j + 1] * factor[j] / P[j]) / sigma_p + 0.5 * sigma_p;
+            d2[j] = d1[j] - sigma_p;
+        }
+
+        const Real sgn = is_cap ? -1.0 : 1.0;
+        for (std::size_t j = 0; j < live; ++j)
+        {
+            d1[j] = norm_cdf(sgn * d1[j]);
+            d2[j] = norm_cdf(sgn * d2[j]);
+        }
+
+        for (std::size_t j = 0; j < live; ++j)
+        {
+            const Real F = P[j + 1];
+            const Real G = P[j] / factor[j];
+            out[first + j] = is_cap ? factor[j] * (G * d2[j] - F * d1[j])
+                                    : factor[j] * (F * d1[j] - G * d2[j]);
+        }
+        return out;
+    }
+
     // ── ZeroCouponBond ───────────────────────────────────────────────────────
 
     void ShortRateAnalyticEngine::visit(const ZeroCouponBond &bond)
@@ -102,8 +262,22 @@ namespace quantModeling
 
         // Delegates to model's analytic formula (Vasicek, Hull-White).
         // CIRModel::bond_option_price() throws UnsupportedInstrument — use MC.
-        const Real unit_price = m.bond_option_price(
-            opt.is_call, opt.strike, opt.option_maturity, opt.bond_maturity);
+        Real unit_price = 0.0;
+        if (opt.coupon_rate == 0.0)
+        {
+            unit_price = m.bond_option_price(
+                opt.is_call, opt.strike, opt.option_maturity, opt.bond_maturity);
+        }
+        else
+        {
+            std::vector<Time> times;
+            std::vector<Real> amounts;
+            opt.cash_flows_after_expiry(times, amounts);
+            if (times.empty())
+                throw InvalidInput("ShortRateAnalyticEngine: no bond cash flows after option expiry");
+            unit_price = jamshidian_coupon_bond_option(
+                m, opt.is_call, opt.strike, opt.option_maturity, times, amounts);
+        }
 
         PricingResult out;
         out.npv = opt.notional * unit_price;
@@ -125,29 +299,8 @@ namespace quantModeling
             throw InvalidInput("ShortRateAnalyticEngine: CapFloor schedule needs ≥ 2 dates");
 
         Real total = 0.0;
-        const auto n = cf.schedule.size() - 1;
-
-        for (std::size_t i = 0; i < n; ++i)
-        {
-            const Real Ti = cf.schedule[i];
-            const Real Ti1 = cf.schedule[i + 1];
-            const Real delta = Ti1 - Ti;
-            if (delta <= 0.0)
-                throw InvalidInput("ShortRateAnalyticEngine: schedule dates must be increasing");
-
-            // Skip caplets where option expiry ≤ 0 (already expired)
-            if (Ti <= 0.0)
-                continue;
-
-            const Real K_delta = cf.strike * delta;
-            const Real factor = 1.0 + K_delta;
-            const Real K_p = 1.0 / factor;
-
-            // Caplet = factor × Put; Floorlet = factor × Call
-            const bool bond_opt_is_call = !cf.is_cap;
-            const Real bo = m.bond_option_price(bond_opt_is_call, K_p, Ti, Ti1);
-            total += factor * bo;
-        }
+        for (Real caplet : price_caplet_strip(m, cf.schedule, cf.strike, cf.is_cap))
+            total += caplet;
 
         PricingResult out;
         out.npv = cf.notional * total;
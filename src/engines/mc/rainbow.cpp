@@ -1,5 +1,6 @@
 #include "quantModeling/engines/mc/rainbow.hpp"
 
+#include "quantModeling/market/discount_curve.hpp"
 #include "quantModeling/models/equity/multi_asset_bs_model.hpp"
 #include "quantModeling/utils/rng.hpp"
 
@@ -22,26 +23,32 @@ namespace quantModeling
             BestOf
         };
 
-        PricingResult price_rainbow(const MultiAssetBSModel &m,
-                                    const PricingSettings &settings,
+        // Settings as the engine reads them: non-positive means default.
+        int resolve_paths(int mc_paths) { return mc_paths > 0 ? mc_paths : 100000; }
+        uint64_t resolve_seed(int mc_seed) { return static_cast<uint64_t>(mc_seed > 0 ? mc_seed : 42); }
+
+        // Path p's correlated normals: its own PCG stream, correlated by L.
+        void draw_path(const Eigen::MatrixXd &L, const RngFactory &rng_fact, int p,
+                       Eigen::VectorXd &u, Eigen::VectorXd &z)
+        {
+            Pcg32 rng = rng_fact.make(static_cast<uint64_t>(p));
+            NormalBoxMuller normal;
+            for (Eigen::Index i = 0; i < u.size(); ++i)
+                u(i) = normal(rng);
+            z.noalias() = L * u;
+        }
+
+        // The estimator, for any source of per-path correlated normals.
+        template <class Draw>
+        PricingResult price_rainbow(Real r, const std::vector<Real> &spots,
+                                    const std::vector<Real> &vols,
+                                    const std::vector<Real> &dividends, int n_paths,
                                     Time maturity, Real strike, bool is_call,
-                                    Real notional, RainbowType rainbow)
+                                    Real notional, RainbowType rainbow, Draw &&draw)
         {
-            const auto n = static_cast<std::size_t>(m.n_assets());
-            if (n < 2)
-                throw InvalidInput("Rainbow option: need at least 2 assets");
-            if (maturity <= 0.0)
-                throw InvalidInput("Rainbow option: maturity must be > 0");
-            if (notional == 0.0)
-                throw InvalidInput("Rainbow option: notional must be non-zero");
-
-            const int n_paths = settings.mc_paths > 0 ? settings.mc_paths : 100000;
-            const auto seed = static_cast<uint64_t>(
-                settings.mc_seed > 0 ? settings.mc_seed : 42);
-
-            const Real r = m.rate_r;
+            const auto n = spots.size();
             const Real T = maturity;
-            const Real df = m.discount_curve().discount(T);
+            const Real df = DiscountCurve(r).discount(T);
 
             // Pre-compute drift and vol for each asset for time T
             struct AssetSpec
@@ -54,29 +61,20 @@ namespace quantModeling
             const Real sqrt_T = std::sqrt(T);
             for (std::size_t i = 0; i < n; ++i)
             {
-                const Real sig = m.vols[i];
-                specs[i].drift = (r - m.dividends[i] - 0.5 * sig * sig) * T;
+                const Real sig = vols[i];
+                specs[i].drift = (r - dividends[i] - 0.5 * sig * sig) * T;
                 specs[i].vol = sig * sqrt_T;
-                specs[i].S0 = m.spots[i];
+                specs[i].S0 = spots[i];
             }
 
-            const Eigen::MatrixXd &L = m.chol;
-
-            RngFactory rng_fact(seed);
             Real sum = 0.0, sum2 = 0.0;
 
-            Eigen::VectorXd u(static_cast<Eigen::Index>(n));
             Eigen::VectorXd z(static_cast<Eigen::Index>(n));
 
             for (int p = 0; p < n_paths; ++p)
             {
-                Pcg32 rng = rng_fact.make(static_cast<uint64_t>(p));
-                NormalBoxMuller normal;
-
                 // Draw correlated normals
-                for (std::size_t i = 0; i < n; ++i)
-                    u(static_cast<Eigen::Index>(i)) = normal(rng);
-                z.noalias() = L * u;
+                draw(p, z);
 
                 // Compute terminal performances
                 Real extremal_perf;
@@ -126,15 +124,82 @@ namespace quantModeling
                               ", assets=" + std::to_string(n) + ")";
             return out;
         }
+
+        template <class Option>
+        PricingResult rainbow_on_draws(const Option &opt, RainbowType rainbow, Real r,
+                                       const std::vector<Real> &spots,
+                                       const std::vector<Real> &vols,
+                                       const std::vector<Real> &dividends,
+                                       const Eigen::MatrixXd &z)
+        {
+            return price_rainbow(r, spots, vols, dividends, static_cast<int>(z.cols()),
+                                 opt.maturity, opt.strike, opt.is_call, opt.notional, rainbow,
+                                 [&](int p, Eigen::VectorXd &zp)
+                                 { zp = z.col(p); });
+        }
+
+        template <class Option>
+        PricingResult rainbow_streamed(const Option &opt, RainbowType rainbow,
+                                       const MultiAssetBSModel &m,
+                                       const PricingSettings &settings)
+        {
+            RainbowMCEngine::validate(opt.maturity, opt.notional, m.n_assets());
+            const RngFactory rng_fact(resolve_seed(settings.mc_seed));
+            Eigen::VectorXd u(m.n_assets());
+            return price_rainbow(m.rate_r, m.spots, m.vols, m.dividends,
+                                 resolve_paths(settings.mc_paths), opt.maturity, opt.strike,
+                                 opt.is_call, opt.notional, rainbow,
+                                 [&](int p, Eigen::VectorXd &z)
+                                 { draw_path(m.chol, rng_fact, p, u, z); });
+        }
     } // anonymous namespace
 
+    // ─── public pieces ──────────────────────────────────────────────────
+
+    void RainbowMCEngine::validate(Time maturity, Real notional, int n_assets)
+    {
+        if (n_assets < 2)
+            throw InvalidInput("Rainbow option: need at least 2 assets");
+        if (maturity <= 0.0)
+            throw InvalidInput("Rainbow option: maturity must be > 0");
+        if (notional == 0.0)
+            throw InvalidInput("Rainbow option: notional must be non-zero");
+    }
+
+    Eigen::MatrixXd rainbow_mc_draws(const Eigen::MatrixXd &chol, int mc_paths, int mc_seed)
+    {
+        const int n_paths = resolve_paths(mc_paths);
+        const RngFactory rng_fact(resolve_seed(mc_seed));
+        Eigen::MatrixXd draws(chol.rows(), n_paths);
+        Eigen::VectorXd u(chol.rows()), z(chol.rows());
+        for (int p = 0; p < n_paths; ++p)
+        {
+            draw_path(chol, rng_fact, p, u, z);
+            draws.col(p) = z;
+        }
+        return draws;
+    }
+
+    PricingResult rainbow_mc(const WorstOfOption &opt, Real r, const std::vector<Real> &spots,
+                             const std::vector<Real> &vols, const std::vector<Real> &dividends,
+                             const Eigen::MatrixXd &z)
+    {
+        return rainbow_on_draws(opt, RainbowType::WorstOf, r, spots, vols, dividends, z);
+    }
+
+    PricingResult rainbow_mc(const BestOfOption &opt, Real r, const std::vector<Real> &spots,
+                             const std::vector<Real> &vols, const std::vector<Real> &dividends,
+                             const Eigen::MatrixXd &z)
+    {
+        return rainbow_on_draws(opt, RainbowType::BestOf, r, spots, vols, dividends, z);
+    }
+
     // ─── Worst-of visit ─────────────────────────────────────────────────
 
     void RainbowMCEngine::visit(const WorstOfOption &opt)
     {
         const auto &m = require_model<MultiAssetBSModel>("RainbowMCEngine");
-        res_ = price_rainbow(m, ctx_.settings, opt.maturity, opt.strike,
-                             opt.is_call, opt.notional, RainbowType::WorstOf);
+        res_ = rainbow_streamed(opt, RainbowType::WorstOf, m, ctx_.settings);
     }
 
     // ─── Best-of visit ──────────────────────────────────────────────────
@@ -142,8 +207,7 @@ namespace quantModeling
     void RainbowMCEngine::visit(const BestOfOption &opt)
     {
         const auto &m = require_model<MultiAssetBSModel>("RainbowMCEngine");
-        res_ = price_rainbow(m, ctx_.settings, opt.maturity, opt.strike,
-                             opt.is_call, opt.notional, RainbowType::BestOf);
+        res_ = rainbow_streamed(opt, RainbowType::BestOf, m, ctx_.settings);
     }
 
     // ─── rejections ─────────────────────────────────────────────────────
@@ -252,7 +252,8 @@ namespace quantModeling
 
     // ── BondOption ───────────────────────────────────────────────────────────
     //
-    //  Simulate r to T_option, use analytic P(T_option, T_bond, r(T_option)),
+    //  Simulate r to T_option, value the underlying analytically as
+    //  Σ c_i P(T_option, t_i | r(T_option)) (a single unit flow for a ZCB),
     //  compute payoff, discount back.
 
     void ShortRateMCEngine::visit(const BondOption &opt)
@@ -265,6 +266,10 @@ namespace quantModeling
         if (opt.bond_maturity <= opt.option_maturity)
             throw InvalidInput("ShortRateMCEngine: bond_maturity must be > option_maturity");
 
+        std::vector<Time> cf_times;
+        std::vector<Real> cf_amounts;
+        opt.cash_flows_after_expiry(cf_times, cf_amounts);
+
         auto sim = simulate_paths(m, opt.option_maturity, {opt.option_maturity},
                                   mc.n_paths, mc.seed);
 
@@ -273,11 +278,12 @@ namespace quantModeling
         const Real *rt = sim.r_at_times.data();
         for (std::size_t p = 0; p < mc.n_paths; ++p)
         {
-            const Real P_T_S = m.zcb_price(opt.option_maturity,
-                                           opt.bond_maturity, rt[p]);
+            Real B_T = 0.0;
+            for (std::size_t i = 0; i < cf_times.size(); ++i)
+                B_T += cf_amounts[i] * m.zcb_price(opt.option_maturity, cf_times[i], rt[p]);
             const Real payoff = opt.is_call
-                                    ? std::max(P_T_S - opt.strike, 0.0)
-                                    : std::max(opt.strike - P_T_S, 0.0);
+                                    ? std::max(B_T - opt.strike, 0.0)
+                                    : std::max(opt.strike - B_T, 0.0);
             acc.add(payoff * df[p]);
         }
 
@@ -0,0 +1,395 @@
+#include "quantModeling/engines/pde/barrier.hpp"
+#include "quantModeling/engines/pde/grid.hpp"
+#include "quantModeling/engines/pde/tridiagonal.hpp"
+#include "quantModeling/instruments/equity/barrier.hpp"
+#include "quantModeling/models/equity/local_vol_model.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace quantModeling
+{
+    PDEBarrierEngine::PDEBarrierEngine(PricingContext ctx)
+        : EngineBase(std::move(ctx)),
+          M_(ctx_.settings.pde_space_steps),
+          N_(ctx_.settings.pde_time_steps)
+    {
+        if (M_ < 4)
+            throw InvalidInput("PDEBarrierEngine requires space_steps >= 4");
+        if (N_ < 1)
+            throw InvalidInput("PDEBarrierEngine requires time_steps >= 1");
+    }
+
+    namespace
+    {
+        // Grid and start-up constants as in the vanilla PDE engine.
+        constexpr Real kDomainStdDevs = 4.0;
+        constexpr Real kConcentrationWidth = 1.0;
+        constexpr int kRannacherSteps = 2;
+
+        constexpr Real kNoUpper = std::numeric_limits<Real>::infinity();
+
+        // The knock-out side of the problem; no barriers is the vanilla.
+        struct KnockSpec
+        {
+            Real lower = 0.0;     // 0 → none
+            Real upper = kNoUpper; // +∞ → none
+            Real rebate = 0.0;
+            bool continuous = true;
+            int n_monitor = 0; // discrete dates, equally spaced, the last at expiry
+        };
+
+        struct GridValue
+        {
+            Real npv = 0.0;
+            Real delta = 0.0;
+            Real gamma = 0.0;
+            Real theta = 0.0;
+            Real vega = 0.0;
+            Real rho = 0.0;
+        };
+
+        // Value and Greeks at the spot of the option that pays `payoff` at
+        // T unless a barrier of `knock` is hit, and the rebate at T if it is.
+        GridValue solve_knock_out(const ILocalVolModel &m, const IPayoff &payoff, Real T,
+                                  KnockSpec knock, int M, int N)
+        {
+            const Real S0 = m.spot0();
+            const Real r = m.rate_r();
+            const Real q = m.yield_q();
+            const Real K = payoff.strike();
+            const Real R = knock.rebate;
+            const OptionType type = payoff.type();
+
+            const IVolatility &vol = m.vol();
+            const bool flat_vol = dynamic_cast<const FlatVol *>(&vol) != nullptr;
+            Real sigma = m.vol_sigma();
+            if (!flat_vol)
+            {
+                for (Real s : {S0, K, std::max(knock.lower, S0 * 1e-3), std::min(knock.upper, S0 * 1e3)})
+                    sigma = std::max({sigma, vol.value(s, 0.0), vol.value(s, T)});
+            }
+
+            // Log-spot grid x = ln(S/K) over the vanilla domain.  A barrier
+            // inside it is a node: the end of the grid when monitoring is
+            // continuous, an interior node otherwise.  A barrier outside it
+            // cannot be reached with material probability and is dropped.
+            const Real x0 = std::log(S0 / K);
+            const Real sd = sigma * std::sqrt(T);
+            const Real drift = r - q - 0.5 * sigma * sigma;
+            const Real reach = kDomainStdDevs * sd + std::abs(drift) * T;
+            Real x_min = std::min(x0, 0.0) - reach;
+            Real x_max = std::max(x0, 0.0) + reach;
+            const Real x_lo_b = knock.lower > 0.0 ? std::log(knock.lower / K) : x_min;
+            const Real x_hi_b = knock.upper < kNoUpper ? std::log(knock.upper / K) : x_max;
+            const bool has_lo = x_lo_b > x_min;
+            const bool has_hi = x_hi_b < x_max;
+            if (knock.continuous)
+            {
+                if (has_lo)
+                    x_min = x_lo_b;
+                if (has_hi)
+                    x_max = x_hi_b;
+            }
+            const Real width = std::max(kConcentrationWidth * sd, 0.5 * std::abs(x0));
+            std::vector<Real> x = sinh_nodes(x_min, x_max, std::clamp(0.5 * x0, x_min, x_max), width, M);
+            std::vector<Real> pins{x0};
+            if (!knock.continuous && has_lo)
+                pins.push_back(x_lo_b);
+            if (!knock.continuous && has_hi)
+                pins.push_back(x_hi_b);
+            const int j0 = pin_nodes(x, pins).front();
+            const GridStencil D(x);
+
+            std::vector<Real> S_grid(M + 1);
+            // A discrete barrier node sits on the jump the knock-out leaves
+            // behind, so it takes the mean of the two sides; that keeps the
+            // scheme second order where the one-sided value is first order.
+            std::vector<char> knocked(M + 1, 0), on_barrier(M + 1, 0);
+            for (int j = 0; j <= M; ++j)
+            {
+                S_grid[j] = K * std::exp(x[j]);
+                const bool at = !knock.continuous && ((has_lo && x[j] == x_lo_b) || (has_hi && x[j] == x_hi_b));
+                knocked[j] = !at && ((has_lo && x[j] <= x_lo_b) || (has_hi && x[j] >= x_hi_b));
+                on_barrier[j] = at;
+            }
+
+            // Terminal condition: the rebate where knocked, the payoff
+            // (cell-averaged at the strike) elsewhere.
+            std::vector<Real> V(M + 1), V_new(M + 1);
+            for (int j = 0; j <= M; ++j)
+                V[j] = knocked[j] ? R : on_barrier[j] ? 0.5 * (R + payoff(S_grid[j])) : payoff(S_grid[j]);
+            {
+                const auto simpson = [&](Real lo, Real hi)
+                {
+                    const auto f = [&](Real xx) { return payoff(K * std::exp(xx)); };
+                    return (hi - lo) / 6.0 * (f(lo) + 4.0 * f(0.5 * (lo + hi)) + f(hi));
+                };
+                for (int j = 1; j < M; ++j)
+                {
+                    const Real lo = 0.5 * (x[j - 1] + x[j]);
+                    const Real hi = 0.5 * (x[j] + x[j + 1]);
+                    if (!knocked[j] && !on_barrier[j] && lo < 0.0 && hi > 0.0)
+                        V[j] = (simpson(lo, 0.0) + simpson(0.0, hi)) / (hi - lo);
+                }
+            }
+
+            // Time steps: a whole number per monitoring interval, so every
+            // monitoring date is a step boundary.
+            const int n_monitor = knock.continuous ? 1 : std::max(knock.n_monitor, 1);
+            const int per_interval = std::max(1, (N + n_monitor - 1) / n_monitor);
+            const int n_steps = per_interval * n_monitor;
+            const Real dt = T / n_steps;
+            const int n_rannacher = std::min(kRannacherSteps, n_steps);
+
+            // Operator and θ-scheme exactly as in the vanilla engine: θh =
+            // dt/2 for Crank-Nicolson and the implicit half-steps alike.
+            std::vector<Real> sig(M + 1, 0.0);
+            std::vector<Real> L_lo(M + 1, 0.0), L_mid(M + 1, 0.0), L_hi(M + 1, 0.0);
+            std::vector<Real> a(M + 1, 0.0), b(M + 1, 1.0), c(M + 1, 0.0);
+            TridiagonalFactor lhs;
+            const auto set_operator = [&](Real t)
+            {
+                for (int j = 1; j < M; ++j)
+                {
+                    sig[j] = vol.value(S_grid[j], t);
+                    const Real alpha = 0.5 * sig[j] * sig[j];
+                    const Real mu_x = r - q - alpha;
+                    L_lo[j] = alpha * D.d2_lo[j] + mu_x * D.d1_lo[j];
+                    L_mid[j] = alpha * D.d2_mid[j] + mu_x * D.d1_mid[j] - r;
+                    L_hi[j] = alpha * D.d2_hi[j] + mu_x * D.d1_hi[j];
+                    a[j] = -0.5 * dt * L_lo[j];
+                    b[j] = 1.0 - 0.5 * dt * L_mid[j];
+                    c[j] = -0.5 * dt * L_hi[j];
+                }
+                lhs.factor(a, b, c);
+            };
+            const auto apply_L = [&](const std::vector<Real> &v, int j)
+            {
+                return L_lo[j] * v[j - 1] + L_mid[j] * v[j] + L_hi[j] * v[j + 1];
+            };
+
+            // Vega (parallel σ shift) and rho from the sensitivity PDEs of
+            // the vanilla engine; knocked nodes carry the derivatives of
+            // the discounted rebate, 0 and −τ R df.
+            std::vector<Real> d(M + 1), U(M + 1, 0.0), W(M + 1, 0.0);
+            std::vector<Real> d_U(M + 1), d_W(M + 1);
+            std::vector<Real> src_U(M + 1, 0.0), src_W(M + 1, 0.0);
+
+            Real v_1 = V[j0], v_2 = V[j0];
+            Real h_1 = dt, h_2 = dt;
+            Real tau = 0.0;
+            for (int step = 0; step < n_steps; ++step)
+            {
+                // Rannacher at expiry and again after each monitoring date.
+                const bool implicit = step < n_rannacher || (step % per_interval == 0);
+                const int n_sub = implicit ? 2 : 1;
+                const Real h = dt / n_sub;
+                const Real explicit_h = implicit ? 0.0 : 0.5 * dt;
+
+                if (step == 0 || !flat_vol)
+                    set_operator(T - (tau + 0.5 * dt));
+
+                for (int sub = 0; sub < n_sub; ++sub)
+                {
+                    tau = (step + 1 == n_steps && sub + 1 == n_sub) ? T : tau + h;
+                    v_2 = v_1;
+                    v_1 = V[j0];
+                    h_2 = h_1;
+                    h_1 = h;
+
+                    for (int j = 1; j < M; ++j)
+                    {
+                        const Real v_x = D.d1(V, j);
+                        src_U[j] = sig[j] * (D.d2(V, j) - v_x);
+                        src_W[j] = v_x - V[j];
+                        d[j] = V[j] + explicit_h * apply_L(V, j);
+                    }
+
+                    // Ends: the discounted rebate on a barrier, the vanilla
+                    // asymptote otherwise.
+                    const Real df = m.discount_curve().discount(tau);
+                    Real rho_lo = 0.0, rho_hi = 0.0;
+                    if (knocked[0])
+                        d[0] = R * df, rho_lo = -tau * R * df;
+                    else if (type == OptionType::Put)
+                        d[0] = K * df - S_grid[0] * std::exp(-q * tau), rho_lo = -tau * K * df;
+                    else
+                        d[0] = 0.0;
+                    if (knocked[M])
+                        d[M] = R * df, rho_hi = -tau * R * df;
+                    else if (type == OptionType::Call)
+                        d[M] = S_grid[M] * std::exp(-q * tau) - K * df, rho_hi = tau * K * df;
+                    else
+                        d[M] = 0.0;
+
+                    lhs.solve(d, V_new);
+
+                    for (int j = 1; j < M; ++j)
+                    {
+                        const Real v_x = D.d1(V_new, j);
+                        const Real s_u = sig[j] * (D.d2(V_new, j) - v_x);
+                        const Real s_w = v_x - V_new[j];
+                        d_U[j] = U[j] + explicit_h * (apply_L(U, j) + src_U[j]) + 0.5 * dt * s_u;
+                        d_W[j] = W[j] + explicit_h * (apply_L(W, j) + src_W[j]) + 0.5 * dt * s_w;
+                    }
+                    d_U[0] = 0.0;
+                    d_U[M] = 0.0;
+                    d_W[0] = rho_lo;
+                    d_W[M] = rho_hi;
+                    lhs.solve(d_U, U);
+                    lhs.solve(d_W, W);
+
+                    V.swap(V_new);
+                }
+
+                // Discrete monitoring date (not t = 0): knock out.
+                if (!knock.continuous && (step + 1) % per_interval == 0 && step + 1 < n_steps)
+                {
+                    const Real df = m.discount_curve().discount(tau);
+                    for (int j = 0; j <= M; ++j)
+                    {
+                        if (knocked[j])
+                        {
+                            V[j] = R * df;
+                            U[j] = 0.0;
+                            W[j] = -tau * R * df;
+                        }
+                        else if (on_barrier[j])
+                        {
+                            V[j] = 0.5 * (V[j] + R * df);
+                            U[j] = 0.5 * U[j];
+                            W[j] = 0.5 * (W[j] - tau * R * df);
+                        }
+                    }
+                }
+            }
+
+            GridValue out;
+            out.npv = V[j0];
+            const Real vx = D.d1(V, j0);
+            out.delta = vx / S0;
+            out.gamma = (D.d2(V, j0) - vx) / (S0 * S0);
+            const Real h_12 = h_1 + h_2;
+            out.theta = -(h_1 + h_12) / (h_1 * h_12) * V[j0] + h_12 / (h_1 * h_2) * v_1 - h_1 / (h_2 * h_12) * v_2;
+            out.vega = U[j0];
+            out.rho = W[j0];
+            return out;
+        }
+
+        void validate_common(const IPayoff *payoff, const IExercise *exercise, Real notional)
+        {
+            if (!payoff)
+                throw InvalidInput("Barrier option: payoff is null");
+            if (!exercise || exercise->dates().empty())
+                throw InvalidInput("Barrier option: exercise is null or has no dates");
+            if (exercise->type() != ExerciseType::European)
+                throw UnsupportedInstrument("PDEBarrierEngine: only European exercise is supported");
+            if (!(exercise->dates().front() > 0.0))
+                throw InvalidInput("Barrier option: maturity must be > 0");
+            if (notional == 0.0)
+                throw InvalidInput("Barrier option: notional must be non-zero");
+            if (!(payoff->strike() > 0.0))
+                throw InvalidInput("Barrier option: strike must be > 0");
+        }
+
+        // Knock-out directly, knock-in by parity against the vanilla.
+        PricingResult price_knock(const ILocalVolModel &m, const IPayoff &payoff, Real T,
+                                  const KnockSpec &knock, bool knock_in, Real notional,
+                                  int n_steps, int M, int N, const std::string &label)
+        {
+            const Real S0 = m.spot0();
+            const Real df = m.discount_curve().discount(T);
+            const Real R = knock.rebate;
+            const bool flat_vol = dynamic_cast<const FlatVol *>(&m.vol()) != nullptr;
+
+            // Discounted rebate, with its ∂/∂t and ∂/∂r.
+            GridValue rebate;
+            rebate.npv = R * df;
+            rebate.theta = m.rate_r() * R * df;
+            rebate.rho = -T * R * df;
+
+            const bool knocked_now = S0 <= knock.lower || S0 >= knock.upper;
+            GridValue v;
+            if (knocked_now)
+                v = knock_in ? solve_knock_out(m, payoff, T, KnockSpec{}, M, N) : rebate;
+            else if (!knock_in)
+                v = solve_knock_out(m, payoff, T, knock, M, N);
+            else
+            {
+                const GridValue vanilla = solve_knock_out(m, payoff, T, KnockSpec{}, M, N);
+                const GridValue ko = solve_knock_out(m, payoff, T, knock, M, N);
+                v.npv = vanilla.npv + rebate.npv - ko.npv;
+                v.delta = vanilla.delta - ko.delta;
+                v.gamma = vanilla.gamma - ko.gamma;
+                v.theta = vanilla.theta + rebate.theta - ko.theta;
+                v.vega = vanilla.vega - ko.vega;
+                v.rho = vanilla.rho + rebate.rho - ko.rho;
+            }
+
+            PricingResult out;
+            out.npv = notional * v.npv;
+            out.greeks.delta = notional * v.delta;
+            out.greeks.gamma = notional * v.gamma;
+            out.greeks.theta = notional * v.theta;
+            out.greeks.vega = notional * v.vega;
+            out.greeks.rho = notional * v.rho;
+            out.mc_std_error = 0.0;
+            out.diagnostics = "PDE Crank-Nicolson " + label + (knock_in ? " knock-in" : " knock-out") +
+                              (knock.continuous ? ", continuous" : ", " + std::to_string(n_steps) + " monitoring dates") +
+                              (flat_vol ? "" : ", local vol") + (knocked_now ? ", already knocked" : "") +
+                              " (M=" + std::to_string(M) + ", N=" + std::to_string(N) + ", sinh grid)";
+            return out;
+        }
+
+        int monitoring_dates(int n_steps, Real T)
+        {
+            return n_steps > 0 ? n_steps : std::max(1, static_cast<int>(T * 52.0 + 0.5));
+        }
+    } // namespace
+
+    void PDEBarrierEngine::visit(const BarrierOption &opt)
+    {
+        validate_common(opt.payoff.get(), opt.exercise.get(), opt.notional);
+        if (!(opt.barrier > 0.0))
+            throw InvalidInput("BarrierOption: barrier must be > 0");
+        const auto &m = require_model<ILocalVolModel>("PDEBarrierEngine");
+
+        const Real T = opt.exercise->dates().front();
+        const bool is_up = (opt.barrier_type == BarrierType::UpAndIn ||
+                            opt.barrier_type == BarrierType::UpAndOut);
+        const bool is_in = (opt.barrier_type == BarrierType::UpAndIn ||
+                            opt.barrier_type == BarrierType::DownAndIn);
+
+        KnockSpec knock;
+        (is_up ? knock.upper : knock.lower) = opt.barrier;
+        knock.rebate = opt.rebate;
+        knock.continuous = opt.brownian_bridge;
+        knock.n_monitor = monitoring_dates(opt.n_steps, T);
+
+        res_ = price_knock(m, *opt.payoff, T, knock, is_in, opt.notional, knock.n_monitor, M_, N_,
+                           is_up ? "up barrier" : "down barrier");
+    }
+
+    void PDEBarrierEngine::visit(const DoubleBarrierOption &opt)
+    {
+        validate_common(opt.payoff.get(), opt.exercise.get(), opt.notional);
+        if (!(opt.lower_barrier > 0.0) || !(opt.upper_barrier > opt.lower_barrier))
+            throw InvalidInput("DoubleBarrierOption: barriers must satisfy 0 < lower < upper");
+        const auto &m = require_model<ILocalVolModel>("PDEBarrierEngine");
+
+        const Real T = opt.exercise->dates().front();
+        KnockSpec knock;
+        knock.lower = opt.lower_barrier;
+        knock.upper = opt.upper_barrier;
+        knock.rebate = opt.rebate;
+        knock.continuous = opt.brownian_bridge;
+        knock.n_monitor = monitoring_dates(opt.n_steps, T);
+
+        res_ = price_knock(m, *opt.payoff, T, knock, opt.barrier_type == DoubleBarrierType::KnockIn,
+                           opt.notional, knock.n_monitor, M_, N_, "double barrier");
+    }
+
+} // namespace quantModeling
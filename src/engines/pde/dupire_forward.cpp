@@ -0,0 +1,243 @@
+#include "quantModeling/engines/pde/dupire_forward.hpp"
+#include "quantModeling/calibration/implied_vol.hpp"
+#include "quantModeling/engines/pde/grid.hpp"
+#include "quantModeling/engines/pde/tridiagonal.hpp"
+#include "quantModeling/models/volatility.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace quantModeling
+{
+
+    namespace
+    {
+        // Domain half-width beyond the requested strikes and the money, in
+        // σ√T_max, and the sinh concentration width (as in the backward
+        // vanilla engine).
+        constexpr Real kDomainStdDevs = 4.0;
+        constexpr Real kConcentrationWidth = 1.0;
+
+        // Crank-Nicolson steps replaced by two fully implicit half-steps
+        // each, to damp the kink of the initial payoff.
+        constexpr int kRannacherSteps = 2;
+
+        void validate(const LocalVolCallSurfaceInput &in)
+        {
+            const auto increasing = [](const std::vector<Real> &v)
+            {
+                return std::adjacent_find(v.begin(), v.end(), std::greater_equal<Real>()) == v.end();
+            };
+            if (in.spot <= 0.0)
+                throw InvalidInput("price_local_vol_call_surface: spot must be > 0");
+            if (in.strikes.empty() || !increasing(in.strikes) || in.strikes.front() <= 0.0)
+                throw InvalidInput("price_local_vol_call_surface: strikes must be non-empty, increasing and > 0");
+            if (in.maturities.empty() || !increasing(in.maturities) || in.maturities.front() <= 0.0)
+                throw InvalidInput("price_local_vol_call_surface: maturities must be non-empty, increasing and > 0");
+            const auto &s = in.surface;
+            if (s.K_grid.size() < 2 || s.T_grid.size() < 2 ||
+                s.sigma_loc_flat.size() != s.K_grid.size() * s.T_grid.size())
+                throw InvalidInput("price_local_vol_call_surface: local-vol grid must be at least 2 x 2 "
+                                   "with sigma_loc_flat.size() == K_grid.size() * T_grid.size()");
+            if (in.pde_space_steps < 4)
+                throw InvalidInput("price_local_vol_call_surface: pde_space_steps must be >= 4");
+            if (in.pde_time_steps < 1)
+                throw InvalidInput("price_local_vol_call_surface: pde_time_steps must be >= 1");
+        }
+
+        // Cubic Lagrange interpolation of v at xq through the four nodes
+        // around it.
+        Real interpolate(const std::vector<Real> &x, const std::vector<Real> &v, Real xq)
+        {
+            const int n = static_cast<int>(x.size());
+            const int i = static_cast<int>(std::lower_bound(x.begin(), x.end(), xq) - x.begin());
+            const int lo = std::clamp(i - 2, 0, n - 4);
+            Real out = 0.0;
+            for (int a = lo; a < lo + 4; ++a)
+            {
+                Real w = 1.0;
+                for (int b = lo; b < lo + 4; ++b)
+                    if (b != a)
+                        w *= (xq - x[b]) / (x[a] - x[b]);
+                out += w * v[a];
+            }
+            return out;
+        }
+    } // namespace
+
+    LocalVolCallSurface price_local_vol_call_surface(const LocalVolCallSurfaceInput &in)
+    {
+        validate(in);
+
+        const Real S0 = in.spot;
+        const Real r = in.rate;
+        const Real q = in.dividend;
+        const int M = in.pde_space_steps;
+        const GridLocalVol vol(in.surface.K_grid, in.surface.T_grid, in.surface.sigma_loc_flat);
+
+        const std::vector<Real> &strikes = in.strikes;
+        const std::vector<Time> &maturities = in.maturities;
+        const Time T_max = maturities.back();
+
+        // Strike grid x = ln(K/S₀), sized from the largest vol seen at the
+        // money and at the strike extremes, concentrated at and pinned to
+        // the money, where the initial payoff has its kink.
+        Real sigma = 0.0;
+        for (Real k : {S0, strikes.front(), strikes.back()})
+            sigma = std::max({sigma, vol.value(k, 0.0), vol.value(k, T_max)});
+        const Real sd = sigma * std::sqrt(T_max);
+        const Real reach = kDomainStdDevs * sd + std::abs(r - q - 0.5 * sigma * sigma) * T_max;
+        const Real x_min = std::min(std::log(strikes.front() / S0), 0.0) - reach;
+        const Real x_max = std::max(std::log(strikes.back() / S0), 0.0) + reach;
+        const std::vector<Real> x = sinh_grid(x_min, x_max, 0.0, kConcentrationWidth * sd, 0.0, M);
+        const GridStencil D(x);
+
+        std::vector<Real> K_grid(M + 1);
+        for (int j = 0; j <= M; ++j)
+            K_grid[j] = S0 * std::exp(x[j]);
+
+        // Initial condition C(K, 0) = (S₀ − K)⁺, cell-averaged around the
+        // kink at x = 0.
+        std::vector<Real> C(M + 1), C_new(M + 1);
+        const auto payoff = [&](Real xx) { return std::max(S0 - S0 * std::exp(xx), 0.0); };
+        for (int j = 0; j <= M; ++j)
+            C[j] = payoff(x[j]);
+        {
+            const auto simpson = [&](Real lo, Real hi)
+            {
+                return (hi - lo) / 6.0 * (payoff(lo) + 4.0 * payoff(0.5 * (lo + hi)) + payoff(hi));
+            };
+            for (int j = 1; j < M; ++j)
+            {
+                const Real lo = 0.5 * (x[j - 1] + x[j]);
+                const Real hi = 0.5 * (x[j] + x[j + 1]);
+                if (lo < 0.0 && hi > 0.0)
+                    C[j] = (simpson(lo, 0.0) + simpson(0.0, hi)) / (hi - lo);
+            }
+        }
+
+        // Time nodes uniform in √t, so steps are short where the solution
+        // still carries the kink of the initial payoff and long where it
+        // is smooth.  pde_time_steps is spread over the gaps between
+        // maturities in proportion to their length in √t, at least one
+        // step per gap, so every maturity is hit exactly.
+        std::vector<Real> step_length;
+        std::vector<int> maturity_after; // index into maturities, or −1
+        {
+            const Real u_max = std::sqrt(T_max);
+            Real u_prev = 0.0;
+            Time t_prev = 0.0;
+            for (std::size_t m = 0; m < maturities.size(); ++m)
+            {
+                const Real u = std::sqrt(maturities[m]);
+                const int n = std::max(1, static_cast<int>(std::lround(in.pde_time_steps * (u - u_prev) / u_max)));
+                for (int s = 1; s <= n; ++s)
+                {
+                    const Real us = u_prev + (u - u_prev) * s / n;
+                    const Time t_next = (s == n) ? maturities[m] : us * us;
+                    step_length.push_back(t_next - t_prev);
+                    maturity_after.push_back(s == n ? static_cast<int>(m) : -1);
+                    t_prev = t_next;
+                }
+                u_prev = u;
+            }
+        }
+        const int n_steps = static_cast<int>(step_length.size());
+        const int n_rannacher = std::min(kRannacherSteps, n_steps);
+
+        // In x = ln(K/S₀), K² C_KK = C_xx − C_x and K C_K = C_x:
+        //   ∂C/∂T = ½σ² C_xx − (r − q + ½σ²) C_x − q C
+        // with σ = σ(K_j, T) frozen at each step's mid-time.  The matrix is
+        // I − (h/2)L for Crank-Nicolson and for the Rannacher half-steps
+        // alike, re-factored every step.
+        std::vector<Real> L_lo(M + 1, 0.0), L_mid(M + 1, 0.0), L_hi(M + 1, 0.0);
+        std::vector<Real> a(M + 1, 0.0), b(M + 1, 1.0), c(M + 1, 0.0), d(M + 1);
+        TridiagonalFactor lhs;
+        const auto set_operator = [&](Time t, Real h)
+        {
+            for (int j = 1; j < M; ++j)
+            {
+                const Real s = vol.value(K_grid[j], t);
+                const Real alpha = 0.5 * s * s;
+                const Real mu_x = -(r - q + alpha);
+                L_lo[j] = alpha * D.d2_lo[j] + mu_x * D.d1_lo[j];
+                L_mid[j] = alpha * D.d2_mid[j] + mu_x * D.d1_mid[j] - q;
+                L_hi[j] = alpha * D.d2_hi[j] + mu_x * D.d1_hi[j];
+                a[j] = -0.5 * h * L_lo[j];
+                b[j] = 1.0 - 0.5 * h * L_mid[j];
+                c[j] = -0.5 * h * L_hi[j];
+            }
+            lhs.factor(a, b, c);
+        };
+
+        const std::size_t nT = maturities.size();
+        LocalVolCallSurface out;
+        out.strikes = strikes;
+        out.maturities = maturities;
+        out.call_prices.assign(strikes.size() * nT, 0.0);
+
+        Time t = 0.0;
+        for (int step = 0; step < n_steps; ++step)
+        {
+            const Real h = step_length[step];
+            set_operator(t + 0.5 * h, h);
+
+            // A Rannacher step is two implicit half-steps (θ = 1, h/2), a
+            // Crank-Nicolson step one step with θ = ½: θh = h/2 either way.
+            const bool implicit = step < n_rannacher;
+            const int n_sub = implicit ? 2 : 1;
+            const Real explicit_h = implicit ? 0.0 : 0.5 * h;
+            for (int sub = 0; sub < n_sub; ++sub)
+            {
+                t += h / n_sub;
+                for (int j = 1; j < M; ++j)
+                    d[j] = C[j] + explicit_h * (L_lo[j] * C[j - 1] + L_mid[j] * C[j] + L_hi[j] * C[j + 1]);
+
+                // Zero strike: the discounted forward less the strike; far
+                // strikes: worthless.
+                d[0] = S0 * std::exp(-q * t) - K_grid[0] * std::exp(-r * t);
+                d[M] = 0.0;
+                lhs.solve(d, C_new);
+                C.swap(C_new);
+            }
+            if (maturity_after[step] >= 0)
+            {
+                t = maturities[maturity_after[step]];
+                const std::size_t m = static_cast<std::size_t>(maturity_after[step]);
+                for (std::size_t i = 0; i < strikes.size(); ++i)
+                    out.call_prices[i * nT + m] = interpolate(x, C, std::log(strikes[i] / S0));
+            }
+        }
+
+        // Implied vols from the out-of-the-money side (a put by parity below
+        // the forward), which keeps the inversion well conditioned.
+        out.implied_vols.assign(out.call_prices.size(), std::numeric_limits<Real>::quiet_NaN());
+        for (std::size_t i = 0; i < strikes.size(); ++i)
+        {
+            for (std::size_t m = 0; m < nT; ++m)
+            {
+                const Time T = maturities[m];
+                const Real K = strikes[i];
+                const Real call = out.call_prices[i * nT + m];
+                const bool otm_call = K >= S0 * std::exp((r - q) * T);
+                const Real price = otm_call ? call : call - S0 * std::exp(-q * T) + K * std::exp(-r * T);
+                try
+                {
+                    out.implied_vols[i * nT + m] = implied_vol_bs(price, S0, K, T, r, q, otm_call);
+                }
+                catch (const InvalidInput &)
+                {
+                }
+            }
+        }
+
+        out.diagnostics = "Forward Dupire PDE (M=" + std::to_string(M) + ", N=" + std::to_string(n_steps) +
+                          ", sinh grid, Rannacher " + std::to_string(n_rannacher) + "): " +
+                          std::to_string(strikes.size()) + " strikes x " + std::to_string(nT) + " maturities";
+        return out;
+    }
+
+} // namespace quantModeling
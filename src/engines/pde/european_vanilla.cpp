@@ -1,4 +1,6 @@
 #include "quantModeling/engines/pde/european_vanilla.hpp"
+#include "quantModeling/engines/pde/grid.hpp"
+#include "quantModeling/engines/pde/tridiagonal.hpp"
 #include "quantModeling/engines/base.hpp"
 #include "quantModeling/instruments/equity/vanilla.hpp"
 #include "quantModeling/models/equity/local_vol_model.hpp"
@@ -19,6 +21,23 @@ namespace quantModeling
             throw InvalidInput("PDE requires time_steps >= 1");
     }
 
+    namespace
+    {
+        // Half-width of the log-spot domain in standard deviations σ√T,
+        // measured from the spot and the strike outwards.
+        constexpr Real kDomainStdDevs = 4.0;
+
+        // Width of the sinh concentration region in units of σ√T.  Nodes
+        // are about twice as dense at the centre as on a uniform grid over
+        // the same domain; stronger stretching starves the body of the
+        // density and loses more than it gains at the kink.
+        constexpr Real kConcentrationWidth = 1.0;
+
+        // Crank-Nicolson steps replaced by two fully implicit half-steps
+        // each (Rannacher), to damp the payoff kink.
+        constexpr int kRannacherSteps = 2;
+    } // namespace
+
     void PDEEuropeanVanillaEngine::visit(const VanillaOption &opt)
     {
         validate(opt);
@@ -27,19 +46,38 @@ namespace quantModeling
         const Real S0 = m.spot0();
         const Real r = m.rate_r();
         const Real q = m.yield_q();
-        const Real sigma = m.vol_sigma();
         const Real T = opt.exercise->dates().front();
         const Real K = opt.payoff->strike();
         const OptionType type = opt.payoff->type();
+        const bool is_american = opt.exercise->type() == ExerciseType::American;
 
-        // Grid setup
-        const Real dt = T / N_;
+        // σ(S, t) comes from the model's surface.  A flat vol leaves the
+        // operator constant in time; a local-vol surface is sampled at the
+        // nodes every step.  The grid is sized from the largest of the vols
+        // seen by spot and strike.
+        const IVolatility &vol = m.vol();
+        const bool flat_vol = dynamic_cast<const FlatVol *>(&vol) != nullptr;
+        const Real sigma = flat_vol ? m.vol_sigma()
+                                    : std::max({m.vol_sigma(), vol.value(S0, T), vol.value(K, 0.0), vol.value(K, T)});
 
         // Space grid: log-transformed coordinates
         // x = ln(S/K), so S = K * exp(x)
-        const Real x_min = -1.0; // S = K * exp(-1) ≈ 0.37 * K
-        const Real x_max = 1.0;  // S = K * exp(1) ≈ 2.72 * K
-        const Real dx = (x_max - x_min) / M_;
+        //
+        // The domain spans kDomainStdDevs standard deviations beyond both
+        // spot and strike (plus the drift over [0, T]); the nodes are
+        // sinh-stretched towards the kink at the strike and the spot, and
+        // the spot is made a node so that price and Greeks need no
+        // interpolation.
+        const Real x0 = std::log(S0 / K);
+        const Real sd = sigma * std::sqrt(T);
+        const Real drift = r - q - 0.5 * sigma * sigma;
+        const Real reach = kDomainStdDevs * sd + std::abs(drift) * T;
+        const Real x_min = std::min(x0, 0.0) - reach;
+        const Real x_max = std::max(x0, 0.0) + reach;
+        const Real width = std::max(kConcentrationWidth * sd, 0.5 * std::abs(x0));
+        const std::vector<Real> x = sinh_grid(x_min, x_max, 0.5 * x0, width, x0, M_);
+        const int j0 = static_cast<int>(std::lower_bound(x.begin(), x.end(), x0) - x.begin());
+        const GridStencil D(x);
 
         std::vector<Real> V(M_ + 1);
         std::vector<Real> V_new(M_ + 1);
@@ -49,222 +87,203 @@ namespace quantModeling
         std::vector<Real> S_grid(M_ + 1);
         for (int j = 0; j <= M_; ++j)
         {
-            const Real x = x_min + j * dx;
-            S_grid[j] = K * std::exp(x);
+            S_grid[j] = K * std::exp(x[j]);
             payoff[j] = (*opt.payoff)(S_grid[j]);
         }
 
-        // Terminal condition: V(S, T) = payoff(S)
-        for (int j = 0; j <= M_; ++j)
+        // Terminal condition: V(S, T) = payoff(S), averaged over the cell
+        // that contains the strike so that the kink does not cost accuracy
+        // depending on where it falls between nodes (Pooley, Vetzal &
+        // Forsyth).  Simpson on either side of the kink.
+        V = payoff;
         {
-            V[j] = payoff[j];
+            const auto simpson = [&](Real lo, Real hi)
+            {
+                const auto f = [&](Real xx) { return (*opt.payoff)(K * std::exp(xx)); };
+                return (hi - lo) / 6.0 * (f(lo) + 4.0 * f(0.5 * (lo + hi)) + f(hi));
+            };
+            for (int j = 1; j < M_; ++j)
+            {
+                const Real lo = 0.5 * (x[j - 1] + x[j]);
+                const Real hi = 0.5 * (x[j] + x[j + 1]);
+                if (lo < 0.0 && hi > 0.0)
+                    V[j] = (simpson(lo, 0.0) + simpson(0.0, hi)) / (hi - lo);
+            }
         }
 
-        // Crank-Nicolson coefficients
         // In log-space x = ln(S/K), the PDE becomes:
         // dV/dt = 0.5 * sigma^2 * d2V/dx2 + (r - q - 0.5 * sigma^2) * dV/dx - r * V
+        // with sigma = σ(S_j, t) per node.  L's three diagonals on the grid
+        // and the nodal vols, frozen at the mid-point of each step:
+        std::vector<Real> sig(M_ + 1, 0.0);
+        std::vector<Real> L_lo(M_ + 1, 0.0), L_mid(M_ + 1, 0.0), L_hi(M_ + 1, 0.0);
+        const auto apply_L = [&](const std::vector<Real> &v, int j)
+        {
+            return L_lo[j] * v[j - 1] + L_mid[j] * v[j] + L_hi[j] * v[j + 1];
+        };
+
+        // Time stepping: θ-scheme V − θhLV = V⁺ + (1 − θ)hLV⁺.  Rannacher
+        // start-up: the first kRannacherSteps Crank-Nicolson steps (θ = ½)
+        // are each replaced by two fully implicit half-steps (θ = 1, h =
+        // dt/2).  Both have θh = dt/2, so the matrix is I − (dt/2)L
+        // throughout: with a flat vol it is factored once, with a surface
+        // it is re-factored each step.  An American put eliminates top-down
+        // so that the Brennan-Schwartz substitution starts in the exercise
+        // region at low S.
+        const Real dt = T / N_;
+        const int n_rannacher = std::min(kRannacherSteps, N_);
+        TridiagonalFactor lhs;
+        std::vector<Real> a(M_ + 1, 0.0), b(M_ + 1, 1.0), c(M_ + 1, 0.0);
+        const auto set_operator = [&](Real t)
+        {
+            for (int j = 1; j < M_; ++j)
+            {
+                sig[j] = vol.value(S_grid[j], t);
+                const Real alpha = 0.5 * sig[j] * sig[j];
+                const Real mu_x = r - q - alpha;
+                L_lo[j] = alpha * D.d2_lo[j] + mu_x * D.d1_lo[j];
+                L_mid[j] = alpha * D.d2_mid[j] + mu_x * D.d1_mid[j] - r;
+                L_hi[j] = alpha * D.d2_hi[j] + mu_x * D.d1_hi[j];
+                a[j] = -0.5 * dt * L_lo[j];
+                b[j] = 1.0 - 0.5 * dt * L_mid[j];
+                c[j] = -0.5 * dt * L_hi[j];
+            }
+            lhs.factor(a, b, c, is_american && type == OptionType::Put);
+        };
+
+        // Sensitivity PDEs.  Differentiating V_t + L V = 0 in a parallel
+        // shift of σ(S, t) and in r gives
+        //   U_t + L U + (∂L/∂σ) V = 0,   (∂L/∂σ) V = σ (V_xx − V_x)
+        //   W_t + L W + (∂L/∂r) V = 0,   (∂L/∂r) V = V_x − V
+        // with zero terminal data: the same operator as V plus a source
+        // term, so vega and rho ride along in the price sweep and share its
+        // matrix.  Discretised with the same stencils and nodal vols as L,
+        // U and W are the exact derivatives of the discrete price.
+        std::vector<Real> d(M_ + 1);
+        std::vector<Real> U(M_ + 1, 0.0), W(M_ + 1, 0.0);
+        std::vector<Real> d_U(M_ + 1), d_W(M_ + 1);
+        std::vector<Real> src_U(M_ + 1, 0.0), src_W(M_ + 1, 0.0);
+
+        // Spot-node values of the two layers before t = 0 and the lengths
+        // of the steps between them, for theta.
+        Real v_1 = 0.0, v_2 = 0.0;
+        Real h_1 = dt, h_2 = dt;
+
+        Real tau = 0.0;
+        const int n_steps = 2 * n_rannacher + (N_ - n_rannacher);
+        for (int step = 0; step < n_steps; ++step)
+        {
+            const bool implicit = step < 2 * n_rannacher;
+            const Real h = implicit ? 0.5 * dt : dt;
+            const Real explicit_h = implicit ? 0.0 : 0.5 * dt; // (1 − θ) h; θh = dt/2
+            tau = (step + 1 == n_steps) ? T : tau + h;
 
-        const Real drift = r - q - 0.5 * sigma * sigma;
-        const Real alpha = 0.5 * sigma * sigma;
-
-        const Real lambda = dt / (dx * dx);
-        const Real mu = dt / (2.0 * dx);
+            v_2 = v_1;
+            v_1 = V[j0];
+            h_2 = h_1;
+            h_1 = h;
 
-        std::vector<Real> a(M_ + 1);
-        std::vector<Real> b(M_ + 1);
-        std::vector<Real> c(M_ + 1);
-        std::vector<Real> d(M_ + 1);
+            if (step == 0 || !flat_vol)
+                set_operator(T - (tau - 0.5 * h));
 
-        // Backward in time (from T to 0)
-        for (int n = N_ - 1; n >= 0; --n)
-        {
-            // Build RHS: (I + 0.5*dt*L)*V
+            // Price RHS, and the sensitivity sources on the old layer.
             for (int j = 1; j < M_; ++j)
             {
-                const Real coeff_jm1 = alpha * lambda - drift * mu;
-                const Real coeff_j = 1.0 - alpha * 2.0 * lambda - 0.5 * r * dt;
-                const Real coeff_jp1 = alpha * lambda + drift * mu;
-
-                d[j] = coeff_jm1 * V[j - 1] + coeff_j * V[j] + coeff_jp1 * V[j + 1];
+                const Real v_x = D.d1(V, j);
+                src_U[j] = sig[j] * (D.d2(V, j) - v_x);
+                src_W[j] = v_x - V[j];
+                d[j] = V[j] + explicit_h * apply_L(V, j);
             }
 
-            // Boundary conditions
-            const Real df = m.discount_curve().discount(T - n * dt);
+            // Boundary conditions (American: never below intrinsic).  The
+            // sensitivity boundaries are the σ- and r-derivatives of these.
+            const Real df = m.discount_curve().discount(tau);
+            Real rho_lo = 0.0, rho_hi = 0.0;
             if (type == OptionType::Call)
             {
                 d[0] = 0.0;
-                d[M_] = S_grid[M_] - K * df;
+                d[M_] = S_grid[M_] * std::exp(-q * tau) - K * df;
+                rho_hi = tau * K * df;
             }
             else
             {
-                d[0] = K * df;
+                d[0] = K * df - S_grid[0] * std::exp(-q * tau);
                 d[M_] = 0.0;
+                rho_lo = -tau * K * df;
             }
-
-            // Build LHS matrix: (I - 0.5*dt*L)
-            for (int j = 1; j < M_; ++j)
+            if (is_american)
             {
-                a[j] = -(alpha * lambda - drift * mu) * 0.5;
-                b[j] = 1.0 + alpha * 2.0 * lambda * 0.5 + 0.5 * r * dt;
-                c[j] = -(alpha * lambda + drift * mu) * 0.5;
+                if (payoff[0] > d[0])
+                    d[0] = payoff[0], rho_lo = 0.0;
+                if (payoff[M_] > d[M_])
+                    d[M_] = payoff[M_], rho_hi = 0.0;
             }
 
-            // Boundary conditions for matrix
-            b[0] = 1.0;
-            c[0] = 0.0;
-            a[M_] = 0.0;
-            b[M_] = 1.0;
-
-            // Solve tridiagonal system
-            solve_tridiagonal(a, b, c, d, V_new);
-            V = V_new;
-        }
-
-        // Interpolate to find V(S0, 0)
-        const Real x0 = std::log(S0 / K);
-        Real npv = 0.0;
-
-        if (x0 <= x_min)
-        {
-            npv = V[0];
-        }
-        else if (x0 >= x_max)
-        {
-            npv = V[M_];
-        }
-        else
-        {
-            const int j_left = static_cast<int>((x0 - x_min) / dx);
-            const int j_right = j_left + 1;
-            const Real x_left = x_min + j_left * dx;
-            const Real x_right = x_min + j_right * dx;
-            const Real weight = (x0 - x_left) / (x_right - x_left);
-            npv = (1.0 - weight) * V[j_left] + weight * V[j_right];
-        }
-
-        PricingResult out;
-        out.npv = opt.notional * npv;
-        out.diagnostics = "PDE Crank-Nicolson European vanilla (M=" + std::to_string(M_) +
-                          ", N=" + std::to_string(N_) + ")";
-
-        // Greeks via finite differences
-        const Real dS = S0 * 0.01;
-
-        // Delta computation (spot bump)
-        {
-            std::vector<Real> V_temp(M_ + 1);
-            std::vector<Real> V_new_temp(M_ + 1);
-            for (int j = 0; j <= M_; ++j)
-            {
-                const Real x = x_min + j * dx;
-                const Real S = (S0 + dS) * std::exp(x - std::log(S0));
-                V_temp[j] = (*opt.payoff)(S);
-            }
-            for (int n = N_ - 1; n >= 0; --n)
-            {
-                for (int j = 1; j < M_; ++j)
-                {
-                    const Real coeff_jm1 = alpha * lambda - drift * mu;
-                    const Real coeff_j = 1.0 - alpha * 2.0 * lambda - 0.5 * r * dt;
-                    const Real coeff_jp1 = alpha * lambda + drift * mu;
-                    d[j] = coeff_jm1 * V_temp[j - 1] + coeff_j * V_temp[j] + coeff_jp1 * V_temp[j + 1];
-                }
-                const Real df = m.discount_curve().discount(T - n * dt);
-                if (type == OptionType::Call)
-                {
-                    d[0] = 0.0;
-                    d[M_] = S_grid[M_] * (S0 + dS) / S0 - K * df;
-                }
-                else
-                {
-                    d[0] = K * df;
-                    d[M_] = 0.0;
-                }
-                for (int j = 1; j < M_; ++j)
-                {
-                    a[j] = -(alpha * lambda - drift * mu) * 0.5;
-                    b[j] = 1.0 + alpha * 2.0 * lambda * 0.5 + 0.5 * r * dt;
-                    c[j] = -(alpha * lambda + drift * mu) * 0.5;
-                }
-                b[0] = 1.0;
-                c[0] = 0.0;
-                a[M_] = 0.0;
-                b[M_] = 1.0;
-                solve_tridiagonal(a, b, c, d, V_new_temp);
-                V_temp = V_new_temp;
-            }
-
-            Real x0_up = std::log((S0 + dS) / K);
-            Real npv_up = 0.0;
-            if (x0_up <= x_min)
-                npv_up = V_temp[0];
-            else if (x0_up >= x_max)
-                npv_up = V_temp[M_];
+            // With early exercise, the linear complementarity problem
+            // V ≥ payoff by Brennan-Schwartz.
+            if (is_american)
+                lhs.solve_projected(d, payoff, V_new);
             else
-            {
-                int j = static_cast<int>((x0_up - x_min) / dx);
-                Real w = (x0_up - (x_min + j * dx)) / dx;
-                npv_up = (1.0 - w) * V_temp[j] + w * V_temp[j + 1];
-            }
+                lhs.solve(d, V_new);
 
-            // Delta for down
-            for (int j = 0; j <= M_; ++j)
+            // Sensitivity RHS in one pass: θ-weighted sources on the old
+            // and new price layers.
+            for (int j = 1; j < M_; ++j)
             {
-                const Real x = x_min + j * dx;
-                const Real S = (S0 - dS) * std::exp(x - std::log(S0));
-                V_temp[j] = (*opt.payoff)(S);
+                const Real v_x = D.d1(V_new, j);
+                const Real s_u = sig[j] * (D.d2(V_new, j) - v_x);
+                const Real s_w = v_x - V_new[j];
+                d_U[j] = U[j] + explicit_h * (apply_L(U, j) + src_U[j]) + 0.5 * dt * s_u;
+                d_W[j] = W[j] + explicit_h * (apply_L(W, j) + src_W[j]) + 0.5 * dt * s_w;
             }
-            for (int n = N_ - 1; n >= 0; --n)
+            d_U[0] = 0.0;
+            d_U[M_] = 0.0;
+            d_W[0] = rho_lo;
+            d_W[M_] = rho_hi;
+            lhs.solve(d_U, U);
+            lhs.solve(d_W, W);
+
+            // Where exercise is optimal the value is the payoff, which does
+            // not depend on σ or r.
+            if (is_american)
             {
                 for (int j = 1; j < M_; ++j)
                 {
-                    const Real coeff_jm1 = alpha * lambda - drift * mu;
-                    const Real coeff_j = 1.0 - alpha * 2.0 * lambda - 0.5 * r * dt;
-                    const Real coeff_jp1 = alpha * lambda + drift * mu;
-                    d[j] = coeff_jm1 * V_temp[j - 1] + coeff_j * V_temp[j] + coeff_jp1 * V_temp[j + 1];
+                    if (V_new[j] <= payoff[j])
+                    {
+                        U[j] = 0.0;
+                        W[j] = 0.0;
+                    }
                 }
-                const Real df = m.discount_curve().discount(T - n * dt);
-                if (type == OptionType::Call)
-                {
-                    d[0] = 0.0;
-                    d[M_] = S_grid[M_] * (S0 - dS) / S0 - K * df;
-                }
-                else
-                {
-                    d[0] = K * df;
-                    d[M_] = 0.0;
-                }
-                for (int j = 1; j < M_; ++j)
-                {
-                    a[j] = -(alpha * lambda - drift * mu) * 0.5;
-                    b[j] = 1.0 + alpha * 2.0 * lambda * 0.5 + 0.5 * r * dt;
-                    c[j] = -(alpha * lambda + drift * mu) * 0.5;
-                }
-                b[0] = 1.0;
-                c[0] = 0.0;
-                a[M_] = 0.0;
-                b[M_] = 1.0;
-                solve_tridiagonal(a, b, c, d, V_new_temp);
-                V_temp = V_new_temp;
-            }
-
-            Real x0_down = std::log((S0 - dS) / K);
-            Real npv_down = 0.0;
-            if (x0_down <= x_min)
-                npv_down = V_temp[0];
-            else if (x0_down >= x_max)
-                npv_down = V_temp[M_];
-            else
-            {
-                int j = static_cast<int>((x0_down - x_min) / dx);
-                Real w = (x0_down - (x_min + j * dx)) / dx;
-                npv_down = (1.0 - w) * V_temp[j] + w * V_temp[j + 1];
             }
 
-            out.greeks.delta = opt.notional * (npv_up - npv_down) / (2.0 * dS);
-            out.greeks.gamma = opt.notional * (npv_up - 2.0 * npv + npv_down) / (dS * dS);
+            V.swap(V_new);
         }
 
+        PricingResult out;
+        out.npv = opt.notional * V[j0];
+        out.diagnostics = std::string("PDE Crank-Nicolson ") + (is_american ? "American" : "European") +
+                          " vanilla" + (flat_vol ? "" : ", local vol") + " (M=" + std::to_string(M_) +
+                          ", N=" + std::to_string(N_) + ", sinh grid, Rannacher " + std::to_string(n_rannacher) + ")";
+
+        // Delta and gamma from the final layer at the spot node: in
+        // x = ln(S/K), V_S = V_x / S and V_SS = (V_xx − V_x) / S².
+        const Real vx = D.d1(V, j0);
+        const Real vxx = D.d2(V, j0);
+        out.greeks.delta = opt.notional * vx / S0;
+        out.greeks.gamma = opt.notional * (vxx - vx) / (S0 * S0);
+
+        // Theta = ∂V/∂t at t = 0 from the last layers.  A plain difference
+        // of the last two is only first order in dt; the one-sided
+        // three-point formula through t = 0, h_1, h_1 + h_2 is second order
+        // (there are always at least the two Rannacher half-steps).
+        const Real h_12 = h_1 + h_2;
+        out.greeks.theta = opt.notional * (-(h_1 + h_12) / (h_1 * h_12) * V[j0] +
+                                           h_12 / (h_1 * h_2) * v_1 - h_1 / (h_2 * h_12) * v_2);
+
+        out.greeks.vega = opt.notional * U[j0];
+        out.greeks.rho = opt.notional * W[j0];
+
         res_ = out;
     }
 
@@ -306,13 +325,9 @@ namespace quantModeling
             throw InvalidInput("VanillaOption.payoff is null");
         if (!opt.exercise)
             throw InvalidInput("VanillaOption.exercise is null");
-        if (opt.exercise->type() != ExerciseType::European)
-        {
-            throw UnsupportedInstrument("PDE engine is designed for European exercise only");
-        }
         if (opt.exercise->dates().size() != 1)
         {
-            throw InvalidInput("EuropeanExercise must contain exactly one date (maturity)");
+            throw InvalidInput("VanillaExercise must contain exactly one date (maturity)");
         }
         const Real T = opt.exercise->dates().front();
         if (!(T > 0.0))
@@ -323,35 +338,4 @@ namespace quantModeling
         if (!(K > 0.0))
             throw InvalidInput("Strike must be > 0");
     }
-
-    void PDEEuropeanVanillaEngine::solve_tridiagonal(const std::vector<Real> &a,
-                                                     const std::vector<Real> &b,
-                                                     const std::vector<Real> &c,
-                                                     const std::vector<Real> &d,
-                                                     std::vector<Real> &x)
-    {
-        const int n = static_cast<int>(b.size());
-        x.resize(n);
-
-        std::vector<Real> c_star(n);
-        std::vector<Real> d_star(n);
-
-        // Forward sweep
-        c_star[0] = c[0] / b[0];
-        d_star[0] = d[0] / b[0];
-
-        for (int i = 1; i < n; ++i)
-        {
-            const Real denom = b[i] - a[i] * c_star[i - 1];
-            c_star[i] = c[i] / denom;
-            d_star[i] = (d[i] - a[i] * d_star[i - 1]) / denom;
-        }
-
-        // Back substitution
-        x[n - 1] = d_star[n - 1];
-        for (int i = n - 2; i >= 0; --i)
-        {
-            x[i] = d_star[i] - c_star[i] * x[i + 1];
-        }
-    }
 } // namespace quantModeling
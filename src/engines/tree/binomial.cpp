@@ -8,206 +8,218 @@
 
 namespace quantModeling
 {
-    BinomialVanillaEngine::BinomialVanillaEngine(PricingContext ctx)
-        : EngineBase(std::move(ctx)), steps_(ctx_.settings.tree_steps)
+    namespace
     {
-        if (steps_ < 1)
-            throw InvalidInput("Binomial tree requires steps >= 1");
-    }
-
-    void BinomialVanillaEngine::visit(const VanillaOption &opt)
-    {
-        validate(opt);
-        const auto &m = require_model<ILocalVolModel>("BinomialVanillaEngine");
-
-        const Real S0 = m.spot0();
-        const Real r = m.rate_r();
-        const Real q = m.yield_q();
-        const Real sigma = m.vol_sigma();
-        const Real T = opt.exercise->dates().front();
-        // const Real K = opt.payoff->strike();      // Unused (kept for reference)
-        // const OptionType type = opt.payoff->type();  // Unused (kept for reference)
-        const bool is_american = opt.exercise->type() == ExerciseType::American;
-
-        // Time step
-        const Real dt = T / steps_;
-
-        // CRR binomial tree parameters
-        const Real u = std::exp(sigma * std::sqrt(dt));  // up factor
-        const Real d = 1.0 / u;                          // down factor
-        const Real a = std::exp((r - q) * dt);           // drift factor
-        const Real p = (a - d) / (u - d);                // risk-neutral probability
-        const Real df = m.discount_curve().discount(dt); // discount factor
+        /// Branching of one binomial step: S → S·u with probability p, else S·d.
+        struct BinomialStep
+        {
+            Real u;
+            Real d;
+            Real p;
+        };
 
-        if (!(p >= 0.0 && p <= 1.0))
-            throw InvalidInput("Risk-neutral probability out of bounds [0,1]. Check model parameters.");
+        /// Cox-Ross-Rubinstein: u = e^{σ√Δt}, d = 1/u.
+        BinomialStep crr_step(Real sigma, Real dt, Real growth)
+        {
+            const Real u = std::exp(sigma * std::sqrt(dt));
+            const Real d = 1.0 / u;
+            return {u, d, (growth - d) / (u - d)};
+        }
 
-        // Tree values at maturity (step N)
-        std::vector<Real> values(steps_ + 1);
+        /// Peizer-Pratt method-2 inversion of the normal CDF for n steps.
+        Real peizer_pratt(Real z, int n)
+        {
+            const Real m = n + 1.0 / 3.0 + 0.1 / (n + 1.0);
+            const Real y = z / m;
+            const Real h = 0.5 * std::sqrt(1.0 - std::exp(-y * y * (n + 1.0 / 6.0)));
+            return z >= 0.0 ? 0.5 + h : 0.5 - h;
+        }
 
-        // Initialize terminal values (at maturity)
-        for (int j = 0; j <= steps_; ++j)
+        /// Leisen-Reimer (1996): p = h(d2) and p' = h(d1), with h the
+        /// Peizer-Pratt inversion, so that the n-step tree matches Φ(d1),
+        /// Φ(d2) and centres the strike between two terminal nodes (n odd).
+        BinomialStep leisen_reimer_step(Real S0, Real K, Real r, Real q, Real sigma, Real T, int n, Real growth)
         {
-            const Real ST = S0 * std::pow(u, j) * std::pow(d, steps_ - j);
-            values[j] = (*opt.payoff)(ST);
+            const Real st = sigma * std::sqrt(T);
+            const Real d1 = (std::log(S0 / K) + (r - q + 0.5 * sigma * sigma) * T) / st;
+            const Real p = peizer_pratt(d1 - st, n);
+            const Real p_bar = peizer_pratt(d1, n);
+            const Real u = growth * p_bar / p;
+            const Real d = (growth - p * u) / (1.0 - p);
+            return {u, d, p};
         }
 
-        // Backward induction through the tree
-        for (int i = steps_ - 1; i >= 0; --i)
+        /// Price, delta, gamma and theta of one tree.
+        struct LatticeGreeks
         {
-            for (int j = 0; j <= i; ++j)
-            {
-                const Real S = S0 * std::pow(u, j) * std::pow(d, i - j);
+            Real npv;
+            Real delta;
+            Real gamma;
+            Real theta;
+        };
 
-                // Continuation value (risk-neutral expectation)
-                const Real continuation = df * (p * values[j + 1] + (1.0 - p) * values[j]);
+        /// One backward pass on a lattice extended two steps before t = 0:
+        /// the root sits at S0/(ud) so that step 2 holds S0·u/d, S0, S0·d/u
+        /// at t = 0.  Delta and gamma come from those three nodes and theta
+        /// from the root, moved back to spot S0 to second order.
+        LatticeGreeks roll_back_binomial(const IPayoff &payoff, Real S0, const BinomialStep &st,
+                                         Real df, Real dt, int steps, bool is_american)
+        {
+            const int levels = steps + 2;
+            const Real root = S0 / (st.u * st.d);
 
-                // For American: check early exercise, for European: use continuation
-                if (is_american)
-                {
-                    const Real exercise = (*opt.payoff)(S);
-                    values[j] = std::max(continuation, exercise);
-                }
-                else
+            std::vector<Real> values(levels + 1);
+            Real v2d = 0.0, v2m = 0.0, v2u = 0.0;
+            const auto roll = [&](const auto &exercise)
+            {
+                for (int i = levels - 1; i >= 0; --i)
                 {
-                    values[j] = continuation;
+                    for (int j = 0; j <= i; ++j)
+                    {
+                        const Real continuation = df * (st.p * values[j + 1] + (1.0 - st.p) * values[j]);
+                        values[j] = is_american ? std::max(continuation, exercise(i, j)) : continuation;
+                    }
+                    if (i == 2)
+                    {
+                        v2d = values[0];
+                        v2m = values[1];
+                        v2u = values[2];
+                    }
                 }
-            }
-        }
-
-        PricingResult out;
-        out.npv = opt.notional * values[0];
-
-        const char *exercise_label = is_american ? "American" : "European";
-        out.diagnostics = std::string("Binomial tree (CRR) ") + exercise_label +
-                          " vanilla (steps=" + std::to_string(steps_) + ")";
-
-        // Simple finite difference approximation for Greeks
-        const Real dS = S0 * 0.01; // 1% bump
+            };
 
-        // Recompute price at S0 + dS (up value)
-        std::vector<Real> values_up(steps_ + 1);
-        for (int j = 0; j <= steps_; ++j)
-        {
-            const Real ST = (S0 + dS) * std::pow(u, j) * std::pow(d, steps_ - j);
-            values_up[j] = (*opt.payoff)(ST);
-        }
-        for (int i = steps_ - 1; i >= 0; --i)
-        {
-            for (int j = 0; j <= i; ++j)
+            if (std::abs(st.u * st.d - 1.0) <= 1e-12)
             {
-                const Real S = (S0 + dS) * std::pow(u, j) * std::pow(d, i - j);
-                const Real continuation = df * (p * values_up[j + 1] + (1.0 - p) * values_up[j]);
-                if (is_american)
+                // Recombining in level (CRR): node j of step i sits at
+                // root·u^(2j−i), so spot and exercise values are tabulated
+                // once per level.
+                std::vector<Real> spot(2 * levels + 1);
+                spot[levels] = root;
+                for (int k = 1; k <= levels; ++k)
                 {
-                    const Real exercise = (*opt.payoff)(S);
-                    values_up[j] = std::max(continuation, exercise);
+                    spot[levels + k] = spot[levels + k - 1] * st.u;
+                    spot[levels - k] = spot[levels - k + 1] * st.d;
                 }
-                else
+                std::vector<Real> exercise;
+                if (is_american)
                 {
-                    values_up[j] = continuation;
+                    exercise.resize(spot.size());
+                    for (std::size_t k = 0; k < spot.size(); ++k)
+                        exercise[k] = payoff(spot[k]);
                 }
+                for (int j = 0; j <= levels; ++j)
+                    values[j] = payoff(spot[2 * j]);
+                roll([&](int i, int j)
+                     { return exercise[levels + 2 * j - i]; });
             }
-        }
-
-        // Recompute price at S0 - dS (down value)
-        std::vector<Real> values_down(steps_ + 1);
-        for (int j = 0; j <= steps_; ++j)
-        {
-            const Real ST = (S0 - dS) * std::pow(u, j) * std::pow(d, steps_ - j);
-            values_down[j] = (*opt.payoff)(ST);
-        }
-        for (int i = steps_ - 1; i >= 0; --i)
-        {
-            for (int j = 0; j <= i; ++j)
+            else
             {
-                const Real S = (S0 - dS) * std::pow(u, j) * std::pow(d, i - j);
-                const Real continuation = df * (p * values_down[j + 1] + (1.0 - p) * values_down[j]);
-                if (is_american)
+                // u·d ≠ 1 (Leisen-Reimer): steps do not share levels.  Node j
+                // of step i is root·u^j·d^(i−j), from power tables built once.
+                std::vector<Real> up(levels + 1), down(levels + 1);
+                up[0] = down[0] = 1.0;
+                for (int k = 1; k <= levels; ++k)
                 {
-                    const Real exercise = (*opt.payoff)(S);
-                    values_down[j] = std::max(continuation, exercise);
-                }
-                else
-                {
-                    values_down[j] = continuation;
+                    up[k] = up[k - 1] * st.u;
+                    down[k] = down[k - 1] * st.d;
                 }
+                for (int j = 0; j <= levels; ++j)
+                    values[j] = payoff(root * up[j] * down[levels - j]);
+                roll([&](int i, int j)
+                     { return payoff(root * up[j] * down[i - j]); });
             }
+
+            const Real Su = S0 * st.u / st.d;
+            const Real Sd = S0 * st.d / st.u;
+            const Real delta_up = (v2u - v2m) / (Su - S0);
+            const Real delta_down = (v2m - v2d) / (S0 - Sd);
+
+            LatticeGreeks g;
+            g.npv = v2m;
+            g.delta = (v2u - v2d) / (Su - Sd);
+            g.gamma = (delta_up - delta_down) / (0.5 * (Su - Sd));
+            const Real shift = S0 - root;
+            const Real v0 = values[0] + g.delta * shift + 0.5 * g.gamma * shift * shift;
+            g.theta = (v2m - v0) / (2.0 * dt);
+            return g;
         }
+    } // namespace
 
-        // Centered finite difference
-        out.greeks.delta = opt.notional * (values_up[0] - values_down[0]) / (2.0 * dS);
-        out.greeks.gamma = opt.notional * (values_up[0] - 2.0 * values[0] + values_down[0]) / (dS * dS);
+    BinomialVanillaEngine::BinomialVanillaEngine(PricingContext ctx)
+        : EngineBase(std::move(ctx)), steps_(ctx_.settings.tree_steps)
+    {
+        if (steps_ < 1)
+            throw InvalidInput("Binomial tree requires steps >= 1");
+    }
 
-        // Vega: bump volatility by 1%
-        const Real dsigma = 0.01;
-        const Real sigma_bump = sigma + dsigma;
-        const Real u_bump = std::exp(sigma_bump * std::sqrt(dt));
-        const Real d_bump = 1.0 / u_bump;
-        const Real p_bump = (a - d_bump) / (u_bump - d_bump);
+    void BinomialVanillaEngine::visit(const VanillaOption &opt)
+    {
+        validate(opt);
+        const auto &m = require_model<ILocalVolModel>("BinomialVanillaEngine");
 
-        std::vector<Real> values_vega(steps_ + 1);
-        for (int j = 0; j <= steps_; ++j)
+        const Real S0 = m.spot0();
+        const Real r = m.rate_r();
+        const Real q = m.yield_q();
+        const Real sigma = m.vol_sigma();
+        const Real T = opt.exercise->dates().front();
+        const bool is_american = opt.exercise->type() == ExerciseType::American;
+
+        const TreeScheme scheme = ctx_.settings.tree_scheme;
+        const bool leisen_reimer = scheme == TreeScheme::LeisenReimer;
+        const Real K = opt.payoff->strike();
+
+        // Leisen-Reimer needs an odd number of steps.
+        const auto tree_steps = [&](int n)
+        { return leisen_reimer && n % 2 == 0 ? n + 1 : n; };
+
+        const auto run = [&](int n, Real vol)
         {
-            const Real ST = S0 * std::pow(u_bump, j) * std::pow(d_bump, steps_ - j);
-            values_vega[j] = (*opt.payoff)(ST);
-        }
-        for (int i = steps_ - 1; i >= 0; --i)
+            const Real dt = T / n;
+            const Real growth = std::exp((r - q) * dt);
+            const BinomialStep st = leisen_reimer ? leisen_reimer_step(S0, K, r, q, vol, T, n, growth)
+                                                  : crr_step(vol, dt, growth);
+            if (!(st.p >= 0.0 && st.p <= 1.0))
+                throw InvalidInput("Risk-neutral probability out of bounds [0,1]. Check model parameters.");
+            return roll_back_binomial(*opt.payoff, S0, st, m.discount_curve().discount(dt), dt, n, is_american);
+        };
+
+        const int n_fine = tree_steps(steps_);
+        LatticeGreeks g = run(n_fine, sigma);
+
+        // Vega: bump volatility by 1% (the lattice geometry depends on σ)
+        const Real dsigma = 0.01;
+        const Real vega = (run(n_fine, sigma + dsigma).npv - g.npv) / dsigma;
+
+        // Richardson: combine with a tree of about half the steps, assuming
+        // an error c/N^k with k = 2 for European Leisen-Reimer and k = 1
+        // otherwise (CRR, and the early-exercise boundary).  Only the price:
+        // the node-difference Greeks are taken on spacings that differ
+        // between the two trees, so their errors need not scale as the
+        // price's does, and they stay those of the fine tree.
+        int n_coarse = 0;
+        if (ctx_.settings.tree_richardson && steps_ >= 4)
         {
-            for (int j = 0; j <= i; ++j)
-            {
-                const Real S = S0 * std::pow(u_bump, j) * std::pow(d_bump, i - j);
-                const Real continuation = df * (p_bump * values_vega[j + 1] + (1.0 - p_bump) * values_vega[j]);
-                if (is_american)
-                {
-                    const Real exercise = (*opt.payoff)(S);
-                    values_vega[j] = std::max(continuation, exercise);
-                }
-                else
-                {
-                    values_vega[j] = continuation;
-                }
-            }
+            n_coarse = tree_steps(steps_ / 2);
+            const LatticeGreeks c = run(n_coarse, sigma);
+            const Real order = (leisen_reimer && !is_american) ? 2.0 : 1.0;
+            const Real wf = std::pow(static_cast<Real>(n_fine), order);
+            const Real wc = std::pow(static_cast<Real>(n_coarse), order);
+            const auto extrapolate = [&](Real fine, Real coarse)
+            { return (wf * fine - wc * coarse) / (wf - wc); };
+            g.npv = extrapolate(g.npv, c.npv);
         }
-        out.greeks.vega = opt.notional * (values_vega[0] - values[0]) / dsigma;
 
-        // Theta: approximate by stepping one time step forward
-        if (steps_ > 1)
-        {
-            const Real T_minus_dt = T - dt;
-            const int steps_minus_1 = steps_ - 1;
-            const Real dt_theta = T_minus_dt / steps_minus_1;
-            const Real u_theta = std::exp(sigma * std::sqrt(dt_theta));
-            const Real d_theta = 1.0 / u_theta;
-            const Real a_theta = std::exp((r - q) * dt_theta);
-            const Real p_theta = (a_theta - d_theta) / (u_theta - d_theta);
-            const Real df_theta = m.discount_curve().discount(dt_theta);
+        PricingResult out;
+        out.npv = opt.notional * g.npv;
+        out.greeks.delta = opt.notional * g.delta;
+        out.greeks.gamma = opt.notional * g.gamma;
+        out.greeks.theta = opt.notional * g.theta;
+        out.greeks.vega = opt.notional * vega;
 
-            std::vector<Real> values_theta(steps_);
-            for (int j = 0; j < steps_; ++j)
-            {
-                const Real ST = S0 * std::pow(u_theta, j) * std::pow(d_theta, steps_minus_1 - j);
-                values_theta[j] = (*opt.payoff)(ST);
-            }
-            for (int i = steps_minus_1 - 1; i >= 0; --i)
-            {
-                for (int j = 0; j <= i; ++j)
-                {
-                    const Real S = S0 * std::pow(u_theta, j) * std::pow(d_theta, i - j);
-                    const Real continuation = df_theta * (p_theta * values_theta[j + 1] + (1.0 - p_theta) * values_theta[j]);
-                    if (is_american)
-                    {
-                        const Real exercise = (*opt.payoff)(S);
-                        values_theta[j] = std::max(continuation, exercise);
-                    }
-                    else
-                    {
-                        values_theta[j] = continuation;
-                    }
-                }
-            }
-            out.greeks.theta = -opt.notional * (values[0] - values_theta[0]) / dt;
-        }
+        const char *exercise_label = is_american ? "American" : "European";
+        out.diagnostics = std::string("Binomial tree (") + (leisen_reimer ? "Leisen-Reimer" : "CRR") + ") " +
+                          exercise_label + " vanilla (steps=" + std::to_string(n_fine) +
+                          (n_coarse > 0 ? ", Richardson with " + std::to_string(n_coarse) : std::string()) + ")";
 
         res_ = out;
     }
@@ -8,6 +8,70 @@
 
 namespace quantModeling
 {
+    namespace
+    {
+        /// Option values read off an extended trinomial lattice that starts
+        /// one step before t = 0, so that step 1 holds S0·u, S0, S0/u at t = 0.
+        struct TrinomialNodes
+        {
+            Real v0;  ///< root: spot S0 at t = −Δt
+            Real v1d; ///< S0/u at t = 0
+            Real v1m; ///< S0 at t = 0 (the price)
+            Real v1u; ///< S0·u at t = 0
+        };
+
+        TrinomialNodes roll_back_trinomial(const IPayoff &payoff, Real S0, Real u, Real pu, Real pm,
+                                           Real pd, Real df, int steps, bool is_american)
+        {
+            const int levels = steps + 1;
+
+            // Spot lattice S0·u^j, j = −levels..levels, built by recurrence.
+            std::vector<Real> spot(2 * levels + 1);
+            spot[levels] = S0;
+            const Real d = 1.0 / u;
+            for (int k = 1; k <= levels; ++k)
+            {
+                spot[levels + k] = spot[levels + k - 1] * u;
+                spot[levels - k] = spot[levels - k + 1] * d;
+            }
+
+            std::vector<Real> exercise;
+            if (is_american)
+            {
+                exercise.resize(spot.size());
+                for (std::size_t k = 0; k < spot.size(); ++k)
+                    exercise[k] = payoff(spot[k]);
+            }
+
+            std::vector<Real> values(spot.size());
+            for (std::size_t k = 0; k < spot.size(); ++k)
+                values[k] = payoff(spot[k]);
+
+            TrinomialNodes nodes{};
+            for (int i = levels - 1; i >= 0; --i)
+            {
+                // Ascending j reads values[idx - 1] after it was overwritten,
+                // so keep the previous step's left neighbour aside.
+                Real left = values[levels - i - 1];
+                for (int idx = levels - i; idx <= levels + i; ++idx)
+                {
+                    const Real here = values[idx];
+                    const Real continuation = df * (pu * values[idx + 1] + pm * here + pd * left);
+                    values[idx] = is_american ? std::max(continuation, exercise[idx]) : continuation;
+                    left = here;
+                }
+                if (i == 1)
+                {
+                    nodes.v1d = values[levels - 1];
+                    nodes.v1m = values[levels];
+                    nodes.v1u = values[levels + 1];
+                }
+            }
+            nodes.v0 = values[levels];
+            return nodes;
+        }
+    } // namespace
+
     TrinomialVanillaEngine::TrinomialVanillaEngine(PricingContext ctx)
         : EngineBase(std::move(ctx)), steps_(ctx_.settings.tree_steps)
     {
@@ -49,184 +113,36 @@ namespace quantModeling
         if (!(pu >= 0.0 && pu <= 1.0 && pd >= 0.0 && pd <= 1.0 && pm >= 0.0 && pm <= 1.0))
             throw InvalidInput("Risk-neutral probabilities out of bounds. Check model parameters or reduce time step.");
 
-        // Tree values at maturity
-        const int max_nodes = 2 * steps_ + 1;
-        std::vector<Real> values(max_nodes);
-
-        // Initialize terminal values (at maturity, step N)
-        for (int j = -steps_; j <= steps_; ++j)
-        {
-            const Real ST = S0 * std::pow(u, j);
-            values[j + steps_] = (*opt.payoff)(ST);
-        }
-
-        // Backward induction through the tree
-        for (int i = steps_ - 1; i >= 0; --i)
-        {
-            for (int j = -i; j <= i; ++j)
-            {
-                const Real S = S0 * std::pow(u, j);
-
-                // Continuation value (risk-neutral expectation)
-                const int idx = j + steps_;
-                const Real continuation = df * (pu * values[idx + 1] + pm * values[idx] + pd * values[idx - 1]);
-
-                // For American: check early exercise, for European: use continuation
-                if (is_american)
-                {
-                    const Real exercise = (*opt.payoff)(S);
-                    values[idx] = std::max(continuation, exercise);
-                }
-                else
-                {
-                    values[idx] = continuation;
-                }
-            }
-        }
+        // One backward pass on the extended lattice gives the price and,
+        // from the t = 0 and t = −Δt nodes, delta, gamma and theta.
+        const TrinomialNodes nodes = roll_back_trinomial(*opt.payoff, S0, u, pu, pm, pd, df, steps_, is_american);
 
         PricingResult out;
-        out.npv = opt.notional * values[steps_];
+        out.npv = opt.notional * nodes.v1m;
 
         const char *exercise_label = is_american ? "American" : "European";
         out.diagnostics = std::string("Trinomial tree (Boyle) ") + exercise_label +
                           " vanilla (steps=" + std::to_string(steps_) + ")";
 
-        // Greeks via finite differences
-        const Real dS = S0 * 0.01;
+        const Real Su = S0 * u;
+        const Real Sd = S0 / u;
+        const Real delta_up = (nodes.v1u - nodes.v1m) / (Su - S0);
+        const Real delta_down = (nodes.v1m - nodes.v1d) / (S0 - Sd);
+        out.greeks.delta = opt.notional * (nodes.v1u - nodes.v1d) / (Su - Sd);
+        out.greeks.gamma = opt.notional * (delta_up - delta_down) / (0.5 * (Su - Sd));
+        out.greeks.theta = opt.notional * (nodes.v1m - nodes.v0) / dt;
 
-        // Recompute price at S0 + dS
-        std::vector<Real> values_up(max_nodes);
-        for (int j = -steps_; j <= steps_; ++j)
-        {
-            const Real ST = (S0 + dS) * std::pow(u, j);
-            values_up[j + steps_] = (*opt.payoff)(ST);
-        }
-        for (int i = steps_ - 1; i >= 0; --i)
-        {
-            for (int j = -i; j <= i; ++j)
-            {
-                const Real S = (S0 + dS) * std::pow(u, j);
-                const int idx = j + steps_;
-                const Real continuation = df * (pu * values_up[idx + 1] + pm * values_up[idx] + pd * values_up[idx - 1]);
-                if (is_american)
-                {
-                    const Real exercise = (*opt.payoff)(S);
-                    values_up[idx] = std::max(continuation, exercise);
-                }
-                else
-                {
-                    values_up[idx] = continuation;
-                }
-            }
-        }
-
-        // Recompute price at S0 - dS
-        std::vector<Real> values_down(max_nodes);
-        for (int j = -steps_; j <= steps_; ++j)
-        {
-            const Real ST = (S0 - dS) * std::pow(u, j);
-            values_down[j + steps_] = (*opt.payoff)(ST);
-        }
-        for (int i = steps_ - 1; i >= 0; --i)
-        {
-            for (int j = -i; j <= i; ++j)
-            {
-                const Real S = (S0 - dS) * std::pow(u, j);
-                const int idx = j + steps_;
-                const Real continuation = df * (pu * values_down[idx + 1] + pm * values_down[idx] + pd * values_down[idx - 1]);
-                if (is_american)
-                {
-                    const Real exercise = (*opt.payoff)(S);
-                    values_down[idx] = std::max(continuation, exercise);
-                }
-                else
-                {
-                    values_down[idx] = continuation;
-                }
-            }
-        }
-
-        // Delta and Gamma
-        out.greeks.delta = opt.notional * (values_up[steps_] - values_down[steps_]) / (2.0 * dS);
-        out.greeks.gamma = opt.notional * (values_up[steps_] - 2.0 * values[steps_] + values_down[steps_]) / (dS * dS);
-
-        // Vega: bump volatility
+        // Vega: bump volatility (the lattice geometry depends on σ)
         const Real dsigma = 0.01;
         const Real sigma_bump = sigma + dsigma;
         const Real u_vega = std::exp(sigma_bump * std::sqrt(3.0 * dt));
-        // const Real d_vega = 1.0 / u_vega;  // Unused (kept for reference)
         const Real dx_vega = sigma_bump * std::sqrt(3.0 * dt);
         const Real pu_vega = 0.5 * ((sigma_bump * sigma_bump * dt + nu * nu * dt * dt) / (dx_vega * dx_vega) + nu * dt / dx_vega);
         const Real pd_vega = 0.5 * ((sigma_bump * sigma_bump * dt + nu * nu * dt * dt) / (dx_vega * dx_vega) - nu * dt / dx_vega);
         const Real pm_vega = 1.0 - pu_vega - pd_vega;
-
-        std::vector<Real> values_vega(max_nodes);
-        for (int j = -steps_; j <= steps_; ++j)
-        {
-            const Real ST = S0 * std::pow(u_vega, j);
-            values_vega[j + steps_] = (*opt.payoff)(ST);
-        }
-        for (int i = steps_ - 1; i >= 0; --i)
-        {
-            for (int j = -i; j <= i; ++j)
-            {
-                const Real S = S0 * std::pow(u_vega, j);
-                const int idx = j + steps_;
-                const Real continuation = df * (pu_vega * values_vega[idx + 1] + pm_vega * values_vega[idx] + pd_vega * values_vega[idx - 1]);
-                if (is_american)
-                {
-                    const Real exercise = (*opt.payoff)(S);
-                    values_vega[idx] = std::max(continuation, exercise);
-                }
-                else
-                {
-                    values_vega[idx] = continuation;
-                }
-            }
-        }
-        out.greeks.vega = opt.notional * (values_vega[steps_] - values[steps_]) / dsigma;
-
-        // Theta: approximate with one less time step
-        if (steps_ > 1)
-        {
-            const Real T_minus_dt = T - dt;
-            const int steps_minus_1 = steps_ - 1;
-            const Real dt_theta = T_minus_dt / steps_minus_1;
-            const Real u_theta = std::exp(sigma * std::sqrt(3.0 * dt_theta));
-            // const Real d_theta = 1.0 / u_theta;  // Unused (kept for reference)
-            const Real dx_theta = sigma * std::sqrt(3.0 * dt_theta);
-            const Real pu_theta = 0.5 * ((sigma * sigma * dt_theta + nu * nu * dt_theta * dt_theta) / (dx_theta * dx_theta) + nu * dt_theta / dx_theta);
-            const Real pd_theta = 0.5 * ((sigma * sigma * dt_theta + nu * nu * dt_theta * dt_theta) / (dx_theta * dx_theta) - nu * dt_theta / dx_theta);
-            const Real pm_theta = 1.0 - pu_theta - pd_theta;
-            const Real df_theta = m.discount_curve().discount(dt_theta);
-
-            const int max_nodes_theta = 2 * steps_minus_1 + 1;
-            std::vector<Real> values_theta(max_nodes_theta);
-            for (int j = -steps_minus_1; j <= steps_minus_1; ++j)
-            {
-                const Real ST = S0 * std::pow(u_theta, j);
-                values_theta[j + steps_minus_1] = (*opt.payoff)(ST);
-            }
-            for (int i = steps_minus_1 - 1; i >= 0; --i)
-            {
-                for (int j = -i; j <= i; ++j)
-                {
-                    const Real S = S0 * std::pow(u_theta, j);
-                    const int idx = j + steps_minus_1;
-                    const Real continuation = df_theta * (pu_theta * values_theta[idx + 1] + pm_theta * values_theta[idx] + pd_theta * values_theta[idx - 1]);
-                    if (is_american)
-                    {
-                        const Real exercise = (*opt.payoff)(S);
-                        values_theta[idx] = std::max(continuation, exercise);
-                    }
-                    else
-                    {
-                        values_theta[idx] = continuation;
-                    }
-                }
-            }
-            out.greeks.theta = -opt.notional * (values[steps_] - values_theta[steps_minus_1]) / dt;
-        }
+        const TrinomialNodes bumped = roll_back_trinomial(*opt.payoff, S0, u_vega, pu_vega, pm_vega, pd_vega, df,
+                                                          steps_, is_american);
+        out.greeks.vega = opt.notional * (bumped.v1m - nodes.v1m) / dsigma;
 
         res_ = out;
     }
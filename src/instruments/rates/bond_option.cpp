@@ -1 +1,41 @@
 #include "quantModeling/instruments/rates/bond_option.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace quantModeling
+{
+
+    void BondOption::cash_flows_after_expiry(std::vector<Time> &times,
+                                             std::vector<Real> &amounts) const
+    {
+        times.clear();
+        amounts.clear();
+
+        if (coupon_rate == 0.0)
+        {
+            times.push_back(bond_maturity);
+            amounts.push_back(1.0);
+            return;
+        }
+
+        if (coupon_frequency <= 0)
+            throw InvalidInput("BondOption: coupon_frequency must be > 0");
+
+        // Same coupon grid as FixedRateBond: n = round(S · freq), Δ = S / n.
+        const int n = std::max(1, static_cast<int>(std::round(
+                                      bond_maturity * static_cast<Real>(coupon_frequency))));
+        const Real dt = bond_maturity / static_cast<Real>(n);
+        const Real coupon = coupon_rate * dt;
+
+        for (int i = 1; i <= n; ++i)
+        {
+            const Time t = dt * static_cast<Real>(i);
+            if (t <= option_maturity)
+                continue;
+            times.push_back(t);
+            amounts.push_back(i == n ? 1.0 + coupon : coupon);
+        }
+    }
+
+} // namespace quantModeling
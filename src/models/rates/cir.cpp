@@ -45,17 +45,22 @@ namespace quantModeling
     }
 
     // ── A(τ) = [2γ e^{(a+γ)τ/2} / ((γ+a)(e^{γτ}−1) + 2γ)]^{2ab/σ²} ───────
+    //
+    //  The bracket is 1 + O(σ²) while the exponent is O(1/σ²), so it is
+    //  evaluated in log form with ε = γ − a = 2σ²/(γ + a):
+    //    ln[·] = ln(1 + ε/(γ+a)) − ετ/2 − ln(1 + ε e^{−γτ}/(γ+a))
 
     Real CIRModel::A(Real tau) const
     {
         if (tau <= 0.0)
             return 1.0;
         const Real g = gamma();
+        const Real eps = 2.0 * sigma_ * sigma_ / (g + a_);
         const Real egt = std::exp(g * tau);
-        const Real denom = (g + a_) * (egt - 1.0) + 2.0 * g;
-        const Real numer = 2.0 * g * std::exp((a_ + g) * tau * 0.5);
+        const Real ln_ratio = std::log1p(eps / (g + a_)) - 0.5 * eps * tau -
+                              std::log1p(eps / ((g + a_) * egt));
         const Real exponent = 2.0 * a_ * b_ / (sigma_ * sigma_);
-        return std::pow(numer / denom, exponent);
+        return std::exp(exponent * ln_ratio);
     }
 
     // ── P(0, T) ──────────────────────────────────────────────────────────────
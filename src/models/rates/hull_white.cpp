@@ -53,6 +53,13 @@ namespace quantModeling
 
     // ── Bond option (same algebra as Vasicek with b ← θ/a) ──────────────────
 
+    std::optional<Real> HullWhiteModel::bond_option_vol(Time T_option, Time T_bond) const
+    {
+        return (sigma_ / a_) *
+               (1.0 - std::exp(-a_ * (T_bond - T_option))) *
+               std::sqrt((1.0 - std::exp(-2.0 * a_ * T_option)) / (2.0 * a_));
+    }
+
     Real HullWhiteModel::bond_option_price(bool is_call, Real K,
                                            Time T_option, Time T_bond) const
     {
@@ -66,9 +73,7 @@ namespace quantModeling
         const Real P0S = zcb_price(T_bond);
         const Real P0T = zcb_price(T_option);
 
-        const Real sigma_p = (sigma_ / a_) *
-                             (1.0 - std::exp(-a_ * (T_bond - T_option))) *
-                             std::sqrt((1.0 - std::exp(-2.0 * a_ * T_option)) / (2.0 * a_));
+        const Real sigma_p = *bond_option_vol(T_option, T_bond);
 
         const Real h = (1.0 / sigma_p) * std::log(P0S / (K * P0T)) + 0.5 * sigma_p;
 
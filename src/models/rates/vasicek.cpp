@@ -61,6 +61,13 @@ namespace quantModeling
     //   Call = P(0,S) N(h) − K P(0,T) N(h − σ_p)
     //   Put  = K P(0,T) N(−h + σ_p) − P(0,S) N(−h)
 
+    std::optional<Real> VasicekModel::bond_option_vol(Time T_option, Time T_bond) const
+    {
+        return (sigma_ / a_) *
+               (1.0 - std::exp(-a_ * (T_bond - T_option))) *
+               std::sqrt((1.0 - std::exp(-2.0 * a_ * T_option)) / (2.0 * a_));
+    }
+
     Real VasicekModel::bond_option_price(bool is_call, Real K,
                                          Time T_option, Time T_bond) const
     {
@@ -74,9 +81,7 @@ namespace quantModeling
         const Real P0S = zcb_price(T_bond);
         const Real P0T = zcb_price(T_option);
 
-        const Real sigma_p = (sigma_ / a_) *
-                             (1.0 - std::exp(-a_ * (T_bond - T_option))) *
-                             std::sqrt((1.0 - std::exp(-2.0 * a_ * T_option)) / (2.0 * a_));
+        const Real sigma_p = *bond_option_vol(T_option, T_bond);
 
         const Real h = (1.0 / sigma_p) * std::log(P0S / (K * P0T)) + 0.5 * sigma_p;
 
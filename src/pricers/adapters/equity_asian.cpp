@@ -2,6 +2,7 @@
 
 #include "quantModeling/engines/analytic/asian.hpp"
 #include "quantModeling/engines/mc/asian.hpp"
+#include "quantModeling/engines/pde/asian.hpp"
 #include "quantModeling/instruments/equity/asian.hpp"
 #include "quantModeling/models/equity/black_scholes.hpp"
 #include "quantModeling/pricers/context.hpp"
@@ -41,13 +42,14 @@ namespace quantModeling
 
         MarketView market = {};
         const bool use_mc = engine == EngineKind::MonteCarlo;
+        const bool use_pde = engine == EngineKind::PDEFiniteDifference;
         PricingSettings settings = {
             use_mc ? in.n_paths : 0,
             use_mc ? in.seed : 0,
             true,
-            0,  // tree_steps
-            0,  // pde_space_steps
-            0}; // pde_time_steps
+            0,                                 // tree_steps
+            use_pde ? in.pde_space_steps : 0,  // pde_space_steps
+            use_pde ? in.pde_time_steps : 0};  // pde_time_steps
 
         PricingContext ctx{market, settings, model};
 
@@ -57,6 +59,12 @@ namespace quantModeling
             return price(opt, mc_engine);
         }
 
+        if (use_pde)
+        {
+            PDEAsianEngine pde_engine(ctx);
+            return price(opt, pde_engine);
+        }
+
         if (in.average_type == AsianAverageType::Arithmetic)
         {
             BSEuroArithmeticAsianAnalyticEngine analytic_engine(ctx);
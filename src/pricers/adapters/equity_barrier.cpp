@@ -1,6 +1,8 @@
 #include "quantModeling/pricers/adapters/equity_barrier.hpp"
 
+#include "quantModeling/engines/analytic/barrier.hpp"
 #include "quantModeling/engines/mc/barrier.hpp"
+#include "quantModeling/engines/pde/barrier.hpp"
 #include "quantModeling/instruments/equity/barrier.hpp"
 #include "quantModeling/instruments/equity/vanilla.hpp"
 #include "quantModeling/models/equity/black_scholes.hpp"
@@ -51,4 +53,66 @@ namespace quantModeling
         return price(opt, engine);
     }
 
+    PricingResult price_equity_barrier_bs_analytic(const BarrierBSInput &in)
+    {
+        auto payoff = std::make_shared<PlainVanillaPayoff>(
+            in.is_call ? OptionType::Call : OptionType::Put,
+            static_cast<Real>(in.strike));
+        auto exercise = std::make_shared<EuropeanExercise>(
+            static_cast<Real>(in.maturity));
+
+        BarrierOption opt(payoff, exercise,
+                          in.barrier_type,
+                          static_cast<Real>(in.barrier_level),
+                          static_cast<Real>(in.rebate),
+                          1.0);
+        opt.n_steps = in.n_steps;
+        opt.brownian_bridge = in.brownian_bridge;
+
+        auto model = std::make_shared<BlackScholesModel>(
+            static_cast<Real>(in.spot),
+            static_cast<Real>(in.rate),
+            static_cast<Real>(in.dividend),
+            static_cast<Real>(in.vol));
+
+        PricingSettings settings;
+        MarketView market = {};
+        PricingContext ctx{market, settings, model};
+
+        BSBarrierAnalyticEngine engine(ctx);
+        return price(opt, engine);
+    }
+
+    PricingResult price_equity_barrier_bs_pde(const BarrierBSInput &in)
+    {
+        auto payoff = std::make_shared<PlainVanillaPayoff>(
+            in.is_call ? OptionType::Call : OptionType::Put,
+            static_cast<Real>(in.strike));
+        auto exercise = std::make_shared<EuropeanExercise>(
+            static_cast<Real>(in.maturity));
+
+        BarrierOption opt(payoff, exercise,
+                          in.barrier_type,
+                          static_cast<Real>(in.barrier_level),
+                          static_cast<Real>(in.rebate),
+                          1.0);
+        opt.n_steps = in.n_steps;
+        opt.brownian_bridge = in.brownian_bridge;
+
+        auto model = std::make_shared<BlackScholesModel>(
+            static_cast<Real>(in.spot),
+            static_cast<Real>(in.rate),
+            static_cast<Real>(in.dividend),
+            static_cast<Real>(in.vol));
+
+        PricingSettings settings;
+        settings.pde_space_steps = in.pde_space_steps;
+        settings.pde_time_steps = in.pde_time_steps;
+        MarketView market = {};
+        PricingContext ctx{market, settings, model};
+
+        PDEBarrierEngine engine(ctx);
+        return price(opt, engine);
+    }
+
 } // namespace quantModeling
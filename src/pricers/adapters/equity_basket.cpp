@@ -1,6 +1,8 @@
 #include "quantModeling/pricers/adapters/equity_basket.hpp"
 
+#include "quantModeling/engines/analytic/basket.hpp"
 #include "quantModeling/engines/mc/basket.hpp"
+#include "quantModeling/engines/pde/two_asset.hpp"
 #include "quantModeling/instruments/equity/basket.hpp"
 #include "quantModeling/instruments/equity/vanilla.hpp"
 #include "quantModeling/models/equity/multi_asset_bs_model.hpp"
@@ -14,9 +16,9 @@
 namespace quantModeling
 {
 
-    PricingResult price_equity_basket_bs_mc(const BasketBSInput &in)
+    std::shared_ptr<MultiAssetBSModel> make_basket_bs_model(const BasketBSInput &in)
     {
-        // ── Validate dimensions ───────────────────────────────────────
+        // ── Validate dimensions ───────────────────────────────────
         const int n = static_cast<int>(in.spots.size());
         if (n < 2)
             throw InvalidInput("BasketBSInput: need at least 2 assets");
@@ -27,7 +29,7 @@ namespace quantModeling
         if (static_cast<int>(in.weights.size()) != n)
             throw InvalidInput("BasketBSInput: weights.size() != spots.size()");
 
-        // ── Build correlation matrix ──────────────────────────────────
+        // ── Build correlation matrix ──────────────────────────────
         // correlations may be:
         //   - n×n full matrix (in.correlations.size() == n)
         //   - empty → identity (zero pairwise correlation)
@@ -49,13 +51,15 @@ namespace quantModeling
             }
         }
 
-        // ── Build model (Cholesky inside constructor) ─────────────────
-        auto model = std::make_shared<MultiAssetBSModel>(
+        // ── Build model (Cholesky inside constructor) ─────────────
+        return std::make_shared<MultiAssetBSModel>(
             static_cast<Real>(in.rate),
             in.spots, in.vols, in.dividends,
             corr);
+    }
 
-        // ── Build instrument ──────────────────────────────────────────
+    BasketOption make_basket_bs_option(const BasketBSInput &in)
+    {
         auto payoff = std::make_shared<PlainVanillaPayoff>(
             in.is_call ? OptionType::Call : OptionType::Put,
             static_cast<Real>(in.strike));
@@ -63,7 +67,13 @@ namespace quantModeling
         auto exercise = std::make_shared<EuropeanExercise>(
             static_cast<Real>(in.maturity));
 
-        BasketOption opt(payoff, exercise, in.weights, 1.0);
+        return BasketOption(payoff, exercise, in.weights, 1.0);
+    }
+
+    PricingResult price_equity_basket_bs_mc(const BasketBSInput &in)
+    {
+        auto model = make_basket_bs_model(in);
+        const BasketOption opt = make_basket_bs_option(in);
 
         // ── Pricing context ───────────────────────────────────────────
         PricingSettings settings;
@@ -78,4 +88,34 @@ namespace quantModeling
         return price(opt, engine);
     }
 
+    PricingResult price_equity_basket_bs_analytic(const BasketBSInput &in)
+    {
+        auto model = make_basket_bs_model(in);
+        const BasketOption opt = make_basket_bs_option(in);
+
+        PricingSettings settings;
+        MarketView market = {};
+        PricingContext ctx{market, settings, model};
+
+        BSBasketAnalyticEngine engine(ctx, in.ju_correction ? BasketMomentMatching::Ju
+                                                            : BasketMomentMatching::Levy);
+        return price(opt, engine);
+    }
+
+    PricingResult price_equity_basket_bs_pde(const BasketBSInput &in)
+    {
+        auto model = make_basket_bs_model(in);
+        const BasketOption opt = make_basket_bs_option(in);
+
+        PricingSettings settings;
+        settings.pde_space_steps = in.pde_space_steps;
+        settings.pde_time_steps = in.pde_time_steps;
+        settings.pde_threads = in.pde_threads;
+        MarketView market = {};
+        PricingContext ctx{market, settings, model};
+
+        PDETwoAssetEngine engine(ctx);
+        return price(opt, engine);
+    }
+
 } // namespace quantModeling
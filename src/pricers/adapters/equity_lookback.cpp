@@ -1,5 +1,6 @@
 #include "quantModeling/pricers/adapters/equity_lookback.hpp"
 
+#include "quantModeling/engines/analytic/lookback.hpp"
 #include "quantModeling/engines/mc/lookback.hpp"
 #include "quantModeling/instruments/equity/lookback.hpp"
 #include "quantModeling/instruments/equity/vanilla.hpp"
@@ -42,4 +43,31 @@ namespace quantModeling
         return price(opt, engine);
     }
 
+    PricingResult price_equity_lookback_bs_analytic(const LookbackBSInput &in)
+    {
+        auto payoff = std::make_shared<PlainVanillaPayoff>(
+            in.is_call ? OptionType::Call : OptionType::Put,
+            static_cast<Real>(in.strike));
+
+        auto exercise = std::make_shared<EuropeanExercise>(
+            static_cast<Real>(in.maturity));
+
+        LookbackOption opt(payoff, exercise, in.style, in.extremum, 1.0);
+        opt.n_steps = in.n_steps;
+        opt.continuous_monitoring = in.continuous_monitoring;
+
+        auto model = std::make_shared<BlackScholesModel>(
+            static_cast<Real>(in.spot),
+            static_cast<Real>(in.rate),
+            static_cast<Real>(in.dividend),
+            static_cast<Real>(in.vol));
+
+        PricingSettings settings;
+        MarketView market = {};
+        PricingContext ctx{market, settings, model};
+
+        BSLookbackAnalyticEngine engine(ctx);
+        return price(opt, engine);
+    }
+
 } // namespace quantModeling
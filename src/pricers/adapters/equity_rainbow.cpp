@@ -1,6 +1,8 @@
 #include "quantModeling/pricers/adapters/equity_rainbow.hpp"
 
+#include "quantModeling/engines/analytic/rainbow.hpp"
 #include "quantModeling/engines/mc/rainbow.hpp"
+#include "quantModeling/engines/pde/two_asset.hpp"
 #include "quantModeling/instruments/equity/rainbow.hpp"
 #include "quantModeling/models/equity/multi_asset_bs_model.hpp"
 #include "quantModeling/pricers/context.hpp"
@@ -12,44 +14,53 @@
 namespace quantModeling
 {
 
-    namespace
+    std::shared_ptr<MultiAssetBSModel> make_rainbow_bs_model(const RainbowBSInput &in)
     {
-        std::shared_ptr<MultiAssetBSModel> build_model(const RainbowBSInput &in)
-        {
-            const auto n = static_cast<int>(in.spots.size());
-            if (n < 2)
-                throw InvalidInput("RainbowBSInput: need at least 2 assets");
-            if (static_cast<int>(in.vols.size()) != n)
-                throw InvalidInput("RainbowBSInput: vols.size() != spots.size()");
-            if (static_cast<int>(in.dividends.size()) != n)
-                throw InvalidInput("RainbowBSInput: dividends.size() != spots.size()");
+        const auto n = static_cast<int>(in.spots.size());
+        if (n < 2)
+            throw InvalidInput("RainbowBSInput: need at least 2 assets");
+        if (static_cast<int>(in.vols.size()) != n)
+            throw InvalidInput("RainbowBSInput: vols.size() != spots.size()");
+        if (static_cast<int>(in.dividends.size()) != n)
+            throw InvalidInput("RainbowBSInput: dividends.size() != spots.size()");
 
-            Eigen::MatrixXd corr(n, n);
-            if (in.correlations.empty())
-            {
-                corr.setIdentity();
-            }
-            else
+        Eigen::MatrixXd corr(n, n);
+        if (in.correlations.empty())
+        {
+            corr.setIdentity();
+        }
+        else
+        {
+            if (static_cast<int>(in.correlations.size()) != n)
+                throw InvalidInput("RainbowBSInput: correlations must be n×n or empty");
+            for (int i = 0; i < n; ++i)
             {
-                if (static_cast<int>(in.correlations.size()) != n)
-                    throw InvalidInput("RainbowBSInput: correlations must be n×n or empty");
-                for (int i = 0; i < n; ++i)
-                {
-                    if (static_cast<int>(in.correlations[i].size()) != n)
-                        throw InvalidInput("RainbowBSInput: correlations row size mismatch");
-                    for (int j = 0; j < n; ++j)
-                        corr(i, j) = in.correlations[i][j];
-                }
+                if (static_cast<int>(in.correlations[i].size()) != n)
+                    throw InvalidInput("RainbowBSInput: correlations row size mismatch");
+                for (int j = 0; j < n; ++j)
+                    corr(i, j) = in.correlations[i][j];
             }
+        }
 
-            return std::make_shared<MultiAssetBSModel>(
-                in.rate, in.spots, in.vols, in.dividends, corr);
+        return std::make_shared<MultiAssetBSModel>(
+            in.rate, in.spots, in.vols, in.dividends, corr);
+    }
+
+    namespace
+    {
+        PricingSettings pde_settings(const RainbowBSInput &in)
+        {
+            PricingSettings settings;
+            settings.pde_space_steps = in.pde_space_steps;
+            settings.pde_time_steps = in.pde_time_steps;
+            settings.pde_threads = in.pde_threads;
+            return settings;
         }
     } // anonymous namespace
 
     PricingResult price_worst_of_bs_mc(const RainbowBSInput &in)
     {
-        auto model = build_model(in);
+        auto model = make_rainbow_bs_model(in);
         WorstOfOption opt(in.maturity, in.strike, in.is_call, in.notional);
         PricingSettings settings;
         settings.mc_paths = in.n_paths;
@@ -61,7 +72,7 @@ namespace quantModeling
 
     PricingResult price_best_of_bs_mc(const RainbowBSInput &in)
     {
-        auto model = build_model(in);
+        auto model = make_rainbow_bs_model(in);
         BestOfOption opt(in.maturity, in.strike, in.is_call, in.notional);
         PricingSettings settings;
         settings.mc_paths = in.n_paths;
@@ -71,4 +82,40 @@ namespace quantModeling
         return price(opt, engine);
     }
 
+    PricingResult price_worst_of_bs_analytic(const RainbowBSInput &in)
+    {
+        auto model = make_rainbow_bs_model(in);
+        WorstOfOption opt(in.maturity, in.strike, in.is_call, in.notional);
+        PricingContext ctx{MarketView{}, PricingSettings{}, model};
+        RainbowAnalyticEngine engine(ctx);
+        return price(opt, engine);
+    }
+
+    PricingResult price_best_of_bs_analytic(const RainbowBSInput &in)
+    {
+        auto model = make_rainbow_bs_model(in);
+        BestOfOption opt(in.maturity, in.strike, in.is_call, in.notional);
+        PricingContext ctx{MarketView{}, PricingSettings{}, model};
+        RainbowAnalyticEngine engine(ctx);
+        return price(opt, engine);
+    }
+
+    PricingResult price_worst_of_bs_pde(const RainbowBSInput &in)
+    {
+        auto model = make_rainbow_bs_model(in);
+        WorstOfOption opt(in.maturity, in.strike, in.is_call, in.notional);
+        PricingContext ctx{MarketView{}, pde_settings(in), model};
+        PDETwoAssetEngine engine(ctx);
+        return price(opt, engine);
+    }
+
+    PricingResult price_best_of_bs_pde(const RainbowBSInput &in)
+    {
+        auto model = make_rainbow_bs_model(in);
+        BestOfOption opt(in.maturity, in.strike, in.is_call, in.notional);
+        PricingContext ctx{MarketView{}, pde_settings(in), model};
+        PDETwoAssetEngine engine(ctx);
+        return price(opt, engine);
+    }
+
 } // namespace quantModeling
@@ -1,6 +1,7 @@
 #include "quantModeling/pricers/adapters/equity_vanilla.hpp"
 
 #include "quantModeling/engines/analytic/black_scholes.hpp"
+#include "quantModeling/engines/analytic/black_scholes_batch.hpp"
 #include "quantModeling/engines/mc/black_scholes.hpp"
 #include "quantModeling/engines/pde/european_vanilla.hpp"
 #include "quantModeling/engines/tree/binomial.hpp"
@@ -44,6 +45,8 @@ namespace quantModeling
             in.tree_steps,
             in.pde_space_steps,
             in.pde_time_steps};
+        settings.tree_scheme = in.tree_leisen_reimer ? TreeScheme::LeisenReimer : TreeScheme::CRR;
+        settings.tree_richardson = in.tree_richardson;
 
         PricingContext ctx{market, settings, model};
 
@@ -72,4 +75,28 @@ namespace quantModeling
         return price(opt, analytic_engine);
     }
 
+    VanillaBSBatchResult price_equity_vanilla_bs_batch(const VanillaBSBatchInput &in)
+    {
+        const std::size_t n = in.spot.size();
+        if (in.strike.size() != n || in.maturity.size() != n || in.rate.size() != n ||
+            in.dividend.size() != n || in.vol.size() != n || in.is_call.size() != n)
+            throw InvalidInput("price_equity_vanilla_bs_batch: input arrays must have equal length");
+
+        VanillaBSBatchResult res;
+        res.npv.resize(n);
+        res.delta.resize(n);
+        res.gamma.resize(n);
+        res.vega.resize(n);
+        res.theta.resize(n);
+        res.rho.resize(n);
+
+        BSBatchInputView view{n, in.spot.data(), in.strike.data(), in.maturity.data(),
+                              in.rate.data(), in.dividend.data(), in.vol.data(),
+                              in.is_call.data()};
+        BSBatchOutputView out{res.npv.data(), res.delta.data(), res.gamma.data(),
+                              res.vega.data(), res.theta.data(), res.rho.data()};
+        price_bs_batch(view, out);
+        return res;
+    }
+
 } // namespace quantModeling
@@ -1,5 +1,7 @@
 #include "quantModeling/pricers/adapters/equity_vanilla_american.hpp"
 
+#include "quantModeling/engines/analytic/american.hpp"
+#include "quantModeling/engines/pde/european_vanilla.hpp"
 #include "quantModeling/engines/tree/binomial.hpp"
 #include "quantModeling/engines/tree/trinomial.hpp"
 #include "quantModeling/instruments/equity/vanilla.hpp"
@@ -36,6 +38,8 @@ namespace quantModeling
             in.tree_steps,
             in.pde_space_steps,
             in.pde_time_steps};
+        settings.tree_scheme = in.tree_leisen_reimer ? TreeScheme::LeisenReimer : TreeScheme::CRR;
+        settings.tree_richardson = in.tree_richardson;
         PricingContext ctx{market, settings, model};
 
         switch (engine)
@@ -50,9 +54,18 @@ namespace quantModeling
             TrinomialVanillaEngine trinomial_engine(ctx);
             return price(opt, trinomial_engine);
         }
+        case EngineKind::Analytic:
+        {
+            const AmericanAnalyticScheme scheme =
+                in.baw_approximation ? AmericanAnalyticScheme::BaroneAdesiWhaley
+                                     : AmericanAnalyticScheme::ALOAccurate;
+            BSAmericanAnalyticEngine analytic_engine(ctx, scheme);
+            return price(opt, analytic_engine);
+        }
         case EngineKind::PDEFiniteDifference:
         {
-            throw UnsupportedInstrument("PDE finite difference method is only supported for European vanilla options");
+            PDEEuropeanVanillaEngine pde_engine(ctx);
+            return price(opt, pde_engine);
         }
         default:
             throw InvalidInput("Unsupported engine for American vanilla options");
@@ -0,0 +1,47 @@
+#include "quantModeling/pricers/adapters/equity_vanilla_lv.hpp"
+
+#include "quantModeling/engines/pde/european_vanilla.hpp"
+#include "quantModeling/instruments/equity/vanilla.hpp"
+#include "quantModeling/models/equity/dupire.hpp"
+#include "quantModeling/pricers/context.hpp"
+#include "quantModeling/pricers/pricer.hpp"
+
+#include <memory>
+
+namespace quantModeling
+{
+
+    PricingResult price_equity_vanilla_lv_pde(const LocalVolInput &in, bool american)
+    {
+        auto payoff = std::make_shared<PlainVanillaPayoff>(
+            in.is_call ? OptionType::Call : OptionType::Put,
+            static_cast<Real>(in.strike));
+
+        std::shared_ptr<IExercise> exercise;
+        if (american)
+            exercise = std::make_shared<AmericanExercise>(static_cast<Real>(in.maturity));
+        else
+            exercise = std::make_shared<EuropeanExercise>(static_cast<Real>(in.maturity));
+
+        VanillaOption opt(payoff, exercise, 1.0);
+
+        auto model = std::make_shared<DupireModel>(
+            static_cast<Real>(in.spot),
+            static_cast<Real>(in.rate),
+            static_cast<Real>(in.dividend),
+            in.K_grid,
+            in.T_grid,
+            in.sigma_loc_flat);
+
+        PricingSettings settings;
+        settings.pde_space_steps = in.pde_space_steps;
+        settings.pde_time_steps = in.pde_time_steps;
+
+        MarketView market = {};
+        PricingContext ctx{market, settings, model};
+
+        PDEEuropeanVanillaEngine engine(ctx);
+        return price(opt, engine);
+    }
+
+} // namespace quantModeling
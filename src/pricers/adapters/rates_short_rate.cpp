@@ -75,6 +75,8 @@ namespace quantModeling
     {
         auto model = make_short_rate_model(in.model_type, in.a, in.b, in.sigma, in.r0);
         BondOption opt(in.option_maturity, in.bond_maturity, in.strike, in.is_call, in.notional);
+        opt.coupon_rate = in.coupon_rate;
+        opt.coupon_frequency = in.coupon_frequency;
         auto ctx = make_context(model);
         ShortRateAnalyticEngine engine(ctx);
         return price(opt, engine);
@@ -86,6 +88,8 @@ namespace quantModeling
     {
         auto model = make_short_rate_model(in.model_type, in.a, in.b, in.sigma, in.r0);
         BondOption opt(in.option_maturity, in.bond_maturity, in.strike, in.is_call, in.notional);
+        opt.coupon_rate = in.coupon_rate;
+        opt.coupon_frequency = in.coupon_frequency;
         PricingSettings settings;
         settings.mc_paths = in.n_paths;
         settings.mc_seed = in.seed;
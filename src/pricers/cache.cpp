@@ -0,0 +1,358 @@
+#include "quantModeling/pricers/cache.hpp"
+
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace quantModeling
+{
+
+    // ── Canonical encoding ───────────────────────────────────────────────────
+    //
+    // The inputs are plain aggregates, so their fields are reached with
+    // structured bindings: count the fields by brace-initialising from
+    // placeholders, then bind that many.  A field of a type the encoder does
+    // not know is a compile error, never a field silently left out of the key.
+
+    namespace
+    {
+        struct AnyField
+        {
+            template <class T>
+            operator T() const; // unevaluated only
+        };
+
+        template <class T, std::size_t... I>
+        constexpr bool brace_initialisable(std::index_sequence<I...>)
+        {
+            return requires { T{(void(I), AnyField{})...}; };
+        }
+
+        template <class T, std::size_t N = 0>
+        constexpr std::size_t field_count()
+        {
+            if constexpr (brace_initialisable<T>(std::make_index_sequence<N + 1>{}))
+                return field_count<T, N + 1>();
+            else
+                return N;
+        }
+
+        constexpr std::size_t kMaxFields = 20;
+
+        template <class T>
+        struct is_vector : std::false_type
+        {
+        };
+        template <class T, class A>
+        struct is_vector<std::vector<T, A>> : std::true_type
+        {
+        };
+
+        template <class T>
+        void encode_bytes(std::string &out, const T &value)
+        {
+            char raw[sizeof(T)];
+            std::memcpy(raw, &value, sizeof(T));
+            out.append(raw, sizeof(T));
+        }
+
+        template <class T>
+        void encode(std::string &out, const T &x);
+
+        template <class... T>
+        void encode_all(std::string &out, const T &...xs)
+        {
+            (encode(out, xs), ...);
+        }
+
+        template <class T>
+        void encode_fields(std::string &out, const T &x)
+        {
+            constexpr std::size_t N = field_count<T>();
+            static_assert(N <= kMaxFields, "canonical_request_key: raise kMaxFields");
+            if constexpr (N == 1)
+            {
+                const auto &[a] = x;
+                encode_all(out, a);
+            }
+            else if constexpr (N == 2)
+            {
+                const auto &[a, b] = x;
+                encode_all(out, a, b);
+            }
+            else if constexpr (N == 3)
+            {
+                const auto &[a, b, c] = x;
+                encode_all(out, a, b, c);
+            }
+            else if constexpr (N == 4)
+            {
+                const auto &[a, b, c, d] = x;
+                encode_all(out, a, b, c, d);
+            }
+            else if constexpr (N == 5)
+            {
+                const auto &[a, b, c, d, e] = x;
+                encode_all(out, a, b, c, d, e);
+            }
+            else if constexpr (N == 6)
+            {
+                const auto &[a, b, c, d, e, f] = x;
+                encode_all(out, a, b, c, d, e, f);
+            }
+            else if constexpr (N == 7)
+            {
+                const auto &[a, b, c, d, e, f, g] = x;
+                encode_all(out, a, b, c, d, e, f, g);
+            }
+            else if constexpr (N == 8)
+            {
+                const auto &[a, b, c, d, e, f, g, h] = x;
+                encode_all(out, a, b, c, d, e, f, g, h);
+            }
+            else if constexpr (N == 9)
+            {
+                const auto &[a, b, c, d, e, f, g, h, i] = x;
+                encode_all(out, a, b, c, d, e, f, g, h, i);
+            }
+            else if constexpr (N == 10)
+            {
+                const auto &[a, b, c, d, e, f, g, h, i, j] = x;
+                encode_all(out, a, b, c, d, e, f, g, h, i, j);
+            }
+            else if constexpr (N == 11)
+            {
+                const auto &[a, b, c, d, e, f, g, h, i, j, k] = x;
+                encode_all(out, a, b, c, d, e, f, g, h, i, j, k);
+            }
+            else if constexpr (N == 12)
+            {
+                const auto &[a, b, c, d, e, f, g, h, i, j, k, l] = x;
+                encode_all(out, a, b, c, d, e, f, g, h, i, j, k, l);
+            }
+            else if constexpr (N == 13)
+            {
+                const auto &[a, b, c, d, e, f, g, h, i, j, k, l, m] = x;
+                encode_all(out, a, b, c, d, e, f, g, h, i, j, k, l, m);
+            }
+            else if constexpr (N == 14)
+            {
+                const auto &[a, b, c, d, e, f, g, h, i, j, k, l, m, n] = x;
+                encode_all(out, a, b, c, d, e, f, g, h, i, j, k, l, m, n);
+            }
+            else if constexpr (N == 15)
+            {
+                const auto &[a, b, c, d, e, f, g, h, i, j, k, l, m, n, o] = x;
+                encode_all(out, a, b, c, d, e, f, g, h, i, j, k, l, m, n, o);
+            }
+            else if constexpr (N == 16)
+            {
+                const auto &[a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p] = x;
+                encode_all(out, a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p);
+            }
+            else if constexpr (N == 17)
+            {
+                const auto &[a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, q] = x;
+                encode_all(out, a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, q);
+            }
+            else if constexpr (N == 18)
+            {
+                const auto &[a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, q, r] = x;
+                encode_all(out, a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, q, r);
+            }
+            else if constexpr (N == 19)
+            {
+                const auto &[a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, q, r, s] = x;
+                encode_all(out, a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, q, r, s);
+            }
+            else if constexpr (N == 20)
+            {
+                const auto &[a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, q, r, s, t] = x;
+                encode_all(out, a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, q, r, s, t);
+            }
+        }
+
+        template <class T>
+        void encode(std::string &out, const T &x)
+        {
+            if constexpr (std::is_same_v<T, bool>)
+                out.push_back(x ? '\1' : '\0');
+            else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+                encode_bytes(out, x);
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                encode_bytes(out, static_cast<std::uint64_t>(x.size()));
+                out.append(x);
+            }
+            else if constexpr (is_vector<T>::value)
+            {
+                encode_bytes(out, static_cast<std::uint64_t>(x.size()));
+                for (const auto &e : x)
+                    encode(out, e);
+            }
+            else
+            {
+                static_assert(std::is_aggregate_v<T>, "canonical_request_key: unsupported field type");
+                encode_fields(out, x);
+            }
+        }
+
+        // Rough per-entry bookkeeping: list node, index node and bucket.
+        constexpr std::size_t kEntryOverhead = 4 * sizeof(void *) + 2 * sizeof(std::size_t);
+
+        std::size_t result_bytes(const PricingResult &r)
+        {
+            return r.diagnostics.capacity() +
+                   sizeof(Real) * (r.greeks.delta_per_asset.capacity() + r.greeks.gamma_per_asset.capacity() +
+                                   r.greeks.vega_per_asset.capacity());
+        }
+
+    } // namespace
+
+    std::string canonical_request_key(const PricingRequest &request)
+    {
+        std::string out;
+        const RegistryKey key{request.instrument, request.model, request.engine};
+        encode_bytes(out, static_cast<std::uint64_t>(key.index()));
+        encode_bytes(out, static_cast<std::uint64_t>(request.input.index()));
+        std::visit([&](const auto &in)
+                   { encode_fields(out, in); },
+                   request.input);
+        return out;
+    }
+
+    // ── PricingCache ─────────────────────────────────────────────────────────
+
+    PricingCache::PricingCache(std::size_t capacity_bytes)
+        : capacity_bytes_(capacity_bytes)
+    {
+    }
+
+    PricingResult PricingCache::price(const PricingRequest &request, const PricingRegistry &registry)
+    {
+        std::string key = canonical_request_key(request);
+        const std::size_t hash = std::hash<std::string_view>{}(key);
+        if (auto hit = find(key, hash))
+            return std::move(*hit);
+
+        PricingResult result = registry.price(request);
+        insert(std::move(key), hash, result);
+        return result;
+    }
+
+    std::optional<PricingResult> PricingCache::find(const PricingRequest &request)
+    {
+        const std::string key = canonical_request_key(request);
+        return find(key, std::hash<std::string_view>{}(key));
+    }
+
+    void PricingCache::insert(const PricingRequest &request, const PricingResult &result)
+    {
+        std::string key = canonical_request_key(request);
+        const std::size_t hash = std::hash<std::string_view>{}(key);
+        insert(std::move(key), hash, result);
+    }
+
+    std::optional<PricingResult> PricingCache::find(const std::string &key, std::size_t hash)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = index_.find(KeyRef{key, hash});
+        if (it == index_.end())
+        {
+            ++stats_.misses;
+            return std::nullopt;
+        }
+        ++stats_.hits;
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return it->second->result;
+    }
+
+    void PricingCache::insert(std::string key, std::size_t hash, const PricingResult &result)
+    {
+        const std::size_t bytes = key.size() + sizeof(Entry) + kEntryOverhead + result_bytes(result);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (const auto it = index_.find(KeyRef{key, hash}); it != index_.end())
+        {
+            bytes_ -= it->second->bytes;
+            lru_.erase(it->second);
+            index_.erase(it);
+        }
+        if (bytes > capacity_bytes_)
+            return;
+
+        evict_to(capacity_bytes_ - bytes);
+        lru_.push_front(Entry{std::move(key), hash, bytes, result});
+        index_.emplace(KeyRef{lru_.front().key, hash}, lru_.begin());
+        bytes_ += bytes;
+    }
+
+    void PricingCache::evict_to(std::size_t capacity_bytes)
+    {
+        while (bytes_ > capacity_bytes && !lru_.empty())
+        {
+            const Entry &victim = lru_.back();
+            index_.erase(KeyRef{victim.key, victim.hash});
+            bytes_ -= victim.bytes;
+            lru_.pop_back();
+            ++stats_.evictions;
+        }
+    }
+
+    bool PricingCache::invalidate(const PricingRequest &request)
+    {
+        const std::string key = canonical_request_key(request);
+        const std::size_t hash = std::hash<std::string_view>{}(key);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = index_.find(KeyRef{key, hash});
+        if (it == index_.end())
+            return false;
+        bytes_ -= it->second->bytes;
+        lru_.erase(it->second);
+        index_.erase(it);
+        return true;
+    }
+
+    void PricingCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        index_.clear();
+        lru_.clear();
+        bytes_ = 0;
+    }
+
+    void PricingCache::set_capacity(std::size_t capacity_bytes)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_bytes_ = capacity_bytes;
+        evict_to(capacity_bytes_);
+    }
+
+    PricingCache::Stats PricingCache::stats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Stats s = stats_;
+        s.entries = lru_.size();
+        s.bytes = bytes_;
+        s.capacity_bytes = capacity_bytes_;
+        return s;
+    }
+
+    void PricingCache::reset_stats()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_ = Stats{};
+    }
+
+    PricingCache &default_pricing_cache()
+    {
+        static PricingCache cache;
+        return cache;
+    }
+
+} // namespace quantModeling
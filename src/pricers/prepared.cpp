@@ -0,0 +1,308 @@
+#include "quantModeling/pricers/registry.hpp"
+
+#include "quantModeling/engines/analytic/barrier.hpp"
+#include "quantModeling/engines/analytic/black_scholes.hpp"
+#include "quantModeling/engines/analytic/commodity.hpp"
+#include "quantModeling/engines/analytic/digital.hpp"
+#include "quantModeling/engines/analytic/fx.hpp"
+#include "quantModeling/engines/mc/basket.hpp"
+#include "quantModeling/engines/mc/rainbow.hpp"
+#include "quantModeling/models/equity/multi_asset_bs_model.hpp"
+#include "quantModeling/pricers/adapters/equity_basket.hpp"
+#include "quantModeling/pricers/adapters/equity_rainbow.hpp"
+
+#include <cmath>
+#include <variant>
+
+namespace quantModeling
+{
+
+    namespace
+    {
+
+        // The same fields the API's stress bumps move; anything else in the
+        // input is left as prepared.
+        template <class Input>
+        void apply_market_delta(Input &in, const MarketDelta &d)
+        {
+            const Real spot_factor = 1.0 + d.spot_shift;
+            if constexpr (requires { in.spot += 0.0; })
+                in.spot *= spot_factor;
+            if constexpr (requires { in.spots.begin(); })
+                for (Real &s : in.spots)
+                    s *= spot_factor;
+
+            if constexpr (requires { in.vol += 0.0; })
+                in.vol += d.vol_shift;
+            if constexpr (requires { in.vols.begin(); })
+                for (Real &v : in.vols)
+                    v += d.vol_shift;
+            if constexpr (requires { in.sigma_loc_flat.begin(); })
+                for (Real &v : in.sigma_loc_flat)
+                    v += d.vol_shift;
+            if constexpr (requires { in.surface.sigma_loc_flat.begin(); })
+                for (Real &v : in.surface.sigma_loc_flat)
+                    v += d.vol_shift;
+
+            if constexpr (requires { in.rate += 0.0; })
+                in.rate += d.rate_shift;
+            if constexpr (requires { in.rate_domestic += 0.0; })
+                in.rate_domestic += d.rate_shift;
+        }
+
+        bool is_zero(const MarketDelta &d)
+        {
+            return d.spot_shift == 0.0 && d.vol_shift == 0.0 && d.rate_shift == 0.0;
+        }
+
+        // ── Any registered product: the input and the resolved pricer ──────
+        class RegisteredKernel final : public PreparedPricer::Kernel
+        {
+        public:
+            // Pricing once runs the adapter's and engine's checks, so bad
+            // input fails here, and leaves the unshifted result to hand back.
+            RegisteredKernel(PricingRequest request, PricingFn fn)
+                : request_(std::move(request)), fn_(fn), base_(fn_(request_)) {}
+
+            PricingResult reprice(const MarketDelta &delta) const override
+            {
+                if (is_zero(delta))
+                    return base_;
+                PricingRequest shifted = request_;
+                std::visit([&](auto &in)
+                           { apply_market_delta(in, delta); },
+                           shifted.input);
+                return fn_(shifted);
+            }
+
+        private:
+            PricingRequest request_;
+            PricingFn fn_;
+            PricingResult base_;
+        };
+
+        // ── European vanilla, Black-Scholes analytic: the bare formula ─────
+        class VanillaBSAnalyticKernel final : public PreparedPricer::Kernel
+        {
+        public:
+            explicit VanillaBSAnalyticKernel(const VanillaBSInput &in)
+                : type_(in.is_call ? OptionType::Call : OptionType::Put),
+                  S0_(in.spot), K_(in.strike), T_(in.maturity),
+                  r_(in.rate), q_(in.dividend), vol_(in.vol)
+            {
+                // BSEuroVanillaAnalyticEngine's checks, done once.
+                if (!(T_ > 0.0))
+                    throw InvalidInput("Maturity T must be > 0");
+                if (!(K_ > 0.0))
+                    throw InvalidInput("Strike must be > 0");
+            }
+
+            PricingResult reprice(const MarketDelta &delta) const override
+            {
+                return bs_vanilla_analytic(type_, S0_ * (1.0 + delta.spot_shift), K_, T_,
+                                           r_ + delta.rate_shift, q_, vol_ + delta.vol_shift);
+            }
+
+        private:
+            OptionType type_;
+            Real S0_, K_, T_, r_, q_, vol_;
+        };
+
+        // ── European digital, Black-Scholes analytic ───────────────────────
+        class DigitalBSAnalyticKernel final : public PreparedPricer::Kernel
+        {
+        public:
+            explicit DigitalBSAnalyticKernel(const DigitalBSInput &in) : in_(in)
+            {
+                // BSDigitalAnalyticEngine's checks, done once.
+                if (in_.payoff_type == DigitalPayoffType::CashOrNothing && in_.cash_amount < 0.0)
+                    throw InvalidInput("DigitalOption: cash_amount must be >= 0");
+            }
+
+            PricingResult reprice(const MarketDelta &delta) const override
+            {
+                return bs_digital_analytic(in_.payoff_type, in_.is_call, in_.spot * (1.0 + delta.spot_shift),
+                                           in_.strike, in_.maturity, in_.rate + delta.rate_shift,
+                                           in_.dividend, in_.vol + delta.vol_shift, in_.cash_amount);
+            }
+
+        private:
+            DigitalBSInput in_;
+        };
+
+        // ── Single barrier, Black-Scholes analytic ─────────────────────────
+        class BarrierBSAnalyticKernel final : public PreparedPricer::Kernel
+        {
+        public:
+            explicit BarrierBSAnalyticKernel(const BarrierBSInput &in) : in_(in)
+            {
+                // BSBarrierAnalyticEngine's contract checks, done once; spot,
+                // vol and maturity are checked by the formula on every call.
+                if (in_.barrier_level <= 0.0)
+                    throw InvalidInput("BarrierOption: barrier must be > 0");
+                if (in_.strike <= 0.0)
+                    throw InvalidInput("BarrierOption: strike must be > 0");
+            }
+
+            PricingResult reprice(const MarketDelta &delta) const override
+            {
+                return bs_barrier_analytic(in_.barrier_type, in_.is_call, in_.spot * (1.0 + delta.spot_shift),
+                                           in_.strike, in_.barrier_level, in_.maturity,
+                                           in_.rate + delta.rate_shift, in_.dividend,
+                                           in_.vol + delta.vol_shift, in_.rebate, in_.n_steps,
+                                           in_.brownian_bridge);
+            }
+
+        private:
+            BarrierBSInput in_;
+        };
+
+        // ── FX option, Garman-Kohlhagen ────────────────────────────────────
+        class FXOptionAnalyticKernel final : public PreparedPricer::Kernel
+        {
+        public:
+            explicit FXOptionAnalyticKernel(const FXOptionInput &in) : in_(in)
+            {
+                // FXAnalyticEngine's checks, done once.
+                if (in_.maturity <= 0.0)
+                    throw InvalidInput("FXOption: maturity must be > 0");
+                if (in_.strike <= 0.0)
+                    throw InvalidInput("FXOption: strike must be > 0");
+            }
+
+            PricingResult reprice(const MarketDelta &delta) const override
+            {
+                return gk_fx_option_analytic(in_.is_call, in_.spot * (1.0 + delta.spot_shift), in_.strike,
+                                             in_.maturity, in_.rate_domestic + delta.rate_shift,
+                                             in_.rate_foreign, in_.vol + delta.vol_shift, in_.notional);
+            }
+
+        private:
+            FXOptionInput in_;
+        };
+
+        // ── Commodity option, Black '76 ────────────────────────────────────
+        class CommodityOptionAnalyticKernel final : public PreparedPricer::Kernel
+        {
+        public:
+            explicit CommodityOptionAnalyticKernel(const CommodityOptionInput &in) : in_(in)
+            {
+                // CommodityAnalyticEngine's checks, done once.
+                if (in_.maturity <= 0.0)
+                    throw InvalidInput("CommodityOption: maturity must be > 0");
+                if (in_.strike <= 0.0)
+                    throw InvalidInput("CommodityOption: strike must be > 0");
+            }
+
+            PricingResult reprice(const MarketDelta &delta) const override
+            {
+                // CommodityBlackModel::forward(), with the shifted spot and rate.
+                const Real r = in_.rate + delta.rate_shift;
+                const Real F = in_.spot * (1.0 + delta.spot_shift) *
+                               std::exp((r + in_.storage_cost - in_.convenience_yield) * in_.maturity);
+                return black76_option_analytic(in_.is_call, F, in_.strike, in_.maturity, r,
+                                               in_.vol + delta.vol_shift, in_.notional);
+            }
+
+        private:
+            CommodityOptionInput in_;
+        };
+
+        // ── Basket, Black-Scholes Monte Carlo ──────────────────────────────
+        // A MarketDelta leaves the correlation alone, so the Cholesky factor
+        // and the correlated normals it gives are drawn once; a reprice is
+        // the estimator alone.  The engine is single-step (terminal values
+        // only), so the time grid is the maturity.
+        class BasketBSMCKernel final : public PreparedPricer::Kernel
+        {
+        public:
+            explicit BasketBSMCKernel(const BasketBSInput &in)
+                : in_(in), opt_(make_basket_bs_option(in))
+            {
+                const auto model = make_basket_bs_model(in_);
+                BSBasketMCEngine::validate(opt_, model->n_assets(), in_.n_paths);
+                draws_ = bs_basket_mc_draws(model->chol, in_.n_paths, in_.seed, in_.mc_antithetic);
+            }
+
+            PricingResult reprice(const MarketDelta &delta) const override
+            {
+                BasketBSInput in = in_;
+                apply_market_delta(in, delta);
+                return bs_basket_mc(opt_, in.rate, in.spots, in.vols, in.dividends, draws_,
+                                    in.mc_antithetic);
+            }
+
+        private:
+            BasketBSInput in_;
+            BasketOption opt_;
+            Eigen::MatrixXd draws_;
+        };
+
+        // ── Worst-of / best-of, Black-Scholes Monte Carlo ──────────────────
+        // As the basket: single-step, correlated normals drawn once.
+        template <class Option>
+        class RainbowBSMCKernel final : public PreparedPricer::Kernel
+        {
+        public:
+            explicit RainbowBSMCKernel(const RainbowBSInput &in)
+                : in_(in), opt_(in.maturity, in.strike, in.is_call, in.notional)
+            {
+                const auto model = make_rainbow_bs_model(in_);
+                RainbowMCEngine::validate(opt_.maturity, opt_.notional, model->n_assets());
+                draws_ = rainbow_mc_draws(model->chol, in_.n_paths, in_.seed);
+            }
+
+            PricingResult reprice(const MarketDelta &delta) const override
+            {
+                RainbowBSInput in = in_;
+                apply_market_delta(in, delta);
+                return rainbow_mc(opt_, in.rate, in.spots, in.vols, in.dividends, draws_);
+            }
+
+        private:
+            RainbowBSInput in_;
+            Option opt_;
+            Eigen::MatrixXd draws_;
+        };
+
+        template <class Kernel, class Input>
+        PreparedPricer make_prepared(const RegistryKey &key, const PricingRequest &request)
+        {
+            const auto *in = std::get_if<Input>(&request.input);
+            if (!in)
+                throw InvalidInput("PricingRequest.input does not match the requested instrument/model/engine.");
+            return PreparedPricer(key, std::make_shared<Kernel>(*in));
+        }
+
+    } // namespace
+
+    PreparedPricer PricingRegistry::prepare(const PricingRequest &request) const
+    {
+        using IK = InstrumentKind;
+        using MK = ModelKind;
+        using EK = EngineKind;
+
+        const RegistryKey key{request.instrument, request.model, request.engine};
+        const PricingFn fn = find(key);
+
+        if (key == RegistryKey{IK::EquityVanillaOption, MK::BlackScholes, EK::Analytic})
+            return make_prepared<VanillaBSAnalyticKernel, VanillaBSInput>(key, request);
+        if (key == RegistryKey{IK::EquityDigitalOption, MK::BlackScholes, EK::Analytic})
+            return make_prepared<DigitalBSAnalyticKernel, DigitalBSInput>(key, request);
+        if (key == RegistryKey{IK::EquityBarrierOption, MK::BlackScholes, EK::Analytic})
+            return make_prepared<BarrierBSAnalyticKernel, BarrierBSInput>(key, request);
+        if (key == RegistryKey{IK::FXOption, MK::GarmanKohlhagen, EK::Analytic})
+            return make_prepared<FXOptionAnalyticKernel, FXOptionInput>(key, request);
+        if (key == RegistryKey{IK::CommodityOption, MK::CommodityBlack, EK::Analytic})
+            return make_prepared<CommodityOptionAnalyticKernel, CommodityOptionInput>(key, request);
+        if (key == RegistryKey{IK::EquityBasketOption, MK::BlackScholes, EK::MonteCarlo})
+            return make_prepared<BasketBSMCKernel, BasketBSInput>(key, request);
+        if (key == RegistryKey{IK::WorstOfOption, MK::BlackScholes, EK::MonteCarlo})
+            return make_prepared<RainbowBSMCKernel<WorstOfOption>, RainbowBSInput>(key, request);
+        if (key == RegistryKey{IK::BestOfOption, MK::BlackScholes, EK::MonteCarlo})
+            return make_prepared<RainbowBSMCKernel<BestOfOption>, RainbowBSInput>(key, request);
+
+        return PreparedPricer(key, std::make_shared<RegisteredKernel>(request, fn));
+    }
+
+} // namespace quantModeling
@@ -1,4 +1,5 @@
 #include "quantModeling/pricers/registry.hpp"
+#include "quantModeling/pricers/cache.hpp"
 
 #include "quantModeling/pricers/adapters/bonds.hpp"
 #include "quantModeling/pricers/adapters/equity_asian.hpp"
@@ -12,6 +13,7 @@
 #include "quantModeling/pricers/adapters/equity_lookback_lv.hpp"
 #include "quantModeling/pricers/adapters/equity_vanilla.hpp"
 #include "quantModeling/pricers/adapters/equity_vanilla_american.hpp"
+#include "quantModeling/pricers/adapters/equity_vanilla_lv.hpp"
 #include "quantModeling/pricers/adapters/rates_short_rate.hpp"
 #include "quantModeling/pricers/adapters/equity_autocall.hpp"
 #include "quantModeling/pricers/adapters/equity_mountain.hpp"
@@ -20,6 +22,11 @@
 #include "quantModeling/pricers/adapters/fx.hpp"
 #include "quantModeling/pricers/adapters/commodity.hpp"
 #include "quantModeling/pricers/adapters/equity_rainbow.hpp"
+#include "quantModeling/utils/thread_pool.hpp"
+
+#include <array>
+#include <exception>
+#include <variant>
 
 namespace quantModeling
 {
@@ -32,415 +39,236 @@ namespace quantModeling
         return (instrument << 16) ^ (model << 8) ^ engine;
     }
 
-    void PricingRegistry::register_pricer(const RegistryKey &key, PricingFn fn)
-    {
-        registry_[key] = std::move(fn);
-    }
-
-    PricingResult PricingRegistry::price(const PricingRequest &request) const
+    namespace
     {
-        RegistryKey key{request.instrument, request.model, request.engine};
-        const auto it = registry_.find(key);
-        if (it == registry_.end())
+        // ── Routes ───────────────────────────────────────────────────────────
+        //
+        // One Route per supported (instrument, model, engine): the input
+        // alternative it takes and the adapter it calls, with any trailing
+        // adapter arguments (the engine for adapters that serve several).
+
+        template <InstrumentKind I, ModelKind M, EngineKind E, class Input, auto Adapter, auto... Args>
+        struct Route
         {
-            throw UnsupportedInstrument("No pricer registered for the requested instrument/model/engine.");
-        }
-        return it->second(request);
-    }
+            static constexpr RegistryKey key{I, M, E};
 
-    const PricingRegistry &default_registry()
-    {
-        static PricingRegistry registry = []()
-        {
-            PricingRegistry r;
-
-            r.register_pricer(
-                {InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes, EngineKind::Analytic},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<VanillaBSInput>(request.input);
-                    return price_equity_vanilla_bs(in, EngineKind::Analytic);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<VanillaBSInput>(request.input);
-                    return price_equity_vanilla_bs(in, EngineKind::MonteCarlo);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes, EngineKind::PDEFiniteDifference},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<VanillaBSInput>(request.input);
-                    return price_equity_vanilla_bs(in, EngineKind::PDEFiniteDifference);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes, EngineKind::BinomialTree},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<VanillaBSInput>(request.input);
-                    return price_equity_vanilla_bs(in, EngineKind::BinomialTree);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes, EngineKind::TrinomialTree},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<VanillaBSInput>(request.input);
-                    return price_equity_vanilla_bs(in, EngineKind::TrinomialTree);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityAmericanVanillaOption, ModelKind::BlackScholes, EngineKind::BinomialTree},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<AmericanVanillaBSInput>(request.input);
-                    return price_equity_vanilla_american_bs(in, EngineKind::BinomialTree);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityAmericanVanillaOption, ModelKind::BlackScholes, EngineKind::TrinomialTree},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<AmericanVanillaBSInput>(request.input);
-                    return price_equity_vanilla_american_bs(in, EngineKind::TrinomialTree);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityAmericanVanillaOption, ModelKind::BlackScholes, EngineKind::PDEFiniteDifference},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<AmericanVanillaBSInput>(request.input);
-                    return price_equity_vanilla_american_bs(in, EngineKind::PDEFiniteDifference);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityAsianOption, ModelKind::BlackScholes, EngineKind::Analytic},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<AsianBSInput>(request.input);
-                    return price_equity_asian_bs(in, EngineKind::Analytic);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityAsianOption, ModelKind::BlackScholes, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<AsianBSInput>(request.input);
-                    return price_equity_asian_bs(in, EngineKind::MonteCarlo);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityBarrierOption, ModelKind::BlackScholes, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<BarrierBSInput>(request.input);
-                    return price_equity_barrier_bs_mc(in);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityDigitalOption, ModelKind::BlackScholes, EngineKind::Analytic},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<DigitalBSInput>(request.input);
-                    return price_equity_digital_bs_analytic(in);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityLookbackOption, ModelKind::BlackScholes, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<LookbackBSInput>(request.input);
-                    return price_equity_lookback_bs_mc(in);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityBasketOption, ModelKind::BlackScholes, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<BasketBSInput>(request.input);
-                    return price_equity_basket_bs_mc(in);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityFuture, ModelKind::BlackScholes, EngineKind::Analytic},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<EquityFutureInput>(request.input);
-                    return price_equity_future_bs(in);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::ZeroCouponBond, ModelKind::FlatRate, EngineKind::Analytic},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<ZeroCouponBondInput>(request.input);
-                    return price_zero_coupon_bond_flat(in);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::FixedRateBond, ModelKind::FlatRate, EngineKind::Analytic},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<FixedRateBondInput>(request.input);
-                    return price_fixed_rate_bond_flat(in);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityBarrierOption, ModelKind::DupireLocalVol, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<BarrierLocalVolInput>(request.input);
-                    return price_equity_barrier_lv_mc(in);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityLookbackOption, ModelKind::DupireLocalVol, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<LookbackLocalVolInput>(request.input);
-                    return price_equity_lookback_lv_mc(in);
-                });
-
-            r.register_pricer(
-                {InstrumentKind::EquityAsianOption, ModelKind::DupireLocalVol, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<AsianLocalVolInput>(request.input);
-                    return price_equity_asian_lv_mc(in);
-                });
-
-            // ── Short-rate: ZCB ──────────────────────────────────────────────
-
-            for (auto mk : {ModelKind::Vasicek, ModelKind::CIR, ModelKind::HullWhite})
+            static PricingResult call(const PricingRequest &request)
             {
-                r.register_pricer(
-                    {InstrumentKind::ZeroCouponBond, mk, EngineKind::Analytic},
-                    [](const PricingRequest &request)
-                    {
-                        const auto &in = std::get<ShortRateZCBInput>(request.input);
-                        return price_zcb_short_rate(in);
-                    });
+                const auto *in = std::get_if<Input>(&request.input);
+                if (!in)
+                    throw InvalidInput("PricingRequest.input does not match the requested instrument/model/engine.");
+                return Adapter(*in, Args...);
             }
+        };
 
-            // ── Short-rate: FixedRateBond ────────────────────────────────────
-
-            for (auto mk : {ModelKind::Vasicek, ModelKind::CIR, ModelKind::HullWhite})
-            {
-                r.register_pricer(
-                    {InstrumentKind::FixedRateBond, mk, EngineKind::Analytic},
-                    [](const PricingRequest &request)
-                    {
-                        const auto &in = std::get<ShortRateBondInput>(request.input);
-                        return price_fixed_bond_short_rate(in);
-                    });
-            }
+        template <class... Routes>
+        struct RouteList
+        {
+        };
+
+        // The short-rate products price the same way under each model.
+        template <InstrumentKind I, EngineKind E, class Input, auto Adapter>
+        using ShortRateRoutes = RouteList<Route<I, ModelKind::Vasicek, E, Input, Adapter>,
+                                          Route<I, ModelKind::CIR, E, Input, Adapter>,
+                                          Route<I, ModelKind::HullWhite, E, Input, Adapter>>;
+
+        using IK = InstrumentKind;
+        using MK = ModelKind;
+        using EK = EngineKind;
+
+        using Routes = RouteList<
+            // ── Equity: Black-Scholes ────────────────────────────────────────
+            Route<IK::EquityVanillaOption, MK::BlackScholes, EK::Analytic, VanillaBSInput, &price_equity_vanilla_bs, EK::Analytic>,
+            Route<IK::EquityVanillaOption, MK::BlackScholes, EK::MonteCarlo, VanillaBSInput, &price_equity_vanilla_bs, EK::MonteCarlo>,
+            Route<IK::EquityVanillaOption, MK::BlackScholes, EK::PDEFiniteDifference, VanillaBSInput, &price_equity_vanilla_bs, EK::PDEFiniteDifference>,
+            Route<IK::EquityVanillaOption, MK::BlackScholes, EK::BinomialTree, VanillaBSInput, &price_equity_vanilla_bs, EK::BinomialTree>,
+            Route<IK::EquityVanillaOption, MK::BlackScholes, EK::TrinomialTree, VanillaBSInput, &price_equity_vanilla_bs, EK::TrinomialTree>,
+
+            Route<IK::EquityAmericanVanillaOption, MK::BlackScholes, EK::Analytic, AmericanVanillaBSInput, &price_equity_vanilla_american_bs, EK::Analytic>,
+            Route<IK::EquityAmericanVanillaOption, MK::BlackScholes, EK::BinomialTree, AmericanVanillaBSInput, &price_equity_vanilla_american_bs, EK::BinomialTree>,
+            Route<IK::EquityAmericanVanillaOption, MK::BlackScholes, EK::TrinomialTree, AmericanVanillaBSInput, &price_equity_vanilla_american_bs, EK::TrinomialTree>,
+            Route<IK::EquityAmericanVanillaOption, MK::BlackScholes, EK::PDEFiniteDifference, AmericanVanillaBSInput, &price_equity_vanilla_american_bs, EK::PDEFiniteDifference>,
+
+            Route<IK::EquityAsianOption, MK::BlackScholes, EK::Analytic, AsianBSInput, &price_equity_asian_bs, EK::Analytic>,
+            Route<IK::EquityAsianOption, MK::BlackScholes, EK::MonteCarlo, AsianBSInput, &price_equity_asian_bs, EK::MonteCarlo>,
+            Route<IK::EquityAsianOption, MK::BlackScholes, EK::PDEFiniteDifference, AsianBSInput, &price_equity_asian_bs, EK::PDEFiniteDifference>,
+
+            Route<IK::EquityBarrierOption, MK::BlackScholes, EK::MonteCarlo, BarrierBSInput, &price_equity_barrier_bs_mc>,
+            Route<IK::EquityBarrierOption, MK::BlackScholes, EK::Analytic, BarrierBSInput, &price_equity_barrier_bs_analytic>,
+            Route<IK::EquityBarrierOption, MK::BlackScholes, EK::PDEFiniteDifference, BarrierBSInput, &price_equity_barrier_bs_pde>,
+
+            Route<IK::EquityDigitalOption, MK::BlackScholes, EK::Analytic, DigitalBSInput, &price_equity_digital_bs_analytic>,
+
+            Route<IK::EquityLookbackOption, MK::BlackScholes, EK::MonteCarlo, LookbackBSInput, &price_equity_lookback_bs_mc>,
+            Route<IK::EquityLookbackOption, MK::BlackScholes, EK::Analytic, LookbackBSInput, &price_equity_lookback_bs_analytic>,
+
+            Route<IK::EquityBasketOption, MK::BlackScholes, EK::MonteCarlo, BasketBSInput, &price_equity_basket_bs_mc>,
+            Route<IK::EquityBasketOption, MK::BlackScholes, EK::Analytic, BasketBSInput, &price_equity_basket_bs_analytic>,
+            Route<IK::EquityBasketOption, MK::BlackScholes, EK::PDEFiniteDifference, BasketBSInput, &price_equity_basket_bs_pde>,
+
+            Route<IK::EquityFuture, MK::BlackScholes, EK::Analytic, EquityFutureInput, &price_equity_future_bs>,
+
+            // ── Bonds: flat rate ─────────────────────────────────────────────
+            Route<IK::ZeroCouponBond, MK::FlatRate, EK::Analytic, ZeroCouponBondInput, &price_zero_coupon_bond_flat>,
+            Route<IK::FixedRateBond, MK::FlatRate, EK::Analytic, FixedRateBondInput, &price_fixed_rate_bond_flat>,
+
+            // ── Equity: Dupire local vol ─────────────────────────────────────
+            Route<IK::EquityVanillaOption, MK::DupireLocalVol, EK::PDEFiniteDifference, LocalVolInput, &price_equity_vanilla_lv_pde, false>,
+            Route<IK::EquityAmericanVanillaOption, MK::DupireLocalVol, EK::PDEFiniteDifference, LocalVolInput, &price_equity_vanilla_lv_pde, true>,
+            Route<IK::EquityBarrierOption, MK::DupireLocalVol, EK::MonteCarlo, BarrierLocalVolInput, &price_equity_barrier_lv_mc>,
+            Route<IK::EquityBarrierOption, MK::DupireLocalVol, EK::PDEFiniteDifference, BarrierLocalVolInput, &price_equity_barrier_lv_pde>,
+            Route<IK::EquityDoubleBarrierOption, MK::DupireLocalVol, EK::PDEFiniteDifference, DoubleBarrierLocalVolInput, &price_equity_double_barrier_lv_pde>,
+            Route<IK::EquityLookbackOption, MK::DupireLocalVol, EK::MonteCarlo, LookbackLocalVolInput, &price_equity_lookback_lv_mc>,
+            Route<IK::EquityAsianOption, MK::DupireLocalVol, EK::MonteCarlo, AsianLocalVolInput, &price_equity_asian_lv_mc>,
+
+            // ── Short-rate: Vasicek, CIR, Hull-White ─────────────────────────
+            ShortRateRoutes<IK::ZeroCouponBond, EK::Analytic, ShortRateZCBInput, &price_zcb_short_rate>,
+            ShortRateRoutes<IK::FixedRateBond, EK::Analytic, ShortRateBondInput, &price_fixed_bond_short_rate>,
+            ShortRateRoutes<IK::BondOption, EK::Analytic, ShortRateBondOptionInput, &price_bond_option_short_rate_analytic>,
+            ShortRateRoutes<IK::BondOption, EK::MonteCarlo, ShortRateBondOptionInput, &price_bond_option_short_rate_mc>,
+            ShortRateRoutes<IK::CapFloor, EK::Analytic, ShortRateCapFloorInput, &price_capfloor_short_rate_analytic>,
+            ShortRateRoutes<IK::CapFloor, EK::MonteCarlo, ShortRateCapFloorInput, &price_capfloor_short_rate_mc>,
+            ShortRateRoutes<IK::Caplet, EK::Analytic, ShortRateCapletInput, &price_caplet_short_rate_analytic>,
+            ShortRateRoutes<IK::Caplet, EK::MonteCarlo, ShortRateCapletInput, &price_caplet_short_rate_mc>,
+
+            // ── Equity exotics: Monte Carlo ──────────────────────────────────
+            Route<IK::Autocall, MK::BlackScholes, EK::MonteCarlo, AutocallBSInput, &price_equity_autocall_bs_mc>,
+            Route<IK::Mountain, MK::BlackScholes, EK::MonteCarlo, MountainBSInput, &price_equity_mountain_bs_mc>,
+
+            // ── Volatility and dispersion ────────────────────────────────────
+            Route<IK::VarianceSwap, MK::BlackScholes, EK::Analytic, VarianceSwapBSInput, &price_variance_swap_bs_analytic>,
+            Route<IK::VarianceSwap, MK::BlackScholes, EK::MonteCarlo, VarianceSwapBSInput, &price_variance_swap_bs_mc>,
+            Route<IK::VolatilitySwap, MK::BlackScholes, EK::MonteCarlo, VolatilitySwapBSInput, &price_volatility_swap_bs_mc>,
+            Route<IK::DispersionSwap, MK::BlackScholes, EK::MonteCarlo, DispersionBSInput, &price_dispersion_bs_mc>,
+
+            // ── FX: Garman-Kohlhagen ─────────────────────────────────────────
+            Route<IK::FXForward, MK::GarmanKohlhagen, EK::Analytic, FXForwardInput, &price_fx_forward_analytic>,
+            Route<IK::FXOption, MK::GarmanKohlhagen, EK::Analytic, FXOptionInput, &price_fx_option_analytic>,
+
+            // ── Commodity: Black '76 ─────────────────────────────────────────
+            Route<IK::CommodityForward, MK::CommodityBlack, EK::Analytic, CommodityForwardInput, &price_commodity_forward_analytic>,
+            Route<IK::CommodityOption, MK::CommodityBlack, EK::Analytic, CommodityOptionInput, &price_commodity_option_analytic>,
+
+            // ── Rainbow: worst-of / best-of ──────────────────────────────────
+            Route<IK::WorstOfOption, MK::BlackScholes, EK::MonteCarlo, RainbowBSInput, &price_worst_of_bs_mc>,
+            Route<IK::BestOfOption, MK::BlackScholes, EK::MonteCarlo, RainbowBSInput, &price_best_of_bs_mc>,
+            Route<IK::WorstOfOption, MK::BlackScholes, EK::Analytic, RainbowBSInput, &price_worst_of_bs_analytic>,
+            Route<IK::BestOfOption, MK::BlackScholes, EK::Analytic, RainbowBSInput, &price_best_of_bs_analytic>,
+            Route<IK::WorstOfOption, MK::BlackScholes, EK::PDEFiniteDifference, RainbowBSInput, &price_worst_of_bs_pde>,
+            Route<IK::BestOfOption, MK::BlackScholes, EK::PDEFiniteDifference, RainbowBSInput, &price_best_of_bs_pde>>;
+
+        // ── Dense table ──────────────────────────────────────────────────────
+
+        constexpr std::size_t kTableSize = kInstrumentKindCount * kModelKindCount * kEngineKindCount;
+
+        using DispatchTable = std::array<PricingFn, kTableSize>;
+
+        template <class R>
+        constexpr void add_routes(DispatchTable &table, R)
+        {
+            if (table[R::key.index()] != nullptr)
+                throw "duplicate route in the pricing registry"; // not a constant expression
+            table[R::key.index()] = &R::call;
+        }
 
-            // ── Short-rate: BondOption — analytic ────────────────────────────
+        template <class... Rs>
+        constexpr void add_routes(DispatchTable &table, RouteList<Rs...>)
+        {
+            (add_routes(table, Rs{}), ...);
+        }
 
-            for (auto mk : {ModelKind::Vasicek, ModelKind::CIR, ModelKind::HullWhite})
-            {
-                r.register_pricer(
-                    {InstrumentKind::BondOption, mk, EngineKind::Analytic},
-                    [](const PricingRequest &request)
-                    {
-                        const auto &in = std::get<ShortRateBondOptionInput>(request.input);
-                        return price_bond_option_short_rate_analytic(in);
-                    });
-            }
+        constexpr DispatchTable kDispatch = []
+        {
+            DispatchTable table{};
+            add_routes(table, Routes{});
+            return table;
+        }();
 
-            // ── Short-rate: BondOption — MC ──────────────────────────────────
+        constexpr std::size_t kRouteCount = []
+        {
+            std::size_t n = 0;
+            for (PricingFn fn : kDispatch)
+                n += fn != nullptr;
+            return n;
+        }();
 
-            for (auto mk : {ModelKind::Vasicek, ModelKind::CIR, ModelKind::HullWhite})
-            {
-                r.register_pricer(
-                    {InstrumentKind::BondOption, mk, EngineKind::MonteCarlo},
-                    [](const PricingRequest &request)
+        constexpr std::array<RegistryKey, kRouteCount> kCapabilities = []
+        {
+            std::array<RegistryKey, kRouteCount> keys{};
+            std::size_t n = 0;
+            for (std::size_t i = 0; i < kInstrumentKindCount; ++i)
+                for (std::size_t j = 0; j < kModelKindCount; ++j)
+                    for (std::size_t k = 0; k < kEngineKindCount; ++k)
                     {
-                        const auto &in = std::get<ShortRateBondOptionInput>(request.input);
-                        return price_bond_option_short_rate_mc(in);
-                    });
-            }
+                        const RegistryKey key{static_cast<InstrumentKind>(i), static_cast<ModelKind>(j),
+                                              static_cast<EngineKind>(k)};
+                        if (kDispatch[key.index()] != nullptr)
+                            keys[n++] = key;
+                    }
+            return keys;
+        }();
 
-            // ── Short-rate: CapFloor — analytic ──────────────────────────────
+    } // namespace
 
-            for (auto mk : {ModelKind::Vasicek, ModelKind::CIR, ModelKind::HullWhite})
-            {
-                r.register_pricer(
-                    {InstrumentKind::CapFloor, mk, EngineKind::Analytic},
-                    [](const PricingRequest &request)
-                    {
-                        const auto &in = std::get<ShortRateCapFloorInput>(request.input);
-                        return price_capfloor_short_rate_analytic(in);
-                    });
-            }
+    PricingFn PricingRegistry::find(const RegistryKey &key) const
+    {
+        const std::size_t i = key.index();
+        if (i >= kTableSize || kDispatch[i] == nullptr)
+        {
+            throw UnsupportedInstrument("No pricer registered for the requested instrument/model/engine.");
+        }
+        return kDispatch[i];
+    }
+
+    PricingResult PricingRegistry::price(const PricingRequest &request) const
+    {
+        return find({request.instrument, request.model, request.engine})(request);
+    }
 
-            // ── Short-rate: CapFloor — MC ────────────────────────────────────
+    bool PricingRegistry::supports(const RegistryKey &key) const
+    {
+        const std::size_t i = key.index();
+        return i < kTableSize && kDispatch[i] != nullptr;
+    }
 
-            for (auto mk : {ModelKind::Vasicek, ModelKind::CIR, ModelKind::HullWhite})
-            {
-                r.register_pricer(
-                    {InstrumentKind::CapFloor, mk, EngineKind::MonteCarlo},
-                    [](const PricingRequest &request)
-                    {
-                        const auto &in = std::get<ShortRateCapFloorInput>(request.input);
-                        return price_capfloor_short_rate_mc(in);
-                    });
-            }
+    std::span<const RegistryKey> PricingRegistry::capabilities() const
+    {
+        return kCapabilities;
+    }
 
-            // ── Short-rate: Caplet — analytic ────────────────────────────────
+    namespace
+    {
+        WorkStealingPool &batch_pool()
+        {
+            static WorkStealingPool pool;
+            return pool;
+        }
+    } // namespace
 
-            for (auto mk : {ModelKind::Vasicek, ModelKind::CIR, ModelKind::HullWhite})
+    std::vector<BatchPricingResult> PricingRegistry::price_batch(std::span<const PricingRequest> requests,
+                                                                 PricingCache *cache) const
+    {
+        std::vector<BatchPricingResult> out(requests.size());
+        batch_pool().parallel_for(requests.size(), [&](std::size_t i)
+                                  {
+            try
             {
-                r.register_pricer(
-                    {InstrumentKind::Caplet, mk, EngineKind::Analytic},
-                    [](const PricingRequest &request)
-                    {
-                        const auto &in = std::get<ShortRateCapletInput>(request.input);
-                        return price_caplet_short_rate_analytic(in);
-                    });
+                out[i].result = cache ? cache->price(requests[i], *this) : price(requests[i]);
             }
-
-            // ── Short-rate: Caplet — MC ──────────────────────────────────────
-
-            for (auto mk : {ModelKind::Vasicek, ModelKind::CIR, ModelKind::HullWhite})
+            catch (const std::exception &e)
             {
-                r.register_pricer(
-                    {InstrumentKind::Caplet, mk, EngineKind::MonteCarlo},
-                    [](const PricingRequest &request)
-                    {
-                        const auto &in = std::get<ShortRateCapletInput>(request.input);
-                        return price_caplet_short_rate_mc(in);
-                    });
+                out[i].error = e.what();
             }
+            catch (...)
+            {
+                out[i].error = "unknown error";
+            } });
+        return out;
+    }
 
-            // ── Equity: Autocall — MC ────────────────────────────────────────
-
-            r.register_pricer(
-                {InstrumentKind::Autocall, ModelKind::BlackScholes, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<AutocallBSInput>(request.input);
-                    return price_equity_autocall_bs_mc(in);
-                });
-
-            // ── Equity: Mountain (Himalaya) — MC ─────────────────────────────
-
-            r.register_pricer(
-                {InstrumentKind::Mountain, ModelKind::BlackScholes, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<MountainBSInput>(request.input);
-                    return price_equity_mountain_bs_mc(in);
-                });
-
-            // ── Volatility: Variance Swap — Analytic ─────────────────────────
-
-            r.register_pricer(
-                {InstrumentKind::VarianceSwap, ModelKind::BlackScholes, EngineKind::Analytic},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<VarianceSwapBSInput>(request.input);
-                    return price_variance_swap_bs_analytic(in);
-                });
-
-            // ── Volatility: Variance Swap — MC ──────────────────────────────
-
-            r.register_pricer(
-                {InstrumentKind::VarianceSwap, ModelKind::BlackScholes, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<VarianceSwapBSInput>(request.input);
-                    return price_variance_swap_bs_mc(in);
-                });
-
-            // ── Volatility: Volatility Swap — MC ─────────────────────────────
-
-            r.register_pricer(
-                {InstrumentKind::VolatilitySwap, ModelKind::BlackScholes, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<VolatilitySwapBSInput>(request.input);
-                    return price_volatility_swap_bs_mc(in);
-                });
-
-            // ── Dispersion: Dispersion Swap — MC ─────────────────────────────
-
-            r.register_pricer(
-                {InstrumentKind::DispersionSwap, ModelKind::BlackScholes, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<DispersionBSInput>(request.input);
-                    return price_dispersion_bs_mc(in);
-                });
-
-            // ── FX: Forward — Analytic ───────────────────────────────────────
-
-            r.register_pricer(
-                {InstrumentKind::FXForward, ModelKind::GarmanKohlhagen, EngineKind::Analytic},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<FXForwardInput>(request.input);
-                    return price_fx_forward_analytic(in);
-                });
-
-            // ── FX: Option — Analytic (Garman-Kohlhagen) ─────────────────────
-
-            r.register_pricer(
-                {InstrumentKind::FXOption, ModelKind::GarmanKohlhagen, EngineKind::Analytic},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<FXOptionInput>(request.input);
-                    return price_fx_option_analytic(in);
-                });
-
-            // ── Commodity: Forward — Analytic ────────────────────────────────
-
-            r.register_pricer(
-                {InstrumentKind::CommodityForward, ModelKind::CommodityBlack, EngineKind::Analytic},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<CommodityForwardInput>(request.input);
-                    return price_commodity_forward_analytic(in);
-                });
-
-            // ── Commodity: Option — Analytic (Black '76) ────────────────────
-
-            r.register_pricer(
-                {InstrumentKind::CommodityOption, ModelKind::CommodityBlack, EngineKind::Analytic},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<CommodityOptionInput>(request.input);
-                    return price_commodity_option_analytic(in);
-                });
-
-            // ── Rainbow: Worst-of Option — MC ─────────────────────────
-
-            r.register_pricer(
-                {InstrumentKind::WorstOfOption, ModelKind::BlackScholes, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<RainbowBSInput>(request.input);
-                    return price_worst_of_bs_mc(in);
-                });
-
-            // ── Rainbow: Best-of Option — MC ──────────────────────────
-
-            r.register_pricer(
-                {InstrumentKind::BestOfOption, ModelKind::BlackScholes, EngineKind::MonteCarlo},
-                [](const PricingRequest &request)
-                {
-                    const auto &in = std::get<RainbowBSInput>(request.input);
-                    return price_best_of_bs_mc(in);
-                });
-
-            return r;
-        }();
-
+    const PricingRegistry &default_registry()
+    {
+        static const PricingRegistry registry;
         return registry;
     }
 
@@ -1,4 +1,230 @@
 #include "quantModeling/utils/stats.hpp"
+
+#include <algorithm>
 #include <cmath>
+#include <utility>
+
+namespace quantModeling {
+
+namespace {
+
+// Branch-free norm_cdf: every region is evaluated and the result selected,
+// so the caller's loop has no control flow.  Same arithmetic as the scalar
+// norm_cdf, region by region.
+inline Real norm_cdf_blend(Real x) {
+  const Real ax = x < 0.0 ? -x : x;
+  const Real ac = ax > 40.0 ? 40.0 : ax;
+  const Real y = ac * detail::ncdf_inv_sqrt2;
+  const Real ys = x * detail::ncdf_inv_sqrt2;
+
+  Real n_small, d_small, n_mid, d_mid, n_tail, d_tail;
+  detail::ncdf_small(ys, n_small, d_small);
+  detail::ncdf_mid(y, n_mid, d_mid);
+  detail::ncdf_tail(y, n_tail, d_tail);
+  const Real half_gauss = 0.5 * detail::ncdf_gauss(ac);
+
+  const bool small = y <= 0.46875;
+  const bool mid = y <= 4.0;
+  const Real n = small ? n_small : (mid ? n_mid : n_tail);
+  const Real d = small ? d_small : (mid ? d_mid : d_tail);
+  const Real c0 = small ? 0.5 : (x < 0.0 ? 0.0 : 1.0);
+  const Real c1 = small ? 0.5 * ys : (x < 0.0 ? half_gauss : -half_gauss);
+  return c0 + c1 * (n / d);
+}
+
+// Gauss-Legendre half-rules on [-1, 1] (nodes x > 0; the rule uses ±x).
+constexpr Real gl6_x[] = {0.9324695142031521, 0.6612093864662645,
+                          0.2386191860831969};
+constexpr Real gl6_w[] = {0.1713244923791704, 0.3607615730481386,
+                          0.4679139345726910};
+constexpr Real gl12_x[] = {0.9815606342467192, 0.9041172563704749,
+                           0.7699026741943047, 0.5873179542866175,
+                           0.3678314989981802, 0.1252334085114689};
+constexpr Real gl12_w[] = {0.0471753363865118, 0.1069393259953184,
+                           0.1600783285433462, 0.2031674267230659,
+                           0.2334925365383548, 0.2491470458134028};
+constexpr Real gl20_x[] = {0.9931285991850949, 0.9639719272779138,
+                           0.9122344282513259, 0.8391169718222188,
+                           0.7463319064601508, 0.6360536807265150,
+                           0.5108670019508271, 0.3737060887154195,
+                           0.2277858511416451, 0.0765265211334973};
+constexpr Real gl20_w[] = {0.0176140071391521, 0.0406014298003869,
+                           0.0626720483341091, 0.0832767415767048,
+                           0.1019301198172404, 0.1181945319615184,
+                           0.1316886384491766, 0.1420961093183820,
+                           0.1491729864726037, 0.1527533871307258};
+
+constexpr Real two_pi = 6.28318530717958647693;
+
+// P(X > h, Y > k), Genz's BVND.
+Real bvn_upper(Real h, Real k, Real r) {
+  const Real ar = std::fabs(r);
+  const Real *x = gl20_x;
+  const Real *w = gl20_w;
+  int lg = 10;
+  if (ar < 0.3) {
+    x = gl6_x;
+    w = gl6_w;
+    lg = 3;
+  } else if (ar < 0.75) {
+    x = gl12_x;
+    w = gl12_w;
+    lg = 6;
+  }
+
+  Real hk = h * k;
+  Real bvn = 0.0;
+  if (ar < 0.925) {
+    const Real hs = 0.5 * (h * h + k * k);
+    const Real asr = std::asin(r);
+    for (int i = 0; i < lg; ++i)
+      for (int is = -1; is <= 1; is += 2) {
+        const Real sn = std::sin(0.5 * asr * (is * x[i] + 1.0));
+        bvn += w[i] * std::exp((sn * hk - hs) / (1.0 - sn * sn));
+      }
+    return bvn * asr / (2.0 * two_pi) + norm_cdf(-h) * norm_cdf(-k);
+  }
+
+  if (r < 0.0) {
+    k = -k;
+    hk = -hk;
+  }
+  if (ar < 1.0) {
+    const Real as = (1.0 - r) * (1.0 + r);
+    Real a = std::sqrt(as);
+    const Real bs = (h - k) * (h - k);
+    const Real c = (4.0 - hk) / 8.0;
+    const Real d = (12.0 - hk) / 16.0;
+    Real asr = -0.5 * (bs / as + hk);
+    if (asr > -100.0)
+      bvn = a * std::exp(asr) *
+            (1.0 - c * (bs - as) * (1.0 - d * bs / 5.0) / 3.0 +
+             c * d * as * as / 5.0);
+    if (-hk < 100.0) {
+      const Real b = std::sqrt(bs);
+      bvn -= std::exp(-0.5 * hk) * std::sqrt(two_pi) * norm_cdf(-b / a) * b *
+             (1.0 - c * bs * (1.0 - d * bs / 5.0) / 3.0);
+    }
+    a *= 0.5;
+    for (int i = 0; i < lg; ++i)
+      for (int is = -1; is <= 1; is += 2) {
+        const Real xs = (a * (is * x[i] + 1.0)) * (a * (is * x[i] + 1.0));
+        const Real rs = std::sqrt(1.0 - xs);
+        asr = -0.5 * (bs / xs + hk);
+        if (asr > -100.0)
+          bvn += a * w[i] * std::exp(asr) *
+                 (std::exp(-hk * (1.0 - rs) / (2.0 * (1.0 + rs))) / rs -
+                  (1.0 + c * xs * (1.0 + d * xs)));
+      }
+    bvn = -bvn / two_pi;
+  }
+  if (r > 0.0)
+    return bvn + norm_cdf(-std::max(h, k));
+  bvn = -bvn;
+  if (k > h)
+    bvn += norm_cdf(k) - norm_cdf(h);
+  return bvn;
+}
+
+// Bivariate normal density.
+Real bvn_pdf(Real a, Real b, Real r) {
+  const Real s = 1.0 - r * r;
+  return std::exp(-0.5 * (a * a - 2.0 * r * a * b + b * b) / s) /
+         (two_pi * std::sqrt(s));
+}
+
+// Φ((b − μ)/sd) where var = sd² may underflow to zero.
+Real cond_cdf(Real z, Real var) {
+  if (var <= 1e-300)
+    return z >= 0.0 ? 1.0 : 0.0;
+  return norm_cdf(z / std::sqrt(var));
+}
+
+} // anonymous namespace
+
+Real bivariate_norm_cdf(Real a, Real b, Real rho) {
+  const Real p = bvn_upper(-a, -b, rho);
+  return std::min(1.0, std::max(0.0, p));
+}
+
+Real trivariate_norm_cdf(Real a, Real b, Real c, Real r12, Real r13,
+                         Real r23) {
+  // Relabel so (2, 3) is the most correlated pair, then decouple variable 1:
+  // along R(t) = [t r12, t r13, r23], dN3/dt = r12 ∂N3/∂r12 + r13 ∂N3/∂r13
+  // and ∂N3/∂r_ij = φ2(b_i, b_j; r_ij) Φ(x_k | x_i = b_i, x_j = b_j).
+  Real b1 = a, b2 = b, b3 = c;
+  if (std::fabs(r12) > std::fabs(r23) && std::fabs(r12) >= std::fabs(r13)) {
+    std::swap(b1, b3); // variables (3, 2, 1): r12 ↔ r23
+    std::swap(r12, r23);
+  } else if (std::fabs(r13) > std::fabs(r23)) {
+    std::swap(b1, b2); // variables (2, 1, 3): r13 ↔ r23
+    std::swap(r13, r23);
+  }
+
+  const auto g = [&](Real t) {
+    const Real s12 = t * r12;
+    const Real s13 = t * r13;
+    const Real det =
+        1.0 - s12 * s12 - s13 * s13 - r23 * r23 + 2.0 * s12 * s13 * r23;
+    Real v = 0.0;
+    if (r12 != 0.0) {
+      const Real u = 1.0 - s12 * s12;
+      const Real mu = ((s13 - s12 * r23) * b1 + (r23 - s12 * s13) * b2) / u;
+      v += r12 * bvn_pdf(b1, b2, s12) * cond_cdf(b3 - mu, det / u);
+    }
+    if (r13 != 0.0) {
+      const Real u = 1.0 - s13 * s13;
+      const Real mu = ((s12 - s13 * r23) * b1 + (r23 - s12 * s13) * b3) / u;
+      v += r13 * bvn_pdf(b1, b3, s13) * cond_cdf(b2 - mu, det / u);
+    }
+    return v;
+  };
+  const auto gl20 = [&](Real lo, Real hi) {
+    const Real half = 0.5 * (hi - lo);
+    const Real mid = 0.5 * (hi + lo);
+    Real sum = 0.0;
+    for (int i = 0; i < 10; ++i)
+      sum += gl20_w[i] * (g(mid - half * gl20_x[i]) + g(mid + half * gl20_x[i]));
+    return half * sum;
+  };
+
+  // Smooth unless det R is small, when Φ(x_k | ·) steepens near t = 1:
+  // bisect until the 20-point rule agrees with its two halves.
+  Real integral = 0.0;
+  struct Panel {
+    Real lo, hi, value;
+    int depth;
+  };
+  Panel stack[64];
+  int top = 0;
+  stack[top++] = {0.0, 1.0, gl20(0.0, 1.0), 0};
+  while (top > 0) {
+    const Panel pn = stack[--top];
+    const Real mid = 0.5 * (pn.lo + pn.hi);
+    const Real left = gl20(pn.lo, mid);
+    const Real right = gl20(mid, pn.hi);
+    if (std::fabs(left + right - pn.value) <= 1e-15 || pn.depth >= 30 ||
+        top + 2 > 64) {
+      integral += left + right;
+      continue;
+    }
+    stack[top++] = {pn.lo, mid, left, pn.depth + 1};
+    stack[top++] = {mid, pn.hi, right, pn.depth + 1};
+  }
+
+  const Real p =
+      norm_cdf(b1) * bivariate_norm_cdf(b2, b3, r23) + integral;
+  return std::min(1.0, std::max(0.0, p));
+}
+
+void norm_pdf(const Real *x, Real *out, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i)
+    out[i] = norm_pdf(x[i]);
+}
+
+void norm_cdf(const Real *x, Real *out, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i)
+    out[i] = norm_cdf_blend(x[i]);
+}
 
-double norm_cdf(double x) { return 0.5 * erfc(-x / std::sqrt(2.0)); };
\ No newline at end of file
+} // namespace quantModeling
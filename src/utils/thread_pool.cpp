@@ -0,0 +1,193 @@
+#include "quantModeling/utils/thread_pool.hpp"
+
+#include <algorithm>
+#include <exception>
+
+namespace quantModeling
+{
+    namespace
+    {
+        // Depth of parallel_for() tasks running on this thread (nested
+        // calls run tasks inside tasks).
+        thread_local int t_task_depth = 0;
+    } // namespace
+
+    struct WorkStealingPool::Job
+    {
+        const std::function<void(std::size_t)> *fn;
+        std::atomic<std::size_t> remaining;
+        std::mutex mutex; // guards the last decrement, `done` and `error`
+        std::condition_variable done;
+        std::exception_ptr error;
+    };
+
+    WorkStealingPool::WorkStealingPool(int n_threads)
+    {
+        if (n_threads <= 0)
+            n_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+        queues_.reserve(static_cast<std::size_t>(n_threads));
+        for (int i = 0; i < n_threads; ++i)
+            queues_.push_back(std::make_unique<Queue>());
+
+        threads_.reserve(static_cast<std::size_t>(n_threads));
+        for (int i = 0; i < n_threads; ++i)
+            threads_.emplace_back(&WorkStealingPool::worker_loop, this, static_cast<std::size_t>(i));
+    }
+
+    WorkStealingPool::~WorkStealingPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto &t : threads_)
+            t.join();
+    }
+
+    // Own deque from the back, then the others' from the front, starting
+    // with the next worker along.
+    bool WorkStealingPool::try_pop(std::size_t self, Task &task)
+    {
+        const std::size_t n = queues_.size();
+        {
+            Queue &own = *queues_[self];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty())
+            {
+                task = own.tasks.back();
+                own.tasks.pop_back();
+                queued_.fetch_sub(1);
+                return true;
+            }
+        }
+        for (std::size_t k = 1; k < n; ++k)
+        {
+            Queue &victim = *queues_[(self + k) % n];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty())
+            {
+                task = victim.tasks.front();
+                victim.tasks.pop_front();
+                queued_.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Any task of `job`, oldest first: what a waiting caller helps with.
+    bool WorkStealingPool::try_pop_job(const Job *job, Task &task)
+    {
+        for (auto &queue : queues_)
+        {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            const auto it = std::find_if(queue->tasks.begin(), queue->tasks.end(), [&](const Task &t)
+                                         { return t.job == job; });
+            if (it != queue->tasks.end())
+            {
+                task = *it;
+                queue->tasks.erase(it);
+                queued_.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WorkStealingPool::run(const Task &task)
+    {
+        Job &job = *task.job;
+        std::exception_ptr error;
+        ++t_task_depth;
+        try
+        {
+            (*job.fn)(task.index);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        --t_task_depth;
+
+        // Nothing touches the job after this lock is released: the caller
+        // may be waiting to destroy it.
+        std::lock_guard<std::mutex> lock(job.mutex);
+        if (error && !job.error)
+            job.error = error;
+        if (job.remaining.fetch_sub(1) == 1)
+            job.done.notify_all();
+    }
+
+    bool WorkStealingPool::in_task()
+    {
+        return t_task_depth > 0;
+    }
+
+    void WorkStealingPool::worker_loop(std::size_t self)
+    {
+        for (;;)
+        {
+            Task task;
+            if (try_pop(self, task))
+            {
+                run(task);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            wake_.wait(lock, [&]
+                       { return stop_ || queued_.load() > 0; });
+            if (stop_ && queued_.load() == 0)
+                return;
+        }
+    }
+
+    void WorkStealingPool::parallel_for(std::size_t n, const std::function<void(std::size_t)> &fn)
+    {
+        if (n == 0)
+            return;
+        if (n == 1)
+        {
+            fn(0);
+            return;
+        }
+
+        Job job;
+        job.fn = &fn;
+        job.remaining.store(n);
+
+        // Counted before they are pushed, so that a worker taking one at
+        // once never decrements the count below zero.
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            queued_.fetch_add(n);
+        }
+
+        // Deal the indices round-robin, starting where the last call left
+        // off so that concurrent small batches spread over the workers.
+        const std::size_t n_queues = queues_.size();
+        const std::size_t first = next_queue_.fetch_add(n);
+        for (std::size_t q = 0; q < n_queues && q < n; ++q)
+        {
+            Queue &queue = *queues_[(first + q) % n_queues];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            for (std::size_t i = q; i < n; i += n_queues)
+                queue.tasks.push_back(Task{&job, i});
+        }
+        wake_.notify_all();
+
+        // Help with this call's indices until all have been taken, then
+        // wait for the rest.
+        Task task;
+        while (job.remaining.load() > 0 && try_pop_job(&job, task))
+            run(task);
+
+        std::unique_lock<std::mutex> lock(job.mutex);
+        job.done.wait(lock, [&]
+                      { return job.remaining.load() == 0; });
+        if (job.error)
+            std::rethrow_exception(job.error);
+    }
+
+} // namespace quantModeling
@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+
+#include "quantModeling/core/results.hpp"
+#include "quantModeling/core/types.hpp"
+
+// ── Instruments ──────────────────────────────────────────────────────────────
+#include "quantModeling/instruments/equity/future.hpp"
+#include "quantModeling/instruments/equity/vanilla.hpp"
+
+// ── Models ───────────────────────────────────────────────────────────────────
+#include "quantModeling/models/equity/black_scholes.hpp"
+
+// ── Engines ──────────────────────────────────────────────────────────────────
+#include "quantModeling/engines/analytic/american.hpp"
+#include "quantModeling/engines/analytic/black_scholes.hpp"
+
+// ── Pricer / Registry ────────────────────────────────────────────────────────
+#include "quantModeling/pricers/context.hpp"
+#include "quantModeling/pricers/pricer.hpp"
+#include "quantModeling/pricers/registry.hpp"
+
+#include <cmath>
+#include <memory>
+
+using namespace quantModeling;
+
+namespace
+{
+
+    PricingResult priceDirect(Real S, Real K, Real T, Real r, Real q, Real sigma, bool is_call,
+                              AmericanAnalyticScheme scheme = AmericanAnalyticScheme::ALOAccurate,
+                              ExerciseType exercise = ExerciseType::American)
+    {
+        auto payoff = std::make_shared<PlainVanillaPayoff>(is_call ? OptionType::Call : OptionType::Put, K);
+        std::shared_ptr<IExercise> ex;
+        if (exercise == ExerciseType::American)
+            ex = std::make_shared<AmericanExercise>(T);
+        else
+            ex = std::make_shared<EuropeanExercise>(T);
+        VanillaOption opt(payoff, ex, 1.0);
+
+        PricingSettings settings{0, 0, true, 100, 100, 100};
+        PricingContext ctx{MarketView{}, settings, std::make_shared<BlackScholesModel>(S, r, q, sigma)};
+        BSAmericanAnalyticEngine engine(ctx, scheme);
+        return price(opt, engine);
+    }
+
+    PricingResult priceRegistry(const AmericanVanillaBSInput &in, EngineKind engine)
+    {
+        PricingRequest request{
+            InstrumentKind::EquityAmericanVanillaOption,
+            ModelKind::BlackScholes,
+            engine,
+            PricingInput{in}};
+        return default_registry().price(request);
+    }
+
+    Real priceEuropean(Real S, Real K, Real T, Real r, Real q, Real sigma, bool is_call)
+    {
+        VanillaBSInput in{S, K, T, r, q, sigma, is_call};
+        PricingRequest request{
+            InstrumentKind::EquityVanillaOption,
+            ModelKind::BlackScholes,
+            EngineKind::Analytic,
+            PricingInput{in}};
+        return default_registry().price(request).npv;
+    }
+
+} // namespace
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  1. Accuracy
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(AmericanAnalytic, ReferencePut)
+{
+    // Converged ALO value (Andersen-Lake-Offengelt 2016, Table 2 setting).
+    auto res = priceDirect(100.0, 100.0, 1.0, 0.05, 0.0, 0.2, false);
+    EXPECT_NEAR(res.npv, 6.090370590955, 1e-8);
+}
+
+TEST(AmericanAnalytic, SchemesAgree)
+{
+    const Real hp = priceDirect(110.0, 100.0, 3.0, 0.04, 0.01, 0.4, false,
+                                AmericanAnalyticScheme::ALOHighPrecision).npv;
+    EXPECT_NEAR(priceDirect(110.0, 100.0, 3.0, 0.04, 0.01, 0.4, false).npv, hp, 1e-8);
+    EXPECT_NEAR(priceDirect(110.0, 100.0, 3.0, 0.04, 0.01, 0.4, false,
+                            AmericanAnalyticScheme::ALOFast).npv,
+                hp, 1e-4);
+    EXPECT_NEAR(priceDirect(110.0, 100.0, 3.0, 0.04, 0.01, 0.4, false,
+                            AmericanAnalyticScheme::BaroneAdesiWhaley).npv,
+                hp, 0.5);
+}
+
+TEST(AmericanAnalytic, MatchesBinomialTree)
+{
+    struct Case
+    {
+        Real S, K, T, r, q, sigma;
+        bool is_call;
+    };
+    const Case cases[] = {
+        {100.0, 100.0, 1.0, 0.05, 0.05, 0.25, false},
+        {90.0, 100.0, 0.5, 0.08, 0.12, 0.30, false},
+        {100.0, 100.0, 1.0, 0.05, 0.03, 0.20, true},
+        {100.0, 100.0, 10.0, 0.03, 0.08, 0.20, false},
+    };
+    for (const auto &c : cases)
+    {
+        AmericanVanillaBSInput in{c.S, c.K, c.T, c.r, c.q, c.sigma, c.is_call};
+        in.tree_steps = 2000;
+        const Real tree = priceRegistry(in, EngineKind::BinomialTree).npv;
+        const Real alo = priceRegistry(in, EngineKind::Analytic).npv;
+        EXPECT_NEAR(alo, tree, 5e-3) << "S=" << c.S << " T=" << c.T;
+    }
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  2. Structure
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(AmericanAnalytic, CallWithoutDividendsIsEuropean)
+{
+    const Real european = priceEuropean(100.0, 95.0, 2.0, 0.05, 0.0, 0.3, true);
+    auto res = priceDirect(100.0, 95.0, 2.0, 0.05, 0.0, 0.3, true);
+    EXPECT_NEAR(res.npv, european, 1e-10);
+    EXPECT_NE(res.diagnostics.find("European"), std::string::npos);
+}
+
+TEST(AmericanAnalytic, PutCallSymmetry)
+{
+    // McDonald-Schroder: C(S, K, r, q) = P(K, S, q, r).
+    const Real call = priceDirect(105.0, 100.0, 1.5, 0.03, 0.07, 0.25, true).npv;
+    const Real put = priceDirect(100.0, 105.0, 1.5, 0.07, 0.03, 0.25, false).npv;
+    EXPECT_NEAR(call, put, 1e-10);
+}
+
+TEST(AmericanAnalytic, DeepInTheMoneyIsIntrinsic)
+{
+    auto res = priceDirect(60.0, 100.0, 1.0, 0.05, 0.0, 0.2, false);
+    EXPECT_DOUBLE_EQ(res.npv, 40.0);
+    EXPECT_NEAR(*res.greeks.delta, -1.0, 1e-12);
+    EXPECT_NEAR(*res.greeks.theta, 0.0, 1e-12);
+}
+
+TEST(AmericanAnalytic, AboveEuropeanAndIntrinsic)
+{
+    const Real european = priceEuropean(95.0, 100.0, 2.0, 0.06, 0.01, 0.3, false);
+    const Real american = priceDirect(95.0, 100.0, 2.0, 0.06, 0.01, 0.3, false).npv;
+    EXPECT_GT(american, european);
+    EXPECT_GT(american, 5.0);
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  3. Greeks
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(AmericanAnalytic, GreeksMatchFiniteDifferences)
+{
+    const Real S = 100.0, K = 100.0, T = 1.0, r = 0.05, q = 0.02, sigma = 0.25;
+    auto base = priceDirect(S, K, T, r, q, sigma, false);
+    const auto npv = [&](Real S_, Real T_, Real r_, Real sig_)
+    {
+        return priceDirect(S_, K, T_, r_, q, sig_, false).npv;
+    };
+
+    const Real hS = 0.01;
+    EXPECT_NEAR(*base.greeks.delta, (npv(S + hS, T, r, sigma) - npv(S - hS, T, r, sigma)) / (2.0 * hS), 1e-6);
+    EXPECT_NEAR(*base.greeks.gamma,
+                (npv(S + hS, T, r, sigma) - 2.0 * base.npv + npv(S - hS, T, r, sigma)) / (hS * hS), 1e-4);
+    EXPECT_NEAR(*base.greeks.vega, (npv(S, T, r, sigma + 1e-3) - npv(S, T, r, sigma - 1e-3)) / 2e-3, 1e-4);
+    EXPECT_NEAR(*base.greeks.rho, (npv(S, T, r + 1e-4, sigma) - npv(S, T, r - 1e-4, sigma)) / 2e-4, 1e-4);
+    EXPECT_NEAR(*base.greeks.theta, -(npv(S, T + 1e-3, r, sigma) - npv(S, T - 1e-3, r, sigma)) / 2e-3, 1e-4);
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  4. Validation and registry
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(AmericanAnalytic, RejectsEuropeanExercise)
+{
+    EXPECT_THROW(priceDirect(100.0, 100.0, 1.0, 0.05, 0.0, 0.2, false,
+                             AmericanAnalyticScheme::ALOAccurate, ExerciseType::European),
+                 UnsupportedInstrument);
+}
+
+TEST(AmericanAnalytic, RejectsDoubleBoundaryRegime)
+{
+    EXPECT_THROW(priceDirect(100.0, 100.0, 1.0, -0.01, -0.02, 0.2, false), UnsupportedInstrument);
+    // Negative rates with q ≥ r: early exercise of the put is never optimal.
+    const Real european = priceEuropean(100.0, 100.0, 1.0, -0.01, 0.0, 0.2, false);
+    EXPECT_NEAR(priceDirect(100.0, 100.0, 1.0, -0.01, 0.0, 0.2, false).npv, european, 1e-10);
+}
+
+TEST(AmericanAnalytic, RejectsEquityFuture)
+{
+    PricingSettings settings{0, 0, true, 100, 100, 100};
+    PricingContext ctx{MarketView{}, settings, std::make_shared<BlackScholesModel>(100.0, 0.05, 0.0, 0.2)};
+    BSAmericanAnalyticEngine engine(ctx);
+    EquityFuture fut(100.0, 1.0, 1.0);
+    EXPECT_THROW(price(fut, engine), UnsupportedInstrument);
+}
+
+TEST(AmericanAnalytic, RegistryAnalyticAndBAW)
+{
+    AmericanVanillaBSInput in{100.0, 100.0, 1.0, 0.05, 0.0, 0.2, false};
+    auto alo = priceRegistry(in, EngineKind::Analytic);
+    EXPECT_NEAR(alo.npv, 6.090370590955, 1e-8);
+    ASSERT_TRUE(alo.greeks.delta.has_value());
+
+    in.baw_approximation = true;
+    auto baw = priceRegistry(in, EngineKind::Analytic);
+    EXPECT_NE(baw.diagnostics.find("Barone-Adesi-Whaley"), std::string::npos);
+    EXPECT_NEAR(baw.npv, alo.npv, 2e-2);
+}
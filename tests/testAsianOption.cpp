@@ -278,6 +278,105 @@ namespace quantModeling
         EXPECT_GT(arithPrice - geomPrice, 0.01); // Meaningful difference
     }
 
+    // ============================================================================
+    // PDE (Vecer) Tests
+    // ============================================================================
+
+    TEST_F(AsianOptionTest, PDEMatchesContinuousAveragingBenchmarks)
+    {
+        // Continuous-averaging reference values, q = 0 (Linetsky 2004).  At
+        // the default 200 x 200 grid the worst case (S = 2.1) is 2.0e-5 off.
+        const struct
+        {
+            Real S, K, r, sigma, T, ref;
+        } cases[] = {
+            {2.0, 2.0, 0.02, 0.10, 1.0, 0.0559860415},
+            {2.0, 2.0, 0.18, 0.30, 1.0, 0.2183875466},
+            {2.0, 2.0, 0.0125, 0.25, 2.0, 0.1722687410},
+            {1.9, 2.0, 0.05, 0.50, 1.0, 0.1931737370},
+            {2.0, 2.0, 0.05, 0.50, 1.0, 0.2464156900},
+            {2.1, 2.0, 0.05, 0.50, 1.0, 0.3062203640},
+            {2.0, 2.0, 0.05, 0.50, 2.0, 0.3500952740},
+        };
+
+        for (const auto &c : cases)
+        {
+            AsianBSInput in{c.S, c.K, c.T, c.r, 0.0, c.sigma, true};
+            PricingRequest request{
+                InstrumentKind::EquityAsianOption,
+                ModelKind::BlackScholes,
+                EngineKind::PDEFiniteDifference,
+                PricingInput{in}};
+            EXPECT_NEAR(default_registry().price(request).npv, c.ref, 2.1e-5)
+                << "S=" << c.S << " sigma=" << c.sigma << " T=" << c.T;
+        }
+    }
+
+    TEST_F(AsianOptionTest, PDEConvergesWithGrid)
+    {
+        const Real ref = 0.2464156900;
+        const auto error = [&](int steps)
+        {
+            AsianBSInput in{2.0, 2.0, 1.0, 0.05, 0.0, 0.5, true};
+            in.pde_space_steps = steps;
+            in.pde_time_steps = steps;
+            PricingRequest request{
+                InstrumentKind::EquityAsianOption,
+                ModelKind::BlackScholes,
+                EngineKind::PDEFiniteDifference,
+                PricingInput{in}};
+            return std::abs(default_registry().price(request).npv - ref);
+        };
+
+        // Second order: quadrupling the grid cuts the error ~16 times.
+        EXPECT_LT(error(400), error(100) / 8.0);
+    }
+
+    TEST_F(AsianOptionTest, PDEPutCallParity)
+    {
+        const Real call = price_asian_registry(true, AsianAverageType::Arithmetic, EngineKind::PDEFiniteDifference).npv;
+        const Real put = price_asian_registry(false, AsianAverageType::Arithmetic, EngineKind::PDEFiniteDifference).npv;
+
+        // C − P = e^{−rT} (E[A_T] − K)
+        const Real mean_average = S0 * std::expm1((r - q) * T) / ((r - q) * T);
+        EXPECT_NEAR(call - put, std::exp(-r * T) * (mean_average - K), 1e-4);
+    }
+
+    TEST_F(AsianOptionTest, PDEGreeksMatchBumpAndReprice)
+    {
+        for (bool is_call : {true, false})
+        {
+            const auto price = [&](Real s, Real v, Real rate, Real mat)
+            {
+                AsianBSInput in{s, K, mat, rate, q, v, is_call};
+                PricingRequest request{
+                    InstrumentKind::EquityAsianOption,
+                    ModelKind::BlackScholes,
+                    EngineKind::PDEFiniteDifference,
+                    PricingInput{in}};
+                return default_registry().price(request).npv;
+            };
+
+            const PricingResult res = price_asian_registry(is_call, AsianAverageType::Arithmetic,
+                                                           EngineKind::PDEFiniteDifference);
+            const Real dS = 0.5, h = 1e-3;
+            const Real up = price(S0 + dS, sigma, r, T);
+            const Real down = price(S0 - dS, sigma, r, T);
+
+            EXPECT_NEAR(*res.greeks.delta, (up - down) / (2.0 * dS), 1e-4);
+            EXPECT_NEAR(*res.greeks.gamma, (up - 2.0 * res.npv + down) / (dS * dS), 1e-4);
+            EXPECT_NEAR(*res.greeks.vega, (price(S0, sigma + h, r, T) - price(S0, sigma - h, r, T)) / (2.0 * h), 1e-2);
+            EXPECT_NEAR(*res.greeks.rho, (price(S0, sigma, r + h, T) - price(S0, sigma, r - h, T)) / (2.0 * h), 1e-2);
+            EXPECT_NEAR(*res.greeks.theta, (price(S0, sigma, r, T - h) - price(S0, sigma, r, T + h)) / (2.0 * h), 1e-2);
+        }
+    }
+
+    TEST_F(AsianOptionTest, PDEGeometricUnsupported)
+    {
+        EXPECT_THROW(price_asian_registry(true, AsianAverageType::Geometric, EngineKind::PDEFiniteDifference),
+                     UnsupportedInstrument);
+    }
+
 } // namespace quantModeling
 
 int main(int argc, char **argv)
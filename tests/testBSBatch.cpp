@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include "quantModeling/engines/analytic/black_scholes_batch.hpp"
+#include "quantModeling/pricers/adapters/equity_vanilla.hpp"
+#include "quantModeling/pricers/registry.hpp"
+#include "quantModeling/utils/rng.hpp"
+#include "quantModeling/utils/vec_math.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace quantModeling;
+
+namespace
+{
+
+    VanillaBSBatchInput random_chain(std::size_t n, std::uint64_t seed)
+    {
+        Pcg32 rng(seed, 1);
+        VanillaBSBatchInput in;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            in.spot.push_back(50.0 + 100.0 * uniform01(rng));
+            in.strike.push_back(40.0 + 120.0 * uniform01(rng));
+            in.maturity.push_back(0.02 + 4.0 * uniform01(rng));
+            in.rate.push_back(-0.01 + 0.08 * uniform01(rng));
+            in.dividend.push_back(0.05 * uniform01(rng));
+            in.vol.push_back(0.05 + 0.7 * uniform01(rng));
+            in.is_call.push_back(static_cast<std::uint8_t>(i % 2));
+        }
+        return in;
+    }
+
+} // anonymous namespace
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  vec:: kernels
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(VecMath, ExpMatchesStd)
+{
+    for (Real x = -700.0; x <= 700.0; x += 0.3217)
+        EXPECT_NEAR(vec::exp(x) / std::exp(x), 1.0, 4e-16) << "x=" << x;
+    for (Real x = -1e-3; x <= 1e-3; x += 1.3e-5)
+        EXPECT_NEAR(vec::exp(x) / std::exp(x), 1.0, 4e-16) << "x=" << x;
+    EXPECT_EQ(vec::exp(0.0), 1.0);
+    EXPECT_EQ(vec::exp(-800.0), 0.0);
+    EXPECT_EQ(vec::exp(800.0), std::numeric_limits<Real>::infinity());
+}
+
+TEST(VecMath, LogMatchesStd)
+{
+    for (Real x = 1e-300; x < 1e300; x *= 1.7931)
+        EXPECT_NEAR(vec::log(x), std::log(x), 4e-16 * std::max(1.0, std::abs(std::log(x))))
+            << "x=" << x;
+    for (Real x = 0.9; x <= 1.1; x += 1.7e-4)
+        EXPECT_NEAR(vec::log(x), std::log(x), 4e-16 * std::max(1e-3, std::abs(std::log(x))))
+            << "x=" << x;
+    EXPECT_EQ(vec::log(1.0), 0.0);
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  Batch pricer vs scalar engine
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(BSBatch, MatchesScalarEngine)
+{
+    const auto in = random_chain(1000, 11);
+    const auto res = price_equity_vanilla_bs_batch(in);
+    ASSERT_EQ(res.npv.size(), in.spot.size());
+
+    for (std::size_t i = 0; i < in.spot.size(); ++i)
+    {
+        VanillaBSInput one{in.spot[i], in.strike[i], in.maturity[i], in.rate[i],
+                           in.dividend[i], in.vol[i], in.is_call[i] != 0};
+        const auto ref = price_equity_vanilla_bs(one, EngineKind::Analytic);
+        const Real tol = 1e-12;
+        EXPECT_NEAR(res.npv[i], ref.npv, tol * std::max(1.0, ref.npv)) << i;
+        EXPECT_NEAR(res.delta[i], *ref.greeks.delta, tol) << i;
+        EXPECT_NEAR(res.gamma[i], *ref.greeks.gamma, tol * std::max(1.0, *ref.greeks.gamma)) << i;
+        EXPECT_NEAR(res.vega[i], *ref.greeks.vega, tol * std::max(1.0, *ref.greeks.vega)) << i;
+        EXPECT_NEAR(res.theta[i], *ref.greeks.theta, tol * std::max(1.0, std::abs(*ref.greeks.theta))) << i;
+        EXPECT_NEAR(res.rho[i], *ref.greeks.rho, tol * std::max(1.0, std::abs(*ref.greeks.rho))) << i;
+    }
+}
+
+TEST(BSBatch, OptionalGreeksAndPartialBlock)
+{
+    const auto in = random_chain(300, 5); // one full block plus a tail
+    std::vector<Real> npv(in.spot.size()), delta(in.spot.size());
+
+    BSBatchInputView view{in.spot.size(), in.spot.data(), in.strike.data(),
+                          in.maturity.data(), in.rate.data(), in.dividend.data(),
+                          in.vol.data(), in.is_call.data()};
+    BSBatchOutputView out;
+    out.npv = npv.data();
+    out.delta = delta.data();
+    price_bs_batch(view, out);
+
+    const auto full = price_equity_vanilla_bs_batch(in);
+    for (std::size_t i = 0; i < npv.size(); ++i)
+    {
+        EXPECT_EQ(npv[i], full.npv[i]);
+        EXPECT_EQ(delta[i], full.delta[i]);
+    }
+}
+
+TEST(BSBatch, InvalidInputs)
+{
+    auto in = random_chain(10, 3);
+    in.vol[7] = 0.0;
+    EXPECT_THROW(price_equity_vanilla_bs_batch(in), InvalidInput);
+
+    in = random_chain(10, 3);
+    in.strike.pop_back();
+    EXPECT_THROW(price_equity_vanilla_bs_batch(in), InvalidInput);
+
+    EXPECT_NO_THROW(price_equity_vanilla_bs_batch(VanillaBSBatchInput{}));
+}
+
+// Timings only, recorded as test properties: a wall-clock comparison
+// does not belong in the unit suite.
+TEST(BSBatch, TimingVsScalarEngine)
+{
+    const auto in = random_chain(20000, 17);
+
+    const auto t0 = std::chrono::steady_clock::now();
+    const auto res = price_equity_vanilla_bs_batch(in);
+    const auto t1 = std::chrono::steady_clock::now();
+    Real sink = 0.0;
+    for (std::size_t i = 0; i < in.spot.size(); ++i)
+    {
+        VanillaBSInput one{in.spot[i], in.strike[i], in.maturity[i], in.rate[i],
+                           in.dividend[i], in.vol[i], in.is_call[i] != 0};
+        sink += price_equity_vanilla_bs(one, EngineKind::Analytic).npv;
+    }
+    const auto t2 = std::chrono::steady_clock::now();
+
+    const double batch_ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    const double scalar_ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    RecordProperty("batch_ms", std::to_string(batch_ms));
+    RecordProperty("scalar_ms", std::to_string(scalar_ms));
+    EXPECT_GT(sink, 0.0);
+    EXPECT_GT(res.npv.back() + 1.0, 0.0);
+}
@@ -4,6 +4,8 @@
 #include "quantModeling/pricers/registry.hpp"
 
 #include <cmath>
+#include <tuple>
+#include <utility>
 
 namespace quantModeling
 {
@@ -60,6 +62,33 @@ namespace quantModeling
             return default_registry().price(request);
         }
 
+        PricingResult priceBarrierAnalytic(const BarrierBSInput &in)
+        {
+            PricingRequest request{
+                InstrumentKind::EquityBarrierOption,
+                ModelKind::BlackScholes,
+                EngineKind::Analytic,
+                PricingInput{in}};
+            return default_registry().price(request);
+        }
+
+        BarrierBSInput makeInput(bool is_call, BarrierType bt, Real strike, Real barrier_level,
+                                 Real rebate = 0.0)
+        {
+            BarrierBSInput in{};
+            in.spot = S0;
+            in.strike = strike;
+            in.maturity = T;
+            in.rate = r;
+            in.dividend = q;
+            in.vol = sigma;
+            in.is_call = is_call;
+            in.barrier_type = bt;
+            in.barrier_level = barrier_level;
+            in.rebate = rebate;
+            return in;
+        }
+
     } // namespace
 
     // ─────────────────────────────────────────────────────────────────────────
@@ -210,4 +239,382 @@ namespace quantModeling
         EXPECT_GT(priceBarrier(true, BarrierType::UpAndIn, 120.0).npv, 0.0);
     }
 
+    // ═════════════════════════════════════════════════════════════════════════
+    //  Analytic engine (Reiner-Rubinstein)
+    // ═════════════════════════════════════════════════════════════════════════
+
+    TEST(BarrierAnalytic, MatchesHaugKnockInTable)
+    {
+        // Haug, "The Complete Guide to Option Pricing Formulas", Table 4-13:
+        // S=100, T=0.5, r=0.08, b=0.04, σ=0.25, rebate 3 (paid at expiry for
+        // knock-ins, so the convention matches this engine).
+        struct Case
+        {
+            bool call;
+            BarrierType bt;
+            Real H;
+            Real K;
+            Real expected;
+        };
+        const Case cases[] = {
+            {true, BarrierType::DownAndIn, 95.0, 90.0, 7.7627},
+            {true, BarrierType::DownAndIn, 95.0, 100.0, 4.0109},
+            {true, BarrierType::DownAndIn, 95.0, 110.0, 2.0576},
+            {true, BarrierType::UpAndIn, 105.0, 90.0, 14.1112},
+            {true, BarrierType::UpAndIn, 105.0, 100.0, 8.4482},
+            {true, BarrierType::UpAndIn, 105.0, 110.0, 4.5910},
+            {false, BarrierType::DownAndIn, 95.0, 90.0, 2.9586},
+            {false, BarrierType::DownAndIn, 95.0, 100.0, 6.5677},
+            {false, BarrierType::DownAndIn, 95.0, 110.0, 11.9752},
+            {false, BarrierType::UpAndIn, 105.0, 90.0, 1.4653},
+            {false, BarrierType::UpAndIn, 105.0, 100.0, 3.3721},
+            {false, BarrierType::UpAndIn, 105.0, 110.0, 7.0846},
+        };
+        for (const auto &c : cases)
+        {
+            BarrierBSInput in = makeInput(c.call, c.bt, c.K, c.H, 3.0);
+            in.maturity = 0.5;
+            in.rate = 0.08;
+            in.dividend = 0.04;
+            in.vol = 0.25;
+            EXPECT_NEAR(priceBarrierAnalytic(in).npv, c.expected, 1e-4)
+                << "call=" << c.call << " H=" << c.H << " K=" << c.K;
+        }
+    }
+
+    TEST(BarrierAnalytic, InOutParityAndRebateSplit)
+    {
+        const Real R = 2.5;
+        const Real df = std::exp(-r * T);
+        for (bool call : {true, false})
+            for (Real K : {85.0, 100.0, 115.0})
+            {
+                VanillaBSInput vin{S0, K, T, r, q, sigma, call};
+                const Real vanilla = default_registry().price(
+                                                           {InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                                                            EngineKind::Analytic, PricingInput{vin}})
+                                         .npv;
+                for (auto [in_t, out_t, H] : {std::tuple{BarrierType::DownAndIn, BarrierType::DownAndOut, 90.0},
+                                              std::tuple{BarrierType::UpAndIn, BarrierType::UpAndOut, 110.0}})
+                {
+                    const Real ki = priceBarrierAnalytic(makeInput(call, in_t, K, H)).npv;
+                    const Real ko = priceBarrierAnalytic(makeInput(call, out_t, K, H)).npv;
+                    EXPECT_NEAR(ki + ko, vanilla, 1e-12) << "call=" << call << " K=" << K << " H=" << H;
+                    EXPECT_GE(ki, -1e-14);
+                    EXPECT_GE(ko, -1e-14);
+
+                    // Rebates split the discounted amount between touch and no-touch.
+                    const Real ki_r = priceBarrierAnalytic(makeInput(call, in_t, K, H, R)).npv;
+                    const Real ko_r = priceBarrierAnalytic(makeInput(call, out_t, K, H, R)).npv;
+                    EXPECT_NEAR((ki_r - ki) + (ko_r - ko), R * df, 1e-12);
+                }
+            }
+    }
+
+    TEST(BarrierAnalytic, GreeksMatchFiniteDifferences)
+    {
+        for (bool brownian_bridge : {true, false})
+            for (auto [bt, H] : {std::pair{BarrierType::DownAndOut, 90.0}, std::pair{BarrierType::UpAndIn, 115.0},
+                                 std::pair{BarrierType::UpAndOut, 120.0}, std::pair{BarrierType::DownAndIn, 85.0}})
+            {
+                BarrierBSInput in = makeInput(false, bt, 105.0, H, 1.5);
+                in.brownian_bridge = brownian_bridge;
+                in.n_steps = 50;
+                const auto res = priceBarrierAnalytic(in);
+                ASSERT_TRUE(res.greeks.delta && res.greeks.gamma && res.greeks.vega &&
+                            res.greeks.rho && res.greeks.theta);
+
+                const auto bumped = [&](Real dS, Real dv, Real dr, Real dT)
+                {
+                    BarrierBSInput b = in;
+                    b.spot += dS;
+                    b.vol += dv;
+                    b.rate += dr;
+                    b.maturity += dT;
+                    return priceBarrierAnalytic(b).npv;
+                };
+                const Real h = 1e-3;
+                const Real fd_delta = (bumped(h, 0, 0, 0) - bumped(-h, 0, 0, 0)) / (2 * h);
+                const Real fd_gamma = (bumped(h, 0, 0, 0) - 2 * res.npv + bumped(-h, 0, 0, 0)) / (h * h);
+                const Real fd_vega = (bumped(0, 1e-5, 0, 0) - bumped(0, -1e-5, 0, 0)) / 2e-5;
+                const Real fd_rho = (bumped(0, 0, 1e-5, 0) - bumped(0, 0, -1e-5, 0)) / 2e-5;
+                const Real fd_theta = -(bumped(0, 0, 0, 1e-5) - bumped(0, 0, 0, -1e-5)) / 2e-5;
+
+                EXPECT_NEAR(*res.greeks.delta, fd_delta, 1e-6);
+                EXPECT_NEAR(*res.greeks.gamma, fd_gamma, 1e-4);
+                EXPECT_NEAR(*res.greeks.vega, fd_vega, 1e-5);
+                EXPECT_NEAR(*res.greeks.rho, fd_rho, 1e-5);
+                EXPECT_NEAR(*res.greeks.theta, fd_theta, 1e-5);
+            }
+    }
+
+    TEST(BarrierAnalytic, AgreesWithMonteCarlo)
+    {
+        // Continuous (MC with Brownian bridge) and discrete monthly monitoring
+        // (MC without bridge vs BGK-shifted closed form).
+        for (bool brownian_bridge : {true, false})
+            for (auto [call, bt, H] : {std::tuple{true, BarrierType::DownAndOut, 90.0},
+                                       std::tuple{false, BarrierType::UpAndOut, 110.0},
+                                       std::tuple{true, BarrierType::UpAndIn, 115.0}})
+            {
+                BarrierBSInput in = makeInput(call, bt, K, H, 1.0);
+                in.brownian_bridge = brownian_bridge;
+                in.n_steps = 12;
+                in.n_paths = 200000;
+                in.seed = 7;
+                PricingRequest request{InstrumentKind::EquityBarrierOption, ModelKind::BlackScholes,
+                                       EngineKind::MonteCarlo, PricingInput{in}};
+                const auto mc = default_registry().price(request);
+                const auto an = priceBarrierAnalytic(in);
+                EXPECT_NEAR(an.npv, mc.npv, 4.0 * mc.mc_std_error + 0.01 * an.npv)
+                    << "bb=" << brownian_bridge << " H=" << H << "\n"
+                    << an.diagnostics;
+            }
+    }
+
+    TEST(BarrierAnalytic, SpotThroughBarrierIsKnocked)
+    {
+        const Real df = std::exp(-r * T);
+        VanillaBSInput vin{S0, K, T, r, q, sigma, true};
+        const Real vanilla = default_registry().price(
+                                                   {InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                                                    EngineKind::Analytic, PricingInput{vin}})
+                                 .npv;
+
+        EXPECT_NEAR(priceBarrierAnalytic(makeInput(true, BarrierType::DownAndOut, K, 105.0, 2.0)).npv,
+                    2.0 * df, 1e-14);
+        EXPECT_NEAR(priceBarrierAnalytic(makeInput(true, BarrierType::DownAndIn, K, 105.0)).npv,
+                    vanilla, 1e-12);
+        EXPECT_NEAR(priceBarrierAnalytic(makeInput(true, BarrierType::UpAndIn, K, 95.0)).npv,
+                    vanilla, 1e-12);
+    }
+
+    TEST(BarrierAnalytic, DiscreteMonitoringSitsBetweenContinuousAndVanilla)
+    {
+        BarrierBSInput in = makeInput(true, BarrierType::DownAndOut, K, 90.0);
+        const Real continuous = priceBarrierAnalytic(in).npv;
+        in.brownian_bridge = false;
+        in.n_steps = 12;
+        const Real monthly = priceBarrierAnalytic(in).npv;
+        in.n_steps = 252;
+        const Real daily = priceBarrierAnalytic(in).npv;
+        const Real vanilla = priceVanillaAnalytic(true).npv;
+
+        EXPECT_LT(continuous, daily);
+        EXPECT_LT(daily, monthly);
+        EXPECT_LT(monthly, vanilla);
+    }
+
+    // ═════════════════════════════════════════════════════════════════════════
+    //  PDE engine (Crank-Nicolson, BS and local vol)
+    // ═════════════════════════════════════════════════════════════════════════
+
+    namespace
+    {
+        PricingResult priceBarrierPDE(const BarrierBSInput &in)
+        {
+            PricingRequest request{
+                InstrumentKind::EquityBarrierOption,
+                ModelKind::BlackScholes,
+                EngineKind::PDEFiniteDifference,
+                PricingInput{in}};
+            return default_registry().price(request);
+        }
+
+        PricingResult priceDoubleBarrierPDE(const DoubleBarrierLocalVolInput &in)
+        {
+            PricingRequest request{
+                InstrumentKind::EquityDoubleBarrierOption,
+                ModelKind::DupireLocalVol,
+                EngineKind::PDEFiniteDifference,
+                PricingInput{in}};
+            return default_registry().price(request);
+        }
+
+        LocalVolSurface flatSurface(Real vol)
+        {
+            return LocalVolSurface{{50.0, 200.0}, {0.01, 2.0}, {vol, vol, vol, vol}};
+        }
+
+        DoubleBarrierLocalVolInput makeDoubleInput(bool is_call, DoubleBarrierType bt, Real L, Real U,
+                                                   Real rebate = 0.0)
+        {
+            DoubleBarrierLocalVolInput in{};
+            in.spot = S0;
+            in.strike = K;
+            in.maturity = T;
+            in.rate = r;
+            in.dividend = q;
+            in.is_call = is_call;
+            in.barrier_type = bt;
+            in.lower_barrier = L;
+            in.upper_barrier = U;
+            in.rebate = rebate;
+            in.surface = flatSurface(sigma);
+            return in;
+        }
+    } // namespace
+
+    TEST(BarrierPDE, MatchesAnalyticContinuous)
+    {
+        for (auto [bt, H] : {std::pair{BarrierType::UpAndIn, 120.0}, std::pair{BarrierType::UpAndOut, 120.0},
+                             std::pair{BarrierType::DownAndIn, 85.0}, std::pair{BarrierType::DownAndOut, 85.0}})
+            for (bool call : {true, false})
+            {
+                const BarrierBSInput in = makeInput(call, bt, K, H, 2.0);
+                const auto pde = priceBarrierPDE(in);
+                const auto an = priceBarrierAnalytic(in);
+                ASSERT_TRUE(pde.greeks.delta && pde.greeks.gamma && pde.greeks.vega &&
+                            pde.greeks.rho && pde.greeks.theta);
+                EXPECT_NEAR(pde.npv, an.npv, 1e-3) << "call=" << call << " H=" << H;
+                EXPECT_NEAR(*pde.greeks.delta, *an.greeks.delta, 1e-4);
+                EXPECT_NEAR(*pde.greeks.gamma, *an.greeks.gamma, 1e-5);
+                EXPECT_NEAR(*pde.greeks.vega, *an.greeks.vega, 1e-2);
+                EXPECT_NEAR(*pde.greeks.rho, *an.greeks.rho, 1e-2);
+                EXPECT_NEAR(*pde.greeks.theta, *an.greeks.theta, 1e-3);
+            }
+    }
+
+    TEST(BarrierPDE, DiscreteMonitoringMatchesMonteCarlo)
+    {
+        // Monthly monitoring: the MC engine without the bridge is exact in
+        // distribution, unlike the BGK-shifted closed form.
+        for (auto [call, bt, H] : {std::tuple{true, BarrierType::UpAndOut, 120.0},
+                                   std::tuple{false, BarrierType::DownAndOut, 85.0},
+                                   std::tuple{true, BarrierType::DownAndIn, 90.0}})
+        {
+            BarrierBSInput in = makeInput(call, bt, K, H, 1.0);
+            in.brownian_bridge = false;
+            in.n_steps = 12;
+            in.n_paths = 200000;
+            in.seed = 7;
+            PricingRequest request{InstrumentKind::EquityBarrierOption, ModelKind::BlackScholes,
+                                   EngineKind::MonteCarlo, PricingInput{in}};
+            const auto mc = default_registry().price(request);
+            const auto pde = priceBarrierPDE(in);
+            EXPECT_NEAR(pde.npv, mc.npv, 4.0 * mc.mc_std_error) << "H=" << H << "\n"
+                                                                << pde.diagnostics;
+        }
+    }
+
+    TEST(BarrierPDE, DiscreteMonitoringConvergesWithGrid)
+    {
+        BarrierBSInput in = makeInput(true, BarrierType::UpAndOut, K, 120.0);
+        in.brownian_bridge = false;
+        in.n_steps = 12;
+        const Real coarse = priceBarrierPDE(in).npv;
+        in.pde_space_steps = 800;
+        in.pde_time_steps = 800;
+        const Real fine = priceBarrierPDE(in).npv;
+        EXPECT_NEAR(coarse, fine, 2e-3);
+    }
+
+    TEST(BarrierPDE, InOutParity)
+    {
+        const Real R = 1.5;
+        const Real df = std::exp(-r * T);
+        for (bool brownian_bridge : {true, false})
+            for (bool call : {true, false})
+                for (auto [in_t, out_t, H] : {std::tuple{BarrierType::DownAndIn, BarrierType::DownAndOut, 90.0},
+                                              std::tuple{BarrierType::UpAndIn, BarrierType::UpAndOut, 110.0}})
+                {
+                    BarrierBSInput ki_in = makeInput(call, in_t, K, H, R);
+                    BarrierBSInput ko_in = makeInput(call, out_t, K, H, R);
+                    ki_in.brownian_bridge = ko_in.brownian_bridge = brownian_bridge;
+                    ki_in.n_steps = ko_in.n_steps = 12;
+                    const Real vanilla = priceVanillaAnalytic(call).npv;
+                    EXPECT_NEAR(priceBarrierPDE(ki_in).npv + priceBarrierPDE(ko_in).npv, vanilla + R * df, 1e-3)
+                        << "bb=" << brownian_bridge << " call=" << call << " H=" << H;
+                }
+    }
+
+    TEST(BarrierPDE, SpotThroughBarrierIsKnocked)
+    {
+        const Real df = std::exp(-r * T);
+        const auto ko = priceBarrierPDE(makeInput(true, BarrierType::DownAndOut, K, 105.0, 2.0));
+        EXPECT_NEAR(ko.npv, 2.0 * df, 1e-14);
+        EXPECT_NEAR(*ko.greeks.delta, 0.0, 1e-14);
+        EXPECT_NEAR(priceBarrierPDE(makeInput(true, BarrierType::UpAndIn, K, 95.0)).npv,
+                    priceVanillaAnalytic(true).npv, 1e-3);
+    }
+
+    TEST(BarrierPDE, FlatLocalVolMatchesBlackScholes)
+    {
+        for (bool brownian_bridge : {true, false})
+        {
+            BarrierBSInput bs = makeInput(false, BarrierType::UpAndOut, K, 115.0, 1.0);
+            bs.brownian_bridge = brownian_bridge;
+            bs.n_steps = 12;
+
+            BarrierLocalVolInput lv{};
+            lv.spot = S0;
+            lv.strike = K;
+            lv.maturity = T;
+            lv.rate = r;
+            lv.dividend = q;
+            lv.is_call = false;
+            lv.barrier_type = BarrierType::UpAndOut;
+            lv.barrier_level = 115.0;
+            lv.rebate = 1.0;
+            lv.brownian_bridge = brownian_bridge;
+            lv.n_steps = 12;
+            lv.surface = flatSurface(sigma);
+            PricingRequest request{InstrumentKind::EquityBarrierOption, ModelKind::DupireLocalVol,
+                                   EngineKind::PDEFiniteDifference, PricingInput{lv}};
+            const auto res = default_registry().price(request);
+            EXPECT_NEAR(res.npv, priceBarrierPDE(bs).npv, 1e-10);
+            EXPECT_NE(res.diagnostics.find("local vol"), std::string::npos) << res.diagnostics;
+        }
+    }
+
+    TEST(DoubleBarrierPDE, InOutParityAndBounds)
+    {
+        const Real R = 1.0;
+        const Real df = std::exp(-r * T);
+        for (bool brownian_bridge : {true, false})
+            for (bool call : {true, false})
+            {
+                auto ko_in = makeDoubleInput(call, DoubleBarrierType::KnockOut, 80.0, 125.0, R);
+                auto ki_in = makeDoubleInput(call, DoubleBarrierType::KnockIn, 80.0, 125.0, R);
+                ko_in.brownian_bridge = ki_in.brownian_bridge = brownian_bridge;
+                ko_in.n_steps = ki_in.n_steps = 12;
+                const Real ko = priceDoubleBarrierPDE(ko_in).npv;
+                const Real ki = priceDoubleBarrierPDE(ki_in).npv;
+                EXPECT_NEAR(ki + ko, priceVanillaAnalytic(call).npv + R * df, 1e-3);
+
+                // Without a rebate, either barrier alone is worth more.
+                ko_in.rebate = 0.0;
+                const Real ko_plain = priceDoubleBarrierPDE(ko_in).npv;
+                EXPECT_GT(ko_plain, 0.0);
+                for (auto [bt, H] : {std::pair{BarrierType::DownAndOut, 80.0}, std::pair{BarrierType::UpAndOut, 125.0}})
+                {
+                    BarrierBSInput single = makeInput(call, bt, K, H);
+                    single.brownian_bridge = brownian_bridge;
+                    single.n_steps = 12;
+                    EXPECT_LT(ko_plain, priceBarrierPDE(single).npv) << "call=" << call << " H=" << H;
+                }
+            }
+    }
+
+    TEST(DoubleBarrierPDE, DistantBarrierReducesToSingle)
+    {
+        // A lower barrier ten standard deviations down never triggers.
+        for (bool brownian_bridge : {true, false})
+        {
+            auto dbl = makeDoubleInput(true, DoubleBarrierType::KnockOut, 10.0, 120.0);
+            dbl.brownian_bridge = brownian_bridge;
+            dbl.n_steps = 12;
+            BarrierBSInput single = makeInput(true, BarrierType::UpAndOut, K, 120.0);
+            single.brownian_bridge = brownian_bridge;
+            single.n_steps = 12;
+            EXPECT_NEAR(priceDoubleBarrierPDE(dbl).npv, priceBarrierPDE(single).npv, 1e-3);
+        }
+    }
+
+    TEST(DoubleBarrierPDE, RejectsMisorderedBarriers)
+    {
+        EXPECT_THROW(priceDoubleBarrierPDE(makeDoubleInput(true, DoubleBarrierType::KnockOut, 120.0, 80.0)),
+                     InvalidInput);
+    }
+
 } // namespace quantModeling
@@ -6,6 +6,10 @@
 #include "quantModeling/pricers/pricer.hpp"
 #include "quantModeling/pricers/registry.hpp"
 
+#include <cmath>
+#include <string>
+#include <vector>
+
 namespace quantModeling
 {
     namespace
@@ -209,5 +213,277 @@ namespace quantModeling
             EXPECT_THROW(default_registry().price(req), InvalidInput);
         }
 
+        // ── Analytic (Levy / Ju moment matching) ──────────────────────────────────────
+
+        BasketBSInput basket_input(bool is_call, Real rho, Real strike = K)
+        {
+            BasketBSInput in{};
+            in.spots = {S1, S2};
+            in.vols = {sig1, sig2};
+            in.dividends = {q1, q2};
+            in.weights = {0.5, 0.5};
+            in.correlations = {{1.0, rho}, {rho, 1.0}};
+            in.strike = strike;
+            in.maturity = T;
+            in.rate = r;
+            in.is_call = is_call;
+            return in;
+        }
+
+        PricingResult price_basket_analytic(const BasketBSInput &in)
+        {
+            PricingRequest request{
+                InstrumentKind::EquityBasketOption,
+                ModelKind::BlackScholes, EngineKind::Analytic,
+                PricingInput{in}};
+            return default_registry().price(request);
+        }
+
+        // 11. Ju removes most of Levy's error.  References: two-asset price by
+        //     conditioning on the first asset and integrating (Simpson, 20k nodes).
+        TEST(BasketAnalytic, JuImprovesOnLevy)
+        {
+            const struct
+            {
+                Real strike, ref;
+            } cases[] = {{80.0, 22.68739923}, {100.0, 9.05059498}, {120.0, 2.57894798}};
+
+            for (const auto &c : cases)
+            {
+                auto in = basket_input(true, 0.5, c.strike);
+                const Real ju = price_basket_analytic(in).npv;
+                in.ju_correction = false;
+                const Real levy = price_basket_analytic(in).npv;
+
+                EXPECT_NEAR(ju, c.ref, 2e-4) << "K=" << c.strike;
+                EXPECT_GT(std::abs(levy - c.ref), 20.0 * std::abs(ju - c.ref)) << "K=" << c.strike;
+            }
+        }
+
+        // 12. Analytic price lies within MC error bars.
+        TEST(BasketAnalytic, AgreesWithMonteCarlo)
+        {
+            for (bool is_call : {true, false})
+            {
+                const auto mc = price_basket(is_call, 0.3, 400000, 7);
+                const auto an = price_basket_analytic(basket_input(is_call, 0.3));
+                EXPECT_NEAR(an.npv, mc.npv, 4.0 * mc.mc_std_error) << (is_call ? "call" : "put");
+            }
+        }
+
+        // 13. Put-call parity holds exactly: the correction has zero forward.
+        TEST(BasketAnalytic, PutCallParity)
+        {
+            const Real c = price_basket_analytic(basket_input(true, 0.4, 105.0)).npv;
+            const Real p = price_basket_analytic(basket_input(false, 0.4, 105.0)).npv;
+            const Real fwd = 0.5 * S1 * std::exp((r - q1) * T) + 0.5 * S2 * std::exp((r - q2) * T);
+            EXPECT_NEAR(c - p, std::exp(-r * T) * (fwd - 105.0), 1e-10);
+        }
+
+        // 14. Identical, perfectly correlated assets form a lognormal basket:
+        //     both schemes collapse to Black-Scholes.
+        TEST(BasketAnalytic, LognormalBasketIsExact)
+        {
+            auto in = basket_input(true, 1.0 - 1e-12);
+            in.vols = {sig1, sig1};
+            const Real bs = price_vanilla_analytic(true).npv;
+            EXPECT_NEAR(price_basket_analytic(in).npv, bs, 1e-8);
+            in.ju_correction = false;
+            EXPECT_NEAR(price_basket_analytic(in).npv, bs, 1e-8);
+        }
+
+        // 15. Per-asset and aggregate Greeks match bump-and-reprice.
+        TEST(BasketAnalytic, GreeksMatchFiniteDifferences)
+        {
+            const auto base = basket_input(true, 0.3, 95.0);
+            const auto res = price_basket_analytic(base);
+            ASSERT_EQ(res.greeks.delta_per_asset.size(), 2u);
+
+            const auto npv = [](const BasketBSInput &in)
+            { return price_basket_analytic(in).npv; };
+
+            Real delta_sum = 0.0;
+            for (int i = 0; i < 2; ++i)
+            {
+                const Real h = 1e-3 * base.spots[i];
+                auto up = base, dn = base;
+                up.spots[i] += h;
+                dn.spots[i] -= h;
+                const Real fd_delta = (npv(up) - npv(dn)) / (2.0 * h);
+                const Real fd_gamma = (npv(up) - 2.0 * res.npv + npv(dn)) / (h * h);
+                EXPECT_NEAR(res.greeks.delta_per_asset[i], fd_delta, 1e-6) << "asset " << i;
+                EXPECT_NEAR(res.greeks.gamma_per_asset[i], fd_gamma, 1e-5) << "asset " << i;
+
+                const Real hv = 1e-4;
+                auto vup = base, vdn = base;
+                vup.vols[i] += hv;
+                vdn.vols[i] -= hv;
+                EXPECT_NEAR(res.greeks.vega_per_asset[i], (npv(vup) - npv(vdn)) / (2.0 * hv), 1e-5)
+                    << "asset " << i;
+                delta_sum += res.greeks.delta_per_asset[i];
+            }
+            EXPECT_NEAR(*res.greeks.delta, delta_sum, 1e-12);
+
+            const Real eps = 1e-3;
+            auto sup = base, sdn = base;
+            for (int i = 0; i < 2; ++i)
+            {
+                sup.spots[i] *= 1.0 + eps;
+                sdn.spots[i] *= 1.0 - eps;
+            }
+            const Real dB = 0.5 * (S1 + S2) * eps;
+            EXPECT_NEAR(*res.greeks.gamma, (npv(sup) - 2.0 * res.npv + npv(sdn)) / (dB * dB), 1e-5);
+
+            auto vup = base, vdn = base;
+            for (int i = 0; i < 2; ++i)
+            {
+                vup.vols[i] += 1e-4;
+                vdn.vols[i] -= 1e-4;
+            }
+            EXPECT_NEAR(*res.greeks.vega, (npv(vup) - npv(vdn)) / 2e-4, 1e-5);
+
+            auto rup = base, rdn = base;
+            rup.rate += 1e-5;
+            rdn.rate -= 1e-5;
+            EXPECT_NEAR(*res.greeks.rho, (npv(rup) - npv(rdn)) / 2e-5, 1e-5);
+
+            auto tup = base, tdn = base;
+            tup.maturity += 1e-5;
+            tdn.maturity -= 1e-5;
+            EXPECT_NEAR(*res.greeks.theta, -(npv(tup) - npv(tdn)) / 2e-5, 1e-5);
+        }
+
+        // 16. Non-positive basket forward cannot be mapped to a lognormal.
+        TEST(BasketAnalytic, NonPositiveForwardThrows)
+        {
+            auto in = basket_input(true, 0.3);
+            in.weights = {1.0, -1.0};
+            EXPECT_THROW(price_basket_analytic(in), InvalidInput);
+        }
+
+
+        // ── PDE (two-asset ADI) ───────────────────────────────────────────────────────
+
+        PricingResult price_basket_pde(const BasketBSInput &in)
+        {
+            PricingRequest request{
+                InstrumentKind::EquityBasketOption,
+                ModelKind::BlackScholes, EngineKind::PDEFiniteDifference,
+                PricingInput{in}};
+            return default_registry().price(request);
+        }
+
+        // 17. Same quadrature references as test 11.
+        TEST(BasketPDE, MatchesReferenceValues)
+        {
+            const struct
+            {
+                Real strike, ref;
+            } cases[] = {{80.0, 22.68739923}, {100.0, 9.05059498}, {120.0, 2.57894798}};
+
+            for (const auto &c : cases)
+                EXPECT_NEAR(price_basket_pde(basket_input(true, 0.5, c.strike)).npv, c.ref, 2e-3)
+                    << "K=" << c.strike;
+        }
+
+        // 18. Weights (1, −1) and K = 0 are an exchange option: Margrabe, which
+        //     tests the mixed-derivative term on its own.
+        TEST(BasketPDE, ExchangeOptionMatchesMargrabe)
+        {
+            for (Real rho : {-0.5, 0.0, 0.7})
+            {
+                auto in = basket_input(true, rho, 0.0);
+                in.spots = {100.0, 90.0};
+                in.weights = {1.0, -1.0};
+                const auto res = price_basket_pde(in);
+
+                const Real F1 = S1 * std::exp(-q1 * T);
+                const Real F2 = 90.0 * std::exp(-q2 * T);
+                const Real s = std::sqrt(sig1 * sig1 + sig2 * sig2 - 2.0 * rho * sig1 * sig2);
+                const Real d1 = (std::log(F1 / F2) + 0.5 * s * s * T) / (s * std::sqrt(T));
+                const Real d2 = d1 - s * std::sqrt(T);
+                const auto N = [](Real x) { return 0.5 * std::erfc(-x / std::sqrt(2.0)); };
+
+                EXPECT_NEAR(res.npv, F1 * N(d1) - F2 * N(d2), 1e-2) << "rho=" << rho;
+                EXPECT_NEAR(res.greeks.delta_per_asset[0], std::exp(-q1 * T) * N(d1), 1e-3);
+                EXPECT_NEAR(res.greeks.delta_per_asset[1], -std::exp(-q2 * T) * N(d2), 1e-3);
+            }
+        }
+
+        // 19. Grid Greeks agree with the (bump-verified) analytic ones.
+        TEST(BasketPDE, GreeksMatchAnalytic)
+        {
+            for (bool is_call : {true, false})
+            {
+                const auto in = basket_input(is_call, 0.3, 95.0);
+                const auto pde = price_basket_pde(in);
+                const auto an = price_basket_analytic(in);
+                ASSERT_EQ(pde.greeks.delta_per_asset.size(), 2u);
+                EXPECT_NEAR(pde.npv, an.npv, 2e-3);
+                for (int a = 0; a < 2; ++a)
+                {
+                    EXPECT_NEAR(pde.greeks.delta_per_asset[a], an.greeks.delta_per_asset[a], 1e-4);
+                    EXPECT_NEAR(pde.greeks.gamma_per_asset[a], an.greeks.gamma_per_asset[a], 1e-5);
+                }
+                EXPECT_NEAR(*pde.greeks.delta, *an.greeks.delta, 2e-4);
+                EXPECT_NEAR(*pde.greeks.gamma, *an.greeks.gamma, 1e-5);
+                EXPECT_NEAR(*pde.greeks.vega, *an.greeks.vega, 1e-2);
+                EXPECT_NEAR(*pde.greeks.rho, *an.greeks.rho, 1e-2);
+                EXPECT_NEAR(*pde.greeks.theta, *an.greeks.theta, 2e-3);
+            }
+        }
+
+        // 20. Put-call parity up to the discretisation error.
+        TEST(BasketPDE, PutCallParity)
+        {
+            const Real c = price_basket_pde(basket_input(true, 0.4, 105.0)).npv;
+            const Real p = price_basket_pde(basket_input(false, 0.4, 105.0)).npv;
+            const Real fwd = 0.5 * S1 * std::exp((r - q1) * T) + 0.5 * S2 * std::exp((r - q2) * T);
+            EXPECT_NEAR(c - p, std::exp(-r * T) * (fwd - 105.0), 1e-3);
+        }
+
+        // 21. Lines are solved identically however they are split.
+        TEST(BasketPDE, ThreadCountDoesNotChangeResult)
+        {
+            auto in = basket_input(true, 0.3);
+            in.pde_threads = 1;
+            const auto one = price_basket_pde(in);
+            in.pde_threads = 3;
+            const auto three = price_basket_pde(in);
+            EXPECT_EQ(one.npv, three.npv);
+            EXPECT_EQ(*one.greeks.gamma, *three.greeks.gamma);
+            EXPECT_EQ(*one.greeks.vega, *three.greeks.vega);
+        }
+
+        // 22. Under price_batch the default is one sweep thread per request,
+        //     with the same results.
+        TEST(BasketPDE, BatchRequestsSweepSingleThreaded)
+        {
+            std::vector<PricingRequest> requests;
+            for (bool is_call : {true, false})
+                requests.push_back({InstrumentKind::EquityBasketOption, ModelKind::BlackScholes,
+                                    EngineKind::PDEFiniteDifference, PricingInput{basket_input(is_call, 0.3)}});
+            const auto batch = default_registry().price_batch(requests);
+            ASSERT_EQ(batch.size(), requests.size());
+            for (std::size_t i = 0; i < requests.size(); ++i)
+            {
+                ASSERT_TRUE(batch[i].ok()) << batch[i].error;
+                EXPECT_NE(batch[i].result->diagnostics.find("threads=1)"), std::string::npos);
+                EXPECT_EQ(batch[i].result->npv, default_registry().price(requests[i]).npv);
+            }
+        }
+
+        // 23. The grid is two-dimensional only.
+        TEST(BasketPDE, ThreeAssetsUnsupported)
+        {
+            auto in = basket_input(true, 0.3);
+            in.spots.push_back(100.0);
+            in.vols.push_back(0.2);
+            in.dividends.push_back(0.0);
+            in.weights = {0.4, 0.3, 0.3};
+            in.correlations.clear();
+            EXPECT_THROW(price_basket_pde(in), UnsupportedInstrument);
+        }
+
     } // namespace
 } // namespace quantModeling
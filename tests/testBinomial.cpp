@@ -145,6 +145,18 @@ namespace quantModeling
         EXPECT_NEAR(tree_delta, ana_delta, 0.01);
     }
 
+    TEST(BinomialTree, GammaAndThetaConvergeToBS)
+    {
+        // Read off the lattice nodes around t = 0, not from re-built trees.
+        for (bool is_call : {true, false})
+        {
+            const auto ana = priceAnalytic(is_call);
+            const auto tree = priceBinomial(is_call, 500);
+            EXPECT_NEAR(*tree.greeks.gamma, *ana.greeks.gamma, 0.02 * *ana.greeks.gamma);
+            EXPECT_NEAR(*tree.greeks.theta, *ana.greeks.theta, 0.05);
+        }
+    }
+
     // ─────────────────────────────────────────────────────────────────────────
     //  American options
     // ─────────────────────────────────────────────────────────────────────────
@@ -178,6 +190,60 @@ namespace quantModeling
         EXPECT_GT(priceAmericanBinomial(false, 200).npv, 0.0);
     }
 
+    // ─────────────────────────────────────────────────────────────────────────
+    //  Leisen-Reimer and Richardson extrapolation
+    // ─────────────────────────────────────────────────────────────────────────
+
+    TEST(BinomialTree, LeisenReimerEuropeanAccuracy)
+    {
+        for (bool is_call : {true, false})
+        {
+            const auto ana = priceAnalytic(is_call);
+            VanillaBSInput in{S0, K, T, r, q, sigma, is_call};
+            in.tree_steps = 101;
+            in.tree_leisen_reimer = true;
+            PricingRequest request{InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                                   EngineKind::BinomialTree, PricingInput{in}};
+            const auto lr = default_registry().price(request);
+            EXPECT_NEAR(lr.npv, ana.npv, 1e-4);
+            EXPECT_NEAR(*lr.greeks.delta, *ana.greeks.delta, 1e-3);
+            EXPECT_NE(lr.diagnostics.find("Leisen-Reimer"), std::string::npos);
+
+            in.tree_richardson = true;
+            request.input = PricingInput{in};
+            EXPECT_NEAR(default_registry().price(request).npv, ana.npv, 1e-5);
+        }
+    }
+
+    TEST(BinomialTree, LeisenReimerRoundsToOddSteps)
+    {
+        VanillaBSInput in{S0, K, T, r, q, sigma, true};
+        in.tree_steps = 100;
+        in.tree_leisen_reimer = true;
+        PricingRequest request{InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                               EngineKind::BinomialTree, PricingInput{in}};
+        EXPECT_NE(default_registry().price(request).diagnostics.find("steps=101"), std::string::npos);
+    }
+
+    // The early-exercise boundary keeps the American error from being a
+    // clean power of N: 1e-4 takes about 400 steps (see BinomialVanillaEngine).
+    TEST(BinomialTree, LeisenReimerRichardsonAmerican)
+    {
+        AmericanVanillaBSInput in{S0, K, T, r, q, sigma, false};
+        const auto ref = default_registry().price(
+            {InstrumentKind::EquityAmericanVanillaOption, ModelKind::BlackScholes, EngineKind::Analytic,
+             PricingInput{in}});
+
+        in.tree_steps = 401;
+        in.tree_leisen_reimer = true;
+        in.tree_richardson = true;
+        const auto tree = default_registry().price(
+            {InstrumentKind::EquityAmericanVanillaOption, ModelKind::BlackScholes, EngineKind::BinomialTree,
+             PricingInput{in}});
+        EXPECT_NEAR(tree.npv, ref.npv, 1e-4);
+        EXPECT_NEAR(priceAmericanBinomial(false, 401).npv, ref.npv, 1e-2);
+    }
+
     // ─────────────────────────────────────────────────────────────────────────
     //  Diagnostics
     // ─────────────────────────────────────────────────────────────────────────
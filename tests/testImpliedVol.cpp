@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include "quantModeling/calibration/implied_vol.hpp"
+#include "quantModeling/pricers/adapters/equity_vanilla.hpp"
+#include "quantModeling/pricers/registry.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace quantModeling;
+
+namespace
+{
+
+    /// Reference normalised Black in long double (direct N(·) form).
+    long double reference_black(long double x, long double s, bool is_call)
+    {
+        auto N = [](long double z)
+        { return 0.5L * std::erfc(-z / std::sqrt(2.0L)); };
+        const long double th = is_call ? 1.0L : -1.0L;
+        return th * (std::exp(0.5L * x) * N(th * (x / s + 0.5L * s)) -
+                     std::exp(-0.5L * x) * N(th * (x / s - 0.5L * s)));
+    }
+
+} // anonymous namespace
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  Normalised Black
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(NormalisedBlack, MatchesExtendedPrecisionReference)
+{
+    for (Real x : {-3.0, -1.0, -0.2, -0.01, 0.0, 0.01, 0.2, 1.0, 3.0})
+        for (Real s : {0.05, 0.2, 0.5, 1.0, 2.0, 4.0})
+            for (bool call : {true, false})
+            {
+                const long double ref = reference_black(x, s, call);
+                const Real b = normalised_black(x, s, call);
+                EXPECT_NEAR(b, static_cast<Real>(ref), 1e-14 * static_cast<Real>(ref))
+                    << "x=" << x << " s=" << s << " call=" << call;
+            }
+}
+
+TEST(NormalisedBlack, SmallOutOfTheMoneyPricesKeepRelativePrecision)
+{
+    // b ≈ 1e-80: the direct form would cancel to zero or garbage.
+    const Real b = normalised_black(-4.0, 0.2, true);
+    EXPECT_GT(b, 0.0);
+    EXPECT_LT(b, 1e-70);
+    // Monotone in s down to tiny prices.
+    Real prev = 0.0;
+    for (Real s = 0.1; s < 3.0; s += 0.05)
+    {
+        const Real v = normalised_black(-2.0, s, true);
+        EXPECT_GT(v, prev);
+        prev = v;
+    }
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  Round trip: price(σ) → implied σ
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(ImpliedVol, RoundTripNormalisedGrid)
+{
+    const Real F = 100.0, df = 0.97;
+    for (Real K : {30.0, 60.0, 90.0, 99.0, 100.0, 101.0, 110.0, 150.0, 300.0})
+        for (Real T : {0.02, 0.25, 1.0, 5.0})
+            for (Real sigma : {0.01, 0.05, 0.2, 0.6, 1.5})
+                for (bool call : {true, false})
+                {
+                    const Real x = std::log(F / K);
+                    const Real s = sigma * std::sqrt(T);
+                    const Real b = normalised_black(x, s, call);
+                    const Real price = df * std::sqrt(F * K) * b;
+                    const Real intrinsic = std::max(call ? F - K : K - F, 0.0);
+                    // Skip quotes indistinguishable from intrinsic in double.
+                    if (price / df - intrinsic < 1e-12 * F || b < 1e-300)
+                        continue;
+                    const Real iv = implied_vol_black(price, F, K, T, df, call);
+                    // Out-of-the-money quotes invert to ~machine precision;
+                    // in-the-money quotes lose digits to the intrinsic part.
+                    const Real tol = (intrinsic == 0.0 ? 1e-13 : 1e-13 * F / (price / df - intrinsic));
+                    EXPECT_NEAR(iv, sigma, std::min(tol, 1e-4) * sigma)
+                        << "K=" << K << " T=" << T << " sigma=" << sigma << " call=" << call;
+                }
+}
+
+TEST(ImpliedVol, InvertsAnalyticEnginePrices)
+{
+    for (Real K : {80.0, 100.0, 120.0})
+        for (bool call : {true, false})
+        {
+            VanillaBSInput in{100.0, K, 1.5, 0.03, 0.01, 0.27, call};
+            const Real price = price_equity_vanilla_bs(in, EngineKind::Analytic).npv;
+            EXPECT_NEAR(implied_vol_bs(price, 100.0, K, 1.5, 0.03, 0.01, call), 0.27, 1e-12);
+        }
+}
+
+TEST(ImpliedVol, DeepOutOfTheMoneyLowVol)
+{
+    const Real F = 1.0, K = 2.0, T = 0.5, sigma = 0.05;
+    const Real price = std::sqrt(F * K) * normalised_black(std::log(F / K), sigma * std::sqrt(T), true);
+    ASSERT_GT(price, 0.0);
+    ASSERT_LT(price, 1e-50);
+    EXPECT_NEAR(implied_vol_black(price, F, K, T, 1.0, true), sigma, 1e-14);
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  Bounds and batch
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(ImpliedVol, BoundsAndInvalidInputs)
+{
+    // Exactly intrinsic → zero vol.
+    EXPECT_EQ(implied_vol_black(10.0, 110.0, 100.0, 1.0, 1.0, true), 0.0);
+    EXPECT_EQ(implied_vol_black(0.0, 90.0, 100.0, 1.0, 1.0, true), 0.0);
+    // Below intrinsic / above the maximum.
+    EXPECT_THROW(implied_vol_black(9.0, 110.0, 100.0, 1.0, 1.0, true), InvalidInput);
+    EXPECT_THROW(implied_vol_black(110.0, 110.0, 100.0, 1.0, 1.0, true), InvalidInput);
+    EXPECT_THROW(implied_vol_black(1.0, 100.0, 100.0, 0.0, 1.0, true), InvalidInput);
+    EXPECT_THROW(implied_vol_black(1.0, -1.0, 100.0, 1.0, 1.0, true), InvalidInput);
+}
+
+TEST(ImpliedVol, BatchMatchesScalarAndFlagsBadQuotes)
+{
+    std::vector<Real> price, spot, strike, T, r, q;
+    std::vector<std::uint8_t> is_call;
+    for (int i = 0; i < 200; ++i)
+    {
+        const Real K = 60.0 + 0.4 * i;
+        const bool call = i % 2 == 0;
+        VanillaBSInput in{100.0, K, 0.75, 0.02, 0.005, 0.15 + 0.001 * i, call};
+        price.push_back(price_equity_vanilla_bs(in, EngineKind::Analytic).npv);
+        spot.push_back(100.0);
+        strike.push_back(K);
+        T.push_back(0.75);
+        r.push_back(0.02);
+        q.push_back(0.005);
+        is_call.push_back(call ? 1 : 0);
+    }
+    price[17] = -1.0; // below intrinsic
+
+    std::vector<Real> vol(price.size());
+    ImpliedVolBatchInputView view{price.size(), price.data(), spot.data(), strike.data(),
+                                  T.data(), r.data(), q.data(), is_call.data()};
+    implied_vol_bs_batch(view, vol.data());
+
+    for (std::size_t i = 0; i < vol.size(); ++i)
+    {
+        if (i == 17)
+        {
+            EXPECT_TRUE(std::isnan(vol[i]));
+            continue;
+        }
+        EXPECT_EQ(vol[i], implied_vol_bs(price[i], spot[i], strike[i], T[i], r[i], q[i],
+                                         is_call[i] != 0))
+            << i;
+        // The engine's own rounding on deep OTM / ITM prices bounds this.
+        EXPECT_NEAR(vol[i], 0.15 + 0.001 * static_cast<Real>(i), 1e-8) << i;
+    }
+}
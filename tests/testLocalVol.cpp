@@ -2,6 +2,7 @@
 
 #include "quantModeling/pricers/registry.hpp"
 #include "quantModeling/engines/mc/local_vol.hpp"
+#include "quantModeling/engines/pde/dupire_forward.hpp"
 
 #include <cmath>
 #include <vector>
@@ -218,7 +219,7 @@ namespace quantModeling
 
     TEST(LocalVolMC, RegistryBarrierPath)
     {
-        // Only Barrier/Lookback/Asian are registered with DupireLocalVol
+        // Barrier/Lookback/Asian are registered with DupireLocalVol for MC
         BarrierLocalVolInput in{};
         in.spot = S0;
         in.strike = K;
@@ -242,4 +243,207 @@ namespace quantModeling
         EXPECT_GT(res.npv, 0.0);
     }
 
+    // ─────────────────────────────────────────────────────────────────────────
+    //  PDE engine under local vol
+    // ─────────────────────────────────────────────────────────────────────────
+
+    namespace
+    {
+        PricingResult priceLocalVolPDE(const LocalVolInput &in, bool american = false)
+        {
+            PricingRequest request{
+                american ? InstrumentKind::EquityAmericanVanillaOption : InstrumentKind::EquityVanillaOption,
+                ModelKind::DupireLocalVol,
+                EngineKind::PDEFiniteDifference,
+                PricingInput{in}};
+            return default_registry().price(request);
+        }
+
+        // Put skew: vol falls with K (as 1/K, so it stays positive on the
+        // whole grid), rises slowly with T.
+        LocalVolInput makeSkewLocalVolInput(Real strike)
+        {
+            LocalVolInput in = makeFlatLocalVolInput(false);
+            in.strike = strike;
+            in.K_grid = {50.0, 75.0, 100.0, 125.0, 150.0, 200.0};
+            in.T_grid = {0.0, 0.5, 1.0, 2.0};
+            in.sigma_loc_flat.clear();
+            for (Real k : in.K_grid)
+                for (Real t : in.T_grid)
+                    in.sigma_loc_flat.push_back(0.20 * S0 / k + 0.02 * t);
+            in.pde_space_steps = 200;
+            in.pde_time_steps = 200;
+            return in;
+        }
+    } // namespace
+
+    TEST(LocalVolPDE, FlatSurfaceMatchesBS)
+    {
+        for (bool is_call : {true, false})
+        {
+            const auto res = priceLocalVolPDE(makeFlatLocalVolInput(is_call));
+            const auto ref = priceAnalytic(is_call);
+            EXPECT_NEAR(res.npv, ref.npv, 2e-3);
+            ASSERT_TRUE(res.greeks.delta.has_value());
+            EXPECT_NEAR(*res.greeks.delta, *ref.greeks.delta, 1e-3);
+            EXPECT_NEAR(*res.greeks.gamma, *ref.greeks.gamma, 1e-4);
+            EXPECT_NEAR(*res.greeks.vega, *ref.greeks.vega, 2e-2);
+            EXPECT_NEAR(*res.greeks.rho, *ref.greeks.rho, 2e-2);
+            EXPECT_NEAR(*res.greeks.theta, *ref.greeks.theta, 2e-3);
+        }
+    }
+
+    TEST(LocalVolPDE, TimeDependentVolMatchesIntegratedVariance)
+    {
+        // σ(t) = 0.15 + 0.1 t is linear in t, so the bilinear surface is
+        // exact and the price is Black-Scholes with the mean variance.
+        LocalVolInput in = makeFlatLocalVolInput(false);
+        in.strike = 105.0;
+        in.maturity = 1.5;
+        in.T_grid = {0.0, 2.0};
+        in.sigma_loc_flat = {0.15, 0.35, 0.15, 0.35};
+        const auto var = [](Real t)
+        { return std::pow(0.15 + 0.1 * t, 3) / 0.3; };
+        const Real sigma_bar = std::sqrt((var(in.maturity) - var(0.0)) / in.maturity);
+
+        VanillaBSInput bs{S0, in.strike, in.maturity, r, q, sigma_bar, false};
+        const auto ref = default_registry().price(PricingRequest{
+            InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes, EngineKind::Analytic, PricingInput{bs}});
+
+        in.pde_space_steps = 200;
+        in.pde_time_steps = 200;
+        const auto res = priceLocalVolPDE(in);
+        EXPECT_NEAR(res.npv, ref.npv, 1e-3);
+        EXPECT_NEAR(*res.greeks.delta, *ref.greeks.delta, 1e-4);
+        EXPECT_NEAR(*res.greeks.rho, *ref.greeks.rho, 1e-2);
+        EXPECT_NE(res.diagnostics.find("local vol"), std::string::npos);
+    }
+
+    TEST(LocalVolPDE, SkewSurfaceConvergesWithGrid)
+    {
+        LocalVolInput in = makeSkewLocalVolInput(90.0);
+        const Real coarse = priceLocalVolPDE(in).npv;
+        in.pde_space_steps = 800;
+        in.pde_time_steps = 800;
+        const Real fine = priceLocalVolPDE(in).npv;
+        EXPECT_NEAR(coarse, fine, 1e-3);
+
+        // The skew lifts the OTM put above its at-the-money-vol price.
+        in.sigma_loc_flat.assign(in.sigma_loc_flat.size(), 0.20);
+        EXPECT_GT(fine, priceLocalVolPDE(in).npv + 0.5);
+    }
+
+    TEST(LocalVolPDE, VegaIsParallelSurfaceShift)
+    {
+        LocalVolInput in = makeSkewLocalVolInput(100.0);
+        const auto base = priceLocalVolPDE(in);
+        const auto bumped = [&](Real dv)
+        {
+            LocalVolInput b = in;
+            for (Real &v : b.sigma_loc_flat)
+                v += dv;
+            return priceLocalVolPDE(b).npv;
+        };
+        const Real fd = (bumped(1e-3) - bumped(-1e-3)) / 2e-3;
+        ASSERT_TRUE(base.greeks.vega.has_value());
+        EXPECT_NEAR(*base.greeks.vega, fd, 1e-3 * std::abs(fd));
+    }
+
+    TEST(LocalVolPDE, AmericanAboveEuropean)
+    {
+        LocalVolInput in = makeSkewLocalVolInput(110.0);
+        const auto european = priceLocalVolPDE(in);
+        const auto american = priceLocalVolPDE(in, true);
+        EXPECT_GT(american.npv, european.npv);
+        EXPECT_GE(american.npv, in.strike - S0);
+        EXPECT_NE(american.diagnostics.find("American"), std::string::npos);
+    }
+
+
+    // ─────────────────────────────────────────────────────────────────────────
+    //  Forward Dupire PDE: whole call surface in one solve
+    // ─────────────────────────────────────────────────────────────────────────
+
+    namespace
+    {
+        LocalVolCallSurfaceInput makeCallSurfaceInput(const LocalVolInput &lv)
+        {
+            LocalVolCallSurfaceInput in;
+            in.spot = lv.spot;
+            in.rate = lv.rate;
+            in.dividend = lv.dividend;
+            in.surface.K_grid = lv.K_grid;
+            in.surface.T_grid = lv.T_grid;
+            in.surface.sigma_loc_flat = lv.sigma_loc_flat;
+            in.strikes = {70.0, 85.0, 100.0, 115.0, 130.0};
+            in.maturities = {0.1, 0.5, 1.0, 2.0};
+            return in;
+        }
+    } // namespace
+
+    TEST(DupireForwardPDE, FlatSurfaceMatchesBS)
+    {
+        const auto in = makeCallSurfaceInput(makeFlatLocalVolInput(true));
+        const auto surf = price_local_vol_call_surface(in);
+        const std::size_t nT = in.maturities.size();
+        ASSERT_EQ(surf.call_prices.size(), in.strikes.size() * nT);
+        ASSERT_EQ(surf.implied_vols.size(), surf.call_prices.size());
+        for (std::size_t i = 0; i < in.strikes.size(); ++i)
+        {
+            for (std::size_t j = 0; j < nT; ++j)
+            {
+                VanillaBSInput bs{S0, in.strikes[i], in.maturities[j], r, q, sigma, true};
+                const Real ref = default_registry().price(PricingRequest{
+                    InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes, EngineKind::Analytic,
+                    PricingInput{bs}}).npv;
+                EXPECT_NEAR(surf.call_prices[i * nT + j], ref, 5e-4)
+                    << "K=" << in.strikes[i] << " T=" << in.maturities[j];
+                // Implied vol is only well determined where the
+                // out-of-the-money price is not negligible.
+                if (std::abs(in.strikes[i] - S0) <= 15.0)
+                {
+                    EXPECT_NEAR(surf.implied_vols[i * nT + j], sigma, 2e-3);
+                }
+            }
+        }
+    }
+
+    TEST(DupireForwardPDE, MatchesBackwardPDEOnSkew)
+    {
+        LocalVolInput lv = makeSkewLocalVolInput(100.0);
+        lv.is_call = true;
+        const auto in = makeCallSurfaceInput(lv);
+        const auto surf = price_local_vol_call_surface(in);
+        const std::size_t nT = in.maturities.size();
+        for (std::size_t i = 0; i < in.strikes.size(); i += 2)
+        {
+            for (std::size_t j = 1; j < nT; ++j)
+            {
+                lv.strike = in.strikes[i];
+                lv.maturity = in.maturities[j];
+                lv.pde_space_steps = 400;
+                lv.pde_time_steps = 400;
+                EXPECT_NEAR(surf.call_prices[i * nT + j], priceLocalVolPDE(lv).npv, 1e-3)
+                    << "K=" << lv.strike << " T=" << lv.maturity;
+            }
+        }
+        // Skew: implied vol falls with strike.
+        EXPECT_GT(surf.implied_vols[0 * nT + 2], surf.implied_vols[2 * nT + 2]);
+        EXPECT_GT(surf.implied_vols[2 * nT + 2], surf.implied_vols[4 * nT + 2]);
+        EXPECT_NE(surf.diagnostics.find("Forward Dupire"), std::string::npos);
+    }
+
+    TEST(DupireForwardPDE, RejectsMalformedInput)
+    {
+        auto in = makeCallSurfaceInput(makeFlatLocalVolInput(true));
+        auto bad = in;
+        bad.strikes = {100.0, 90.0};
+        EXPECT_THROW(price_local_vol_call_surface(bad), InvalidInput);
+        bad = in;
+        bad.maturities = {};
+        EXPECT_THROW(price_local_vol_call_surface(bad), InvalidInput);
+        bad = in;
+        bad.surface.sigma_loc_flat.pop_back();
+        EXPECT_THROW(price_local_vol_call_surface(bad), InvalidInput);
+    }
 } // namespace quantModeling
@@ -6,6 +6,8 @@
 #include "quantModeling/pricers/pricer.hpp"
 #include "quantModeling/pricers/registry.hpp"
 
+#include <cmath>
+
 namespace quantModeling
 {
 
@@ -60,6 +62,47 @@ namespace quantModeling
             return default_registry().price(request);
         }
 
+        LookbackBSInput lookback_input(bool is_call, LookbackStyle style, LookbackExtremum extremum)
+        {
+            LookbackBSInput in{};
+            in.spot = S0;
+            in.strike = K;
+            in.maturity = T;
+            in.rate = r;
+            in.dividend = q;
+            in.vol = sigma;
+            in.is_call = is_call;
+            in.style = style;
+            in.extremum = extremum;
+            return in;
+        }
+
+        PricingResult price_lookback_analytic(const LookbackBSInput &in)
+        {
+            PricingRequest request{
+                InstrumentKind::EquityLookbackOption,
+                ModelKind::BlackScholes,
+                EngineKind::Analytic,
+                PricingInput{in}};
+            return default_registry().price(request);
+        }
+
+        struct LookbackCase
+        {
+            bool is_call;
+            LookbackStyle style;
+            LookbackExtremum extremum;
+        };
+
+        const LookbackCase kAllLookbacks[] = {
+            {true, LookbackStyle::FloatingStrike, LookbackExtremum::Minimum},
+            {false, LookbackStyle::FloatingStrike, LookbackExtremum::Maximum},
+            {true, LookbackStyle::FixedStrike, LookbackExtremum::Maximum},
+            {false, LookbackStyle::FixedStrike, LookbackExtremum::Maximum},
+            {true, LookbackStyle::FixedStrike, LookbackExtremum::Minimum},
+            {false, LookbackStyle::FixedStrike, LookbackExtremum::Minimum},
+        };
+
     } // namespace
 
     // ---- Fixed-strike sanity bounds ----------------------------------------
@@ -217,4 +260,116 @@ namespace quantModeling
         EXPECT_THROW(opt.accept(engine), UnsupportedInstrument);
     }
 
+    // ---- Analytic engine ---------------------------------------------------
+
+    // Discrete monitoring (BGK-corrected closed form) against the MC engine on
+    // the same monitoring grid, for all six payoff variants.
+    TEST(LookbackAnalytic, DiscreteMatchesMonteCarlo)
+    {
+        for (const auto &c : kAllLookbacks)
+        {
+            LookbackBSInput in = lookback_input(c.is_call, c.style, c.extremum);
+            in.n_steps = 52;
+            in.n_paths = 100000;
+            in.seed = 3;
+            PricingRequest request{InstrumentKind::EquityLookbackOption, ModelKind::BlackScholes,
+                                   EngineKind::MonteCarlo, PricingInput{in}};
+            const PricingResult mc = default_registry().price(request);
+            const PricingResult an = price_lookback_analytic(in);
+
+            EXPECT_NEAR(an.npv, mc.npv, 4.0 * mc.mc_std_error + 0.005 * an.npv + 1e-12) << an.diagnostics;
+        }
+    }
+
+    // Continuous monitoring is the n → ∞ limit of the discrete prices; the
+    // BGK gap shrinks like σ√(T/n).
+    TEST(LookbackAnalytic, DiscreteConvergesToContinuous)
+    {
+        for (const auto &c : kAllLookbacks)
+        {
+            LookbackBSInput in = lookback_input(c.is_call, c.style, c.extremum);
+            in.strike = c.is_call ? 90.0 : 110.0; // keeps every variant away from a zero price
+            in.continuous_monitoring = true;
+            const Real cont = price_lookback_analytic(in).npv;
+            in.continuous_monitoring = false;
+            Real prev_gap = 1e300;
+            for (int n : {12, 52, 252, 5000, 100000})
+            {
+                in.n_steps = n;
+                const Real gap = std::abs(price_lookback_analytic(in).npv - cont);
+                EXPECT_LT(gap, prev_gap) << "n=" << n;
+                EXPECT_LT(gap, S0 * sigma * std::sqrt(T / n)) << "n=" << n;
+                prev_gap = gap;
+            }
+        }
+    }
+
+    // Conze-Viswanathan fixed-strike call at K = S0 pays M − S0, i.e. the
+    // floating-strike put plus a forward; checks the two formula families
+    // against each other.
+    TEST(LookbackAnalytic, FixedAtSpotMatchesFloatingPlusForward)
+    {
+        LookbackBSInput fixed = lookback_input(true, LookbackStyle::FixedStrike, LookbackExtremum::Maximum);
+        LookbackBSInput floating = lookback_input(false, LookbackStyle::FloatingStrike, LookbackExtremum::Maximum);
+        fixed.strike = S0;
+        fixed.continuous_monitoring = floating.continuous_monitoring = true;
+        const Real fwd = S0 * std::exp(-q * T) - S0 * std::exp(-r * T);
+        EXPECT_NEAR(price_lookback_analytic(fixed).npv, price_lookback_analytic(floating).npv + fwd, 1e-12);
+    }
+
+    TEST(LookbackAnalytic, GreeksMatchFiniteDifferences)
+    {
+        for (bool continuous : {true, false})
+            for (const auto &c : kAllLookbacks)
+            {
+                LookbackBSInput in = lookback_input(c.is_call, c.style, c.extremum);
+                in.strike = 95.0;
+                in.continuous_monitoring = continuous;
+                in.n_steps = 50;
+                const PricingResult res = price_lookback_analytic(in);
+
+                const auto bumped = [&](Real dS, Real dv, Real dr, Real dT)
+                {
+                    LookbackBSInput b = in;
+                    b.spot += dS;
+                    b.vol += dv;
+                    b.rate += dr;
+                    b.maturity += dT;
+                    return price_lookback_analytic(b).npv;
+                };
+                const Real h = 1e-3;
+                const Real fd_delta = (bumped(h, 0, 0, 0) - bumped(-h, 0, 0, 0)) / (2 * h);
+                const Real fd_gamma = (bumped(h, 0, 0, 0) - 2 * res.npv + bumped(-h, 0, 0, 0)) / (h * h);
+                const Real fd_vega = (bumped(0, 1e-5, 0, 0) - bumped(0, -1e-5, 0, 0)) / 2e-5;
+                const Real fd_rho = (bumped(0, 0, 1e-5, 0) - bumped(0, 0, -1e-5, 0)) / 2e-5;
+                const Real fd_theta = -(bumped(0, 0, 0, 1e-5) - bumped(0, 0, 0, -1e-5)) / 2e-5;
+
+                EXPECT_NEAR(*res.greeks.delta, fd_delta, 1e-6) << res.diagnostics;
+                EXPECT_NEAR(*res.greeks.gamma, fd_gamma, 1e-4) << res.diagnostics;
+                EXPECT_NEAR(*res.greeks.vega, fd_vega, 1e-5) << res.diagnostics;
+                EXPECT_NEAR(*res.greeks.rho, fd_rho, 1e-5) << res.diagnostics;
+                EXPECT_NEAR(*res.greeks.theta, fd_theta, 1e-5) << res.diagnostics;
+            }
+    }
+
+    // The σ²/2b terms are singular at r = q; prices must stay continuous.
+    TEST(LookbackAnalytic, ZeroCarryIsContinuous)
+    {
+        for (const auto &c : kAllLookbacks)
+        {
+            LookbackBSInput in = lookback_input(c.is_call, c.style, c.extremum);
+            in.continuous_monitoring = true;
+            in.rate = in.dividend = 0.03;
+            const PricingResult at = price_lookback_analytic(in);
+            in.dividend = 0.03 - 2e-6;
+            const Real above = price_lookback_analytic(in).npv;
+            in.dividend = 0.03 + 2e-6;
+            const Real below = price_lookback_analytic(in).npv;
+
+            EXPECT_TRUE(std::isfinite(at.npv));
+            EXPECT_NEAR(at.npv, 0.5 * (above + below), 1e-8) << at.diagnostics;
+            EXPECT_TRUE(std::isfinite(*at.greeks.rho));
+        }
+    }
+
 } // namespace quantModeling
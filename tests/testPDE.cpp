@@ -1,9 +1,11 @@
 #include <gtest/gtest.h>
 
+#include "quantModeling/engines/pde/tridiagonal.hpp"
 #include "quantModeling/instruments/base.hpp"
 #include "quantModeling/pricers/registry.hpp"
 
 #include <cmath>
+#include <vector>
 
 namespace quantModeling
 {
@@ -44,6 +46,20 @@ namespace quantModeling
             return default_registry().price(request);
         }
 
+        PricingResult priceAmerican(bool is_call, EngineKind engine, int M = 200, Real dividend = q)
+        {
+            AmericanVanillaBSInput in{S0, K, T, r, dividend, sigma, is_call};
+            in.pde_space_steps = M;
+            in.pde_time_steps = M;
+
+            PricingRequest request{
+                InstrumentKind::EquityAmericanVanillaOption,
+                ModelKind::BlackScholes,
+                engine,
+                PricingInput{in}};
+            return default_registry().price(request);
+        }
+
     } // namespace
 
     // ─────────────────────────────────────────────────────────────────────────
@@ -123,6 +139,20 @@ namespace quantModeling
         EXPECT_TRUE(std::isfinite(*res.greeks.delta));
     }
 
+    TEST(PDEVanilla, GridGreeksMatchAnalytic)
+    {
+        for (bool is_call : {true, false})
+        {
+            const auto ana = priceAnalytic(is_call);
+            const auto pde = pricePDE(is_call, 200, 200);
+            EXPECT_NEAR(*pde.greeks.delta, *ana.greeks.delta, 1e-4);
+            EXPECT_NEAR(*pde.greeks.gamma, *ana.greeks.gamma, 1e-5);
+            EXPECT_NEAR(*pde.greeks.theta, *ana.greeks.theta, 2e-2);
+            EXPECT_NEAR(*pde.greeks.vega, *ana.greeks.vega, 2e-2);
+            EXPECT_NEAR(*pde.greeks.rho, *ana.greeks.rho, 2e-2);
+        }
+    }
+
     // ─────────────────────────────────────────────────────────────────────────
     //  Basic properties
     // ─────────────────────────────────────────────────────────────────────────
@@ -159,6 +189,142 @@ namespace quantModeling
         EXPECT_LT(npv, 5.0);
     }
 
+    // ─────────────────────────────────────────────────────────────────────────
+    //  Grid: domain, stretching and Rannacher start-up
+    // ─────────────────────────────────────────────────────────────────────────
+
+    TEST(PDEVanilla, CoarseGridIsAccurate)
+    {
+        for (bool is_call : {true, false})
+        {
+            const Real ana = priceAnalytic(is_call).npv;
+            EXPECT_NEAR(pricePDE(is_call, 50, 50).npv, ana, 5e-3);
+            EXPECT_NEAR(pricePDE(is_call, 100, 100).npv, ana, 1.5e-3);
+        }
+    }
+
+    TEST(PDEVanilla, LongDatedHighVolDomainCoversDensity)
+    {
+        VanillaBSInput in{S0, K, 5.0, 0.03, 0.01, 0.5, true};
+        PricingRequest request{InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                               EngineKind::Analytic, PricingInput{in}};
+        const auto ana = default_registry().price(request);
+        in.pde_space_steps = 100;
+        in.pde_time_steps = 100;
+        request.input = PricingInput{in};
+        request.engine = EngineKind::PDEFiniteDifference;
+        const auto pde = default_registry().price(request);
+        EXPECT_NEAR(pde.npv, ana.npv, 5e-3);
+        EXPECT_NEAR(*pde.greeks.delta, *ana.greeks.delta, 2e-3);
+    }
+
+    TEST(PDEVanilla, RannacherKeepsShortDatedGammaSmooth)
+    {
+        // A few Crank-Nicolson steps on a fine grid make the payoff kink
+        // oscillate; the implicit start-up damps it.
+        VanillaBSInput in{S0, K, 0.02, r, q, sigma, true};
+        PricingRequest request{InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                               EngineKind::Analytic, PricingInput{in}};
+        const auto ana = default_registry().price(request);
+        in.pde_space_steps = 1000;
+        in.pde_time_steps = 10;
+        request.input = PricingInput{in};
+        request.engine = EngineKind::PDEFiniteDifference;
+        const auto pde = default_registry().price(request);
+        EXPECT_NEAR(pde.npv, ana.npv, 2e-3);
+        EXPECT_NEAR(*pde.greeks.gamma, *ana.greeks.gamma, 0.01 * *ana.greeks.gamma);
+    }
+
+    // ─────────────────────────────────────────────────────────────────────────
+    //  American exercise (Brennan-Schwartz)
+    // ─────────────────────────────────────────────────────────────────────────
+
+    TEST(PDEVanilla, AmericanPutMatchesAnalytic)
+    {
+        const auto ref = priceAmerican(false, EngineKind::Analytic);
+        const auto pde = priceAmerican(false, EngineKind::PDEFiniteDifference, 400);
+        EXPECT_NEAR(pde.npv, ref.npv, 2e-3);
+        EXPECT_NEAR(*pde.greeks.delta, *ref.greeks.delta, 1e-3);
+        EXPECT_NEAR(*pde.greeks.gamma, *ref.greeks.gamma, 1e-4);
+        EXPECT_NEAR(*pde.greeks.theta, *ref.greeks.theta, 1e-2);
+        EXPECT_NEAR(*pde.greeks.vega, *ref.greeks.vega, 0.5);
+        EXPECT_NEAR(*pde.greeks.rho, *ref.greeks.rho, 0.5);
+        EXPECT_NE(pde.diagnostics.find("American"), std::string::npos);
+    }
+
+    TEST(PDEVanilla, AmericanPutAboveEuropean)
+    {
+        const Real american = priceAmerican(false, EngineKind::PDEFiniteDifference).npv;
+        const Real european = pricePDE(false).npv;
+        EXPECT_GT(american, european);
+    }
+
+    TEST(PDEVanilla, AmericanCallWithoutDividendIsEuropean)
+    {
+        const Real american = priceAmerican(true, EngineKind::PDEFiniteDifference, 200, 0.0).npv;
+        VanillaBSInput in{S0, K, T, r, 0.0, sigma, true};
+        in.pde_space_steps = 200;
+        in.pde_time_steps = 200;
+        PricingRequest request{InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                               EngineKind::PDEFiniteDifference, PricingInput{in}};
+        EXPECT_NEAR(american, default_registry().price(request).npv, 1e-6);
+    }
+
+    TEST(PDEVanilla, AmericanConvergesWithGrid)
+    {
+        const Real ref = priceAmerican(false, EngineKind::Analytic).npv;
+        const Real e100 = std::abs(priceAmerican(false, EngineKind::PDEFiniteDifference, 100).npv - ref);
+        const Real e400 = std::abs(priceAmerican(false, EngineKind::PDEFiniteDifference, 400).npv - ref);
+        EXPECT_LT(e400, 0.25 * e100);
+    }
+
+    // ─────────────────────────────────────────────────────────────────────────
+    //  Pre-factored tridiagonal solver
+    // ─────────────────────────────────────────────────────────────────────────
+
+    TEST(PDETridiagonal, BothEliminationOrdersSolveTheSystem)
+    {
+        const int n = 7;
+        std::vector<Real> a(n), b(n), c(n), d(n);
+        for (int i = 0; i < n; ++i)
+        {
+            a[i] = -0.3 - 0.01 * i;
+            b[i] = 2.0 + 0.1 * i;
+            c[i] = -0.5 + 0.02 * i;
+            d[i] = std::sin(1.0 + i);
+        }
+        for (bool top_down : {false, true})
+        {
+            const TridiagonalFactor f(a, b, c, top_down);
+            std::vector<Real> x;
+            f.solve(d, x);
+            for (int i = 0; i < n; ++i)
+            {
+                const Real lhs = (i > 0 ? a[i] * x[i - 1] : 0.0) + b[i] * x[i] +
+                                 (i < n - 1 ? c[i] * x[i + 1] : 0.0);
+                EXPECT_NEAR(lhs, d[i], 1e-14) << "top_down=" << top_down << " row " << i;
+            }
+            // Reuse of the factorisation, solving in place.
+            std::vector<Real> y = d;
+            f.solve(y, y);
+            for (int i = 0; i < n; ++i)
+                EXPECT_DOUBLE_EQ(y[i], x[i]);
+        }
+    }
+
+    TEST(PDETridiagonal, ProjectedSolveRespectsObstacle)
+    {
+        const int n = 5;
+        std::vector<Real> a(n, -1.0), b(n, 3.0), c(n, -1.0), d(n, 0.0);
+        std::vector<Real> obstacle{1.0, 0.5, 0.0, -1.0, -1.0};
+        const TridiagonalFactor f(a, b, c, true);
+        std::vector<Real> x;
+        f.solve_projected(d, obstacle, x);
+        for (int i = 0; i < n; ++i)
+            EXPECT_GE(x[i], obstacle[i]);
+        EXPECT_DOUBLE_EQ(x[0], 1.0);
+    }
+
     // ─────────────────────────────────────────────────────────────────────────
     //  Diagnostics
     // ─────────────────────────────────────────────────────────────────────────
@@ -508,3 +508,198 @@ TEST(RainbowMC, NotionalScaling)
 
     EXPECT_NEAR(r2.npv, r1.npv * 1000.0, 1e-6);
 }
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  12. Closed form (Stulz / Johnson)
+// ═════════════════════════════════════════════════════════════════════════════
+
+namespace
+{
+    RainbowBSInput rainbow_input(int n_assets, Real strike, bool is_call)
+    {
+        RainbowBSInput in;
+        if (n_assets == 2)
+        {
+            in.vols = {0.20, 0.30};
+            in.dividends = {0.01, 0.03};
+            in.correlations = {{1.0, 0.4}, {0.4, 1.0}};
+        }
+        else
+        {
+            in.vols = {0.20, 0.25, 0.30};
+            in.dividends = {0.01, 0.02, 0.0};
+            in.correlations = {
+                {1.0, 0.5, 0.3},
+                {0.5, 1.0, 0.4},
+                {0.3, 0.4, 1.0}};
+        }
+        in.spots.assign(in.vols.size(), 100.0);
+        in.maturity = 1.0;
+        in.strike = strike;
+        in.is_call = is_call;
+        in.rate = 0.05;
+        in.notional = 100.0;
+        in.n_paths = 400000;
+        in.seed = 11;
+        return in;
+    }
+
+    Real vanilla_on_performance(Real vol, Real q, const RainbowBSInput &in)
+    {
+        VanillaBSInput v{1.0, in.strike, in.maturity, in.rate, q, vol, in.is_call};
+        PricingRequest req{
+            InstrumentKind::EquityVanillaOption,
+            ModelKind::BlackScholes,
+            EngineKind::Analytic,
+            PricingInput{v}};
+        return in.notional * default_registry().price(req).npv;
+    }
+} // anonymous namespace
+
+TEST(RainbowAnalytic, MatchesMonteCarlo)
+{
+    for (int n : {2, 3})
+        for (bool is_call : {true, false})
+            for (Real K : {0.9, 1.0, 1.1})
+            {
+                const auto in = rainbow_input(n, K, is_call);
+                const auto wo_mc = price_worst_of_bs_mc(in);
+                const auto bo_mc = price_best_of_bs_mc(in);
+                const auto wo = price_worst_of_bs_analytic(in);
+                const auto bo = price_best_of_bs_analytic(in);
+                EXPECT_NEAR(wo.npv, wo_mc.npv, 4.0 * wo_mc.mc_std_error)
+                    << "worst-of n=" << n << " K=" << K << (is_call ? " call" : " put");
+                EXPECT_NEAR(bo.npv, bo_mc.npv, 4.0 * bo_mc.mc_std_error)
+                    << "best-of n=" << n << " K=" << K << (is_call ? " call" : " put");
+            }
+}
+
+TEST(RainbowAnalytic, TwoAssetMinPlusMaxIsSumOfVanillas)
+{
+    // max(X1, X2) + min(X1, X2) = X1 + X2, so the option values add up to
+    // the two single-asset options on performance — exactly.
+    for (bool is_call : {true, false})
+        for (Real K : {0.8, 1.0, 1.25})
+        {
+            const auto in = rainbow_input(2, K, is_call);
+            const Real sum = price_worst_of_bs_analytic(in).npv + price_best_of_bs_analytic(in).npv;
+            const Real vanillas = vanilla_on_performance(in.vols[0], in.dividends[0], in) +
+                                  vanilla_on_performance(in.vols[1], in.dividends[1], in);
+            EXPECT_NEAR(sum, vanillas, 1e-10) << "K=" << K << (is_call ? " call" : " put");
+        }
+}
+
+TEST(RainbowAnalytic, RegistryAndCorrelationOrdering)
+{
+    auto in = rainbow_input(3, 1.0, true);
+    PricingRequest req{
+        InstrumentKind::WorstOfOption,
+        ModelKind::BlackScholes,
+        EngineKind::Analytic,
+        PricingInput{in}};
+    const Real wo_mid = default_registry().price(req).npv;
+
+    in.correlations = {{1.0, 0.8, 0.7}, {0.8, 1.0, 0.75}, {0.7, 0.75, 1.0}};
+    req.input = PricingInput{in};
+    const Real wo_high = default_registry().price(req).npv;
+    EXPECT_GT(wo_high, wo_mid);
+
+    req.instrument = InstrumentKind::BestOfOption;
+    const Real bo_high = default_registry().price(req).npv;
+    EXPECT_GT(bo_high, wo_high);
+}
+
+TEST(RainbowAnalytic, GreeksMatchFiniteDifferences)
+{
+    for (int n : {2, 3})
+        for (bool best : {false, true})
+        {
+            const auto base = rainbow_input(n, 1.05, !best);
+            const auto pv = [&](const RainbowBSInput &in)
+            { return best ? price_best_of_bs_analytic(in).npv : price_worst_of_bs_analytic(in).npv; };
+            const auto res = best ? price_best_of_bs_analytic(base) : price_worst_of_bs_analytic(base);
+
+            EXPECT_EQ(*res.greeks.delta, 0.0);
+            ASSERT_EQ(res.greeks.vega_per_asset.size(), static_cast<std::size_t>(n));
+
+            const Real h = 1e-5;
+            Real vega_sum = 0.0;
+            auto all_up = base, all_dn = base;
+            for (int a = 0; a < n; ++a)
+            {
+                auto up = base, dn = base;
+                up.vols[a] += h;
+                dn.vols[a] -= h;
+                EXPECT_NEAR(res.greeks.vega_per_asset[a], (pv(up) - pv(dn)) / (2.0 * h), 1e-5)
+                    << "n=" << n << " asset " << a;
+                vega_sum += res.greeks.vega_per_asset[a];
+                all_up.vols[a] += h;
+                all_dn.vols[a] -= h;
+            }
+            EXPECT_NEAR(*res.greeks.vega, (pv(all_up) - pv(all_dn)) / (2.0 * h), 1e-5);
+            EXPECT_NEAR(*res.greeks.vega, vega_sum, 1e-9);
+
+            auto rup = base, rdn = base;
+            rup.rate += h;
+            rdn.rate -= h;
+            EXPECT_NEAR(*res.greeks.rho, (pv(rup) - pv(rdn)) / (2.0 * h), 1e-5);
+
+            auto tup = base, tdn = base;
+            tup.maturity += h;
+            tdn.maturity -= h;
+            EXPECT_NEAR(*res.greeks.theta, -(pv(tup) - pv(tdn)) / (2.0 * h), 1e-5);
+        }
+}
+
+TEST(RainbowAnalytic, FourAssetsUnsupported)
+{
+    auto in = rainbow_input(3, 1.0, true);
+    in.spots.push_back(100.0);
+    in.vols.push_back(0.2);
+    in.dividends.push_back(0.0);
+    in.correlations.clear();
+    EXPECT_THROW(price_worst_of_bs_analytic(in), UnsupportedInstrument);
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  13. Two-asset ADI PDE
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(RainbowPDE, MatchesClosedForm)
+{
+    for (bool best : {false, true})
+        for (bool is_call : {true, false})
+            for (Real K : {0.9, 1.0, 1.1})
+            {
+                const auto in = rainbow_input(2, K, is_call);
+                const auto pde = best ? price_best_of_bs_pde(in) : price_worst_of_bs_pde(in);
+                const auto an = best ? price_best_of_bs_analytic(in) : price_worst_of_bs_analytic(in);
+                EXPECT_NEAR(pde.npv, an.npv, 5e-3)
+                    << (best ? "best-of" : "worst-of") << " K=" << K << (is_call ? " call" : " put");
+                EXPECT_EQ(*pde.greeks.delta, 0.0);
+                EXPECT_NEAR(*pde.greeks.vega, *an.greeks.vega, 2e-2);
+                EXPECT_NEAR(*pde.greeks.rho, *an.greeks.rho, 6e-2);
+                EXPECT_NEAR(*pde.greeks.theta, *an.greeks.theta, 5e-3);
+            }
+}
+
+TEST(RainbowPDE, RegisteredAndMinPlusMaxIsSumOfVanillas)
+{
+    auto in = rainbow_input(2, 1.0, true);
+    PricingRequest req{
+        InstrumentKind::WorstOfOption,
+        ModelKind::BlackScholes,
+        EngineKind::PDEFiniteDifference,
+        PricingInput{in}};
+    const Real wo = default_registry().price(req).npv;
+    req.instrument = InstrumentKind::BestOfOption;
+    const Real bo = default_registry().price(req).npv;
+    const Real vanillas = vanilla_on_performance(in.vols[0], in.dividends[0], in) +
+                          vanilla_on_performance(in.vols[1], in.dividends[1], in);
+    EXPECT_NEAR(wo + bo, vanillas, 5e-3);
+}
+
+TEST(RainbowPDE, ThreeAssetsUnsupported)
+{
+    EXPECT_THROW(price_worst_of_bs_pde(rainbow_input(3, 1.0, true)), UnsupportedInstrument);
+}
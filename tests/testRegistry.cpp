@@ -1,9 +1,14 @@
 #include <gtest/gtest.h>
 
 #include "quantModeling/pricers/registry.hpp"
+#include "quantModeling/pricers/cache.hpp"
 #include "quantModeling/core/types.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <string>
+#include <vector>
 
 namespace quantModeling
 {
@@ -17,6 +22,30 @@ namespace quantModeling
         constexpr Real q = 0.02;
         constexpr Real sigma = 0.20;
 
+        // A prepared reprice against price() of the request with the move
+        // applied by hand.
+        void expect_reprice_matches(const PricingRequest &request, const MarketDelta &delta,
+                                    const PricingInput &shifted)
+        {
+            const auto prepared = default_registry().prepare(request);
+            const auto base = default_registry().price(request);
+            const auto moved = default_registry().price(
+                {request.instrument, request.model, request.engine, shifted});
+
+            const auto at_base = prepared.reprice();
+            EXPECT_NEAR(at_base.npv, base.npv, 1e-12);
+            EXPECT_EQ(at_base.diagnostics, base.diagnostics);
+
+            const auto repriced = prepared.reprice(delta);
+            EXPECT_NEAR(repriced.npv, moved.npv, 1e-12);
+            EXPECT_EQ(repriced.greeks.delta.has_value(), moved.greeks.delta.has_value());
+            if (moved.greeks.vega)
+            {
+                EXPECT_NEAR(repriced.greeks.vega.value(), moved.greeks.vega.value(), 1e-10);
+            }
+            EXPECT_EQ(repriced.diagnostics, moved.diagnostics);
+        }
+
     } // namespace
 
     // ─────────────────────────────────────────────────────────────────────────
@@ -150,13 +179,69 @@ namespace quantModeling
     TEST(Registry, UnregisteredComboThrows)
     {
         VanillaBSInput in{S0, K, T, r, q, sigma, true};
-        // No BS+Analytic for Asian is registered (Asian analytic uses different path)
-        PricingRequest req{InstrumentKind::EquityBarrierOption,
-                           ModelKind::BlackScholes, EngineKind::Analytic,
+        // No Monte Carlo engine is registered for equity futures
+        PricingRequest req{InstrumentKind::EquityFuture,
+                           ModelKind::BlackScholes, EngineKind::MonteCarlo,
                            PricingInput{in}};
         EXPECT_THROW(default_registry().price(req), UnsupportedInstrument);
     }
 
+    TEST(Registry, MismatchedInputThrowsInvalidInput)
+    {
+        DigitalBSInput in{S0, K, T, r, q, sigma, true};
+        PricingRequest req{InstrumentKind::EquityVanillaOption,
+                           ModelKind::BlackScholes, EngineKind::Analytic,
+                           PricingInput{in}};
+        EXPECT_THROW(default_registry().price(req), InvalidInput);
+    }
+
+    TEST(Registry, OutOfRangeKeyIsUnsupported)
+    {
+        const RegistryKey key{static_cast<InstrumentKind>(kInstrumentKindCount + 3),
+                              ModelKind::BlackScholes, EngineKind::Analytic};
+        EXPECT_FALSE(default_registry().supports(key));
+        VanillaBSInput in{S0, K, T, r, q, sigma, true};
+        EXPECT_THROW(default_registry().price({key.instrument, key.model, key.engine, PricingInput{in}}),
+                     UnsupportedInstrument);
+    }
+
+    // ─────────────────────────────────────────────────────────────────────────
+    //  Capability matrix
+    // ─────────────────────────────────────────────────────────────────────────
+
+    TEST(Registry, CapabilitiesAreOrderedAndSupported)
+    {
+        const auto caps = default_registry().capabilities();
+        ASSERT_FALSE(caps.empty());
+        for (std::size_t i = 0; i < caps.size(); ++i)
+        {
+            EXPECT_TRUE(default_registry().supports(caps[i]));
+            if (i > 0)
+            {
+                EXPECT_LT(caps[i - 1].index(), caps[i].index());
+            }
+        }
+
+        const auto has = [&](RegistryKey key)
+        {
+            return std::find(caps.begin(), caps.end(), key) != caps.end();
+        };
+        EXPECT_TRUE(has({InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes, EngineKind::Analytic}));
+        EXPECT_TRUE(has({InstrumentKind::Caplet, ModelKind::HullWhite, EngineKind::MonteCarlo}));
+        EXPECT_TRUE(has({InstrumentKind::EquityDoubleBarrierOption, ModelKind::DupireLocalVol,
+                         EngineKind::PDEFiniteDifference}));
+        EXPECT_FALSE(has({InstrumentKind::EquityFuture, ModelKind::BlackScholes, EngineKind::MonteCarlo}));
+
+        // Every key not listed is rejected.
+        std::size_t supported = 0;
+        for (std::size_t i = 0; i < kInstrumentKindCount; ++i)
+            for (std::size_t j = 0; j < kModelKindCount; ++j)
+                for (std::size_t k = 0; k < kEngineKindCount; ++k)
+                    supported += default_registry().supports(
+                        {static_cast<InstrumentKind>(i), static_cast<ModelKind>(j), static_cast<EngineKind>(k)});
+        EXPECT_EQ(supported, caps.size());
+    }
+
     // ─────────────────────────────────────────────────────────────────────────
     //  All 5 engines agree on European vanilla call (cross-engine consistency)
     // ─────────────────────────────────────────────────────────────────────────
@@ -258,4 +343,474 @@ namespace quantModeling
         EXPECT_GT(res.npv, 0.0);
     }
 
+    // ─────────────────────────────────────────────────────────────────────────
+    //  Batch pricing
+    // ─────────────────────────────────────────────────────────────────────────
+
+    TEST(Registry, PriceBatchMatchesSingleRequestsInOrder)
+    {
+        VanillaBSInput vanilla{S0, K, T, r, q, sigma, true};
+        vanilla.n_paths = 20000;
+        AsianBSInput asian{S0, K, T, r, q, sigma, false};
+        asian.n_paths = 5000;
+
+        std::vector<PricingRequest> requests;
+        for (int i = 0; i < 6; ++i)
+        {
+            vanilla.strike = 80.0 + 10.0 * i;
+            asian.strike = vanilla.strike;
+            requests.push_back({InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                                EngineKind::Analytic, PricingInput{vanilla}});
+            requests.push_back({InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                                EngineKind::MonteCarlo, PricingInput{vanilla}});
+            requests.push_back({InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                                EngineKind::PDEFiniteDifference, PricingInput{vanilla}});
+            requests.push_back({InstrumentKind::EquityAsianOption, ModelKind::BlackScholes,
+                                EngineKind::MonteCarlo, PricingInput{asian}});
+        }
+
+        const auto batch = default_registry().price_batch(requests);
+        ASSERT_EQ(batch.size(), requests.size());
+        for (std::size_t i = 0; i < requests.size(); ++i)
+        {
+            ASSERT_TRUE(batch[i].ok()) << batch[i].error;
+            const auto single = default_registry().price(requests[i]);
+            EXPECT_EQ(batch[i].result->npv, single.npv) << "request " << i;
+            EXPECT_EQ(batch[i].result->diagnostics, single.diagnostics);
+        }
+    }
+
+    TEST(Registry, PriceBatchReportsErrorsPerRequest)
+    {
+        VanillaBSInput good{S0, K, T, r, q, sigma, true};
+        VanillaBSInput bad = good;
+        bad.maturity = -1.0;
+
+        const std::vector<PricingRequest> requests{
+            {InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes, EngineKind::Analytic, PricingInput{good}},
+            {InstrumentKind::ZeroCouponBond, ModelKind::BlackScholes, EngineKind::MonteCarlo, PricingInput{good}},
+            {InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes, EngineKind::Analytic, PricingInput{bad}},
+            {InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes, EngineKind::Analytic, PricingInput{good}},
+        };
+
+        const auto batch = default_registry().price_batch(requests);
+        ASSERT_EQ(batch.size(), 4u);
+        EXPECT_TRUE(batch[0].ok());
+        EXPECT_FALSE(batch[1].ok());
+        EXPECT_NE(batch[1].error.find("No pricer registered"), std::string::npos);
+        EXPECT_FALSE(batch[2].ok());
+        EXPECT_FALSE(batch[2].error.empty());
+        ASSERT_TRUE(batch[3].ok());
+        EXPECT_EQ(batch[3].result->npv, batch[0].result->npv);
+    }
+
+    TEST(Registry, PriceBatchEmpty)
+    {
+        EXPECT_TRUE(default_registry().price_batch({}).empty());
+    }
+
+    // ─────────────────────────────────────────────────────────────────────────
+    //  Prepared pricers
+    // ─────────────────────────────────────────────────────────────────────────
+
+    TEST(Registry, PreparedVanillaMatchesShiftedRequest)
+    {
+        VanillaBSInput in{S0, K, T, r, q, sigma, true};
+        const PricingRequest req{InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                                 EngineKind::Analytic, PricingInput{in}};
+        const auto prepared = default_registry().prepare(req);
+        EXPECT_TRUE(prepared.key() == (RegistryKey{InstrumentKind::EquityVanillaOption,
+                                                   ModelKind::BlackScholes, EngineKind::Analytic}));
+
+        const auto base = prepared.reprice();
+        const auto direct = default_registry().price(req);
+        EXPECT_NEAR(base.npv, direct.npv, 1e-12);
+        EXPECT_NEAR(base.greeks.delta.value(), direct.greeks.delta.value(), 1e-12);
+
+        const MarketDelta delta{0.05, -0.03, 0.01};
+        in.spot *= 1.05;
+        in.vol -= 0.03;
+        in.rate += 0.01;
+        const auto shifted = default_registry().price(
+            {InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes, EngineKind::Analytic, PricingInput{in}});
+        const auto repriced = prepared.reprice(delta);
+        EXPECT_NEAR(repriced.npv, shifted.npv, 1e-12);
+        EXPECT_NEAR(repriced.greeks.vega.value(), shifted.greeks.vega.value(), 1e-10);
+        EXPECT_NEAR(repriced.greeks.rho.value(), shifted.greeks.rho.value(), 1e-10);
+    }
+
+    TEST(Registry, PreparedAnalyticKernelsMatchShiftedRequests)
+    {
+        const MarketDelta delta{0.05, -0.03, 0.01};
+        using IK = InstrumentKind;
+
+        DigitalBSInput dig{S0, K, T, r, q, sigma, false, DigitalPayoffType::CashOrNothing, 1.0};
+        DigitalBSInput dig_moved = dig;
+        dig_moved.spot *= 1.05;
+        dig_moved.vol -= 0.03;
+        dig_moved.rate += 0.01;
+        expect_reprice_matches({IK::EquityDigitalOption, ModelKind::BlackScholes, EngineKind::Analytic,
+                                PricingInput{dig}},
+                               delta, PricingInput{dig_moved});
+
+        BarrierBSInput bar{};
+        bar.spot = S0;
+        bar.strike = K;
+        bar.maturity = T;
+        bar.rate = r;
+        bar.dividend = q;
+        bar.vol = sigma;
+        bar.is_call = true;
+        bar.barrier_type = BarrierType::UpAndOut;
+        bar.barrier_level = 130.0;
+        bar.rebate = 2.0;
+        bar.brownian_bridge = false;
+        BarrierBSInput bar_moved = bar;
+        bar_moved.spot *= 1.05;
+        bar_moved.vol -= 0.03;
+        bar_moved.rate += 0.01;
+        expect_reprice_matches({IK::EquityBarrierOption, ModelKind::BlackScholes, EngineKind::Analytic,
+                                PricingInput{bar}},
+                               delta, PricingInput{bar_moved});
+
+        FXOptionInput fx{1.10, 0.03, 0.01, 0.12, 1.12, 0.5, true, 1e6};
+        FXOptionInput fx_moved = fx;
+        fx_moved.spot *= 1.05;
+        fx_moved.vol -= 0.03;
+        fx_moved.rate_domestic += 0.01;
+        expect_reprice_matches({IK::FXOption, ModelKind::GarmanKohlhagen, EngineKind::Analytic,
+                                PricingInput{fx}},
+                               delta, PricingInput{fx_moved});
+
+        CommodityOptionInput cmd{80.0, 0.04, 0.02, 0.01, 0.30, 85.0, 1.5, false, 1000.0};
+        CommodityOptionInput cmd_moved = cmd;
+        cmd_moved.spot *= 1.05;
+        cmd_moved.vol -= 0.03;
+        cmd_moved.rate += 0.01;
+        expect_reprice_matches({IK::CommodityOption, ModelKind::CommodityBlack, EngineKind::Analytic,
+                                PricingInput{cmd}},
+                               delta, PricingInput{cmd_moved});
+    }
+
+    // Timings are recorded, not asserted: the gap is large but wall-clock
+    // checks are flaky on shared runners.
+    TEST(Registry, PreparedVanillaTimingVsPrice)
+    {
+        constexpr int n = 20000;
+        VanillaBSInput in{S0, K, T, r, q, sigma, true};
+        const PricingRequest req{InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                                 EngineKind::Analytic, PricingInput{in}};
+        const auto prepared = default_registry().prepare(req);
+
+        const auto shift_of = [](int i)
+        { return MarketDelta{0.001 * (i % 41 - 20), 0.0005 * (i % 17 - 8), 0.0}; };
+
+        Real prepared_sum = 0.0;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < n; ++i)
+            prepared_sum += prepared.reprice(shift_of(i)).npv;
+        const auto t1 = std::chrono::steady_clock::now();
+        Real price_sum = 0.0;
+        for (int i = 0; i < n; ++i)
+        {
+            const MarketDelta d = shift_of(i);
+            VanillaBSInput moved = in;
+            moved.spot *= 1.0 + d.spot_shift;
+            moved.vol += d.vol_shift;
+            price_sum += default_registry().price({req.instrument, req.model, req.engine, PricingInput{moved}}).npv;
+        }
+        const auto t2 = std::chrono::steady_clock::now();
+
+        const double prepared_ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        const double price_ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+        RecordProperty("prepared_ms", std::to_string(prepared_ms));
+        RecordProperty("price_ms", std::to_string(price_ms));
+        EXPECT_NEAR(prepared_sum, price_sum, 1e-9 * n);
+    }
+
+    TEST(Registry, PreparedMultiAssetMCKernelsMatchShiftedRequests)
+    {
+        using IK = InstrumentKind;
+        const MarketDelta delta{-0.10, 0.02, -0.005};
+
+        BasketBSInput basket;
+        basket.spots = {100.0, 90.0};
+        basket.vols = {0.2, 0.3};
+        basket.dividends = {0.0, 0.01};
+        basket.weights = {0.5, 0.5};
+        basket.correlations = {{1.0, 0.4}, {0.4, 1.0}};
+        basket.n_paths = 4000;
+        BasketBSInput basket_moved = basket;
+        basket_moved.spots = {100.0 * 0.9, 90.0 * 0.9};
+        basket_moved.vols = {0.2 + 0.02, 0.3 + 0.02};
+        basket_moved.rate += -0.005;
+        expect_reprice_matches({IK::EquityBasketOption, ModelKind::BlackScholes, EngineKind::MonteCarlo,
+                                PricingInput{basket}},
+                               delta, PricingInput{basket_moved});
+
+        RainbowBSInput rainbow;
+        rainbow.spots = {100.0, 90.0, 110.0};
+        rainbow.vols = {0.2, 0.3, 0.25};
+        rainbow.dividends = {0.0, 0.01, 0.02};
+        rainbow.correlations = {{1.0, 0.4, 0.3}, {0.4, 1.0, 0.5}, {0.3, 0.5, 1.0}};
+        rainbow.maturity = 1.0;
+        rainbow.is_call = false;
+        rainbow.n_paths = 4000;
+        RainbowBSInput rainbow_moved = rainbow;
+        rainbow_moved.spots = {100.0 * 0.9, 90.0 * 0.9, 110.0 * 0.9};
+        rainbow_moved.vols = {0.2 + 0.02, 0.3 + 0.02, 0.25 + 0.02};
+        rainbow_moved.rate += -0.005;
+        expect_reprice_matches({IK::WorstOfOption, ModelKind::BlackScholes, EngineKind::MonteCarlo,
+                                PricingInput{rainbow}},
+                               delta, PricingInput{rainbow_moved});
+        expect_reprice_matches({IK::BestOfOption, ModelKind::BlackScholes, EngineKind::MonteCarlo,
+                                PricingInput{rainbow}},
+                               delta, PricingInput{rainbow_moved});
+    }
+
+    // Recorded, not asserted, as PreparedVanillaTimingVsPrice.
+    TEST(Registry, PreparedBasketMCTimingVsPrice)
+    {
+        constexpr int n = 20;
+        BasketBSInput in;
+        in.spots = {100.0, 90.0, 110.0};
+        in.vols = {0.2, 0.3, 0.25};
+        in.dividends = {0.0, 0.01, 0.02};
+        in.weights = {0.4, 0.3, 0.3};
+        in.correlations = {{1.0, 0.4, 0.3}, {0.4, 1.0, 0.5}, {0.3, 0.5, 1.0}};
+        in.n_paths = 20000;
+        const PricingRequest req{InstrumentKind::EquityBasketOption, ModelKind::BlackScholes,
+                                 EngineKind::MonteCarlo, PricingInput{in}};
+        const auto prepared = default_registry().prepare(req);
+
+        Real prepared_sum = 0.0;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < n; ++i)
+            prepared_sum += prepared.reprice({0.01 * (i - 10), 0.0, 0.0}).npv;
+        const auto t1 = std::chrono::steady_clock::now();
+        Real price_sum = 0.0;
+        for (int i = 0; i < n; ++i)
+        {
+            BasketBSInput moved = in;
+            for (Real &s : moved.spots)
+                s *= 1.0 + 0.01 * (i - 10);
+            price_sum += default_registry().price({req.instrument, req.model, req.engine, PricingInput{moved}}).npv;
+        }
+        const auto t2 = std::chrono::steady_clock::now();
+
+        RecordProperty("prepared_ms", std::to_string(std::chrono::duration<double, std::milli>(t1 - t0).count()));
+        RecordProperty("price_ms", std::to_string(std::chrono::duration<double, std::milli>(t2 - t1).count()));
+        EXPECT_NEAR(prepared_sum, price_sum, 1e-9 * n);
+    }
+
+    TEST(Registry, PreparedGenericPathShiftsEveryAsset)
+    {
+        BasketBSInput in;
+        in.spots = {100.0, 90.0};
+        in.vols = {0.2, 0.3};
+        in.dividends = {0.0, 0.01};
+        in.weights = {0.5, 0.5};
+        in.correlations = {{1.0, 0.4}, {0.4, 1.0}};
+        const PricingRequest req{InstrumentKind::EquityBasketOption, ModelKind::BlackScholes,
+                                 EngineKind::Analytic, PricingInput{in}};
+        const auto prepared = default_registry().prepare(req);
+
+        EXPECT_EQ(prepared.reprice().npv, default_registry().price(req).npv);
+
+        in.spots = {90.0, 81.0};
+        in.vols = {0.22, 0.32};
+        in.rate += -0.005;
+        const auto shifted = default_registry().price(
+            {InstrumentKind::EquityBasketOption, ModelKind::BlackScholes, EngineKind::Analytic, PricingInput{in}});
+        EXPECT_NEAR(prepared.reprice({-0.10, 0.02, -0.005}).npv, shifted.npv, 1e-9);
+    }
+
+    TEST(Registry, PrepareRejectsUnknownKeyAndBadInput)
+    {
+        VanillaBSInput in{S0, K, T, r, q, sigma, true};
+        EXPECT_THROW(default_registry().prepare({InstrumentKind::ZeroCouponBond, ModelKind::BlackScholes,
+                                                 EngineKind::MonteCarlo, PricingInput{in}}),
+                     UnsupportedInstrument);
+        in.maturity = 0.0;
+        EXPECT_THROW(default_registry().prepare({InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                                                 EngineKind::Analytic, PricingInput{in}}),
+                     InvalidInput);
+
+        // Monte Carlo kernels and the generic path check at prepare time too.
+        BasketBSInput basket;
+        basket.spots = {100.0, 90.0};
+        basket.vols = {0.2, 0.3};
+        basket.dividends = {0.0, 0.01};
+        basket.weights = {0.5, 0.5};
+        basket.n_paths = 0;
+        EXPECT_THROW(default_registry().prepare({InstrumentKind::EquityBasketOption, ModelKind::BlackScholes,
+                                                 EngineKind::MonteCarlo, PricingInput{basket}}),
+                     InvalidInput);
+        basket.n_paths = 1000;
+        basket.weights = {1.0};
+        EXPECT_THROW(default_registry().prepare({InstrumentKind::EquityBasketOption, ModelKind::BlackScholes,
+                                                 EngineKind::Analytic, PricingInput{basket}}),
+                     InvalidInput);
+        EXPECT_THROW(default_registry().prepare({InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                                                 EngineKind::MonteCarlo, PricingInput{basket}}),
+                     InvalidInput);
+    }
+
+    // ─────────────────────────────────────────────────────────────────────────
+    //  Result cache
+    // ─────────────────────────────────────────────────────────────────────────
+
+    TEST(Registry, CanonicalKeyCoversEveryField)
+    {
+        VanillaBSInput in{S0, K, T, r, q, sigma, true};
+        const auto key_of = [](InstrumentKind ik, EngineKind ek, const PricingInput &input)
+        {
+            return canonical_request_key({ik, ModelKind::BlackScholes, ek, input});
+        };
+        const auto base = key_of(InstrumentKind::EquityVanillaOption, EngineKind::MonteCarlo, in);
+        EXPECT_EQ(base, key_of(InstrumentKind::EquityVanillaOption, EngineKind::MonteCarlo, VanillaBSInput(in)));
+        EXPECT_NE(base, key_of(InstrumentKind::EquityVanillaOption, EngineKind::Analytic, in));
+
+        auto seed = in;
+        seed.seed = 2;
+        auto paths = in;
+        paths.n_paths += 1;
+        auto put = in;
+        put.is_call = false;
+        auto richardson = in;
+        richardson.tree_richardson = true;
+        auto strike = in;
+        strike.strike = std::nextafter(K, 200.0);
+        for (const auto &other : {seed, paths, put, richardson, strike})
+            EXPECT_NE(base, key_of(InstrumentKind::EquityVanillaOption, EngineKind::MonteCarlo, other));
+
+        // Vectors inside nested structs, and strings.
+        BarrierLocalVolInput lv{};
+        lv.spot = S0;
+        lv.strike = K;
+        lv.maturity = T;
+        lv.rate = r;
+        lv.dividend = q;
+        lv.is_call = true;
+        lv.surface.K_grid = {50.0, 200.0};
+        lv.surface.T_grid = {0.01, 2.0};
+        lv.surface.sigma_loc_flat = {0.20, 0.20, 0.20, 0.20};
+        auto lv_bumped = lv;
+        lv_bumped.surface.sigma_loc_flat[3] = 0.21;
+        EXPECT_NE(key_of(InstrumentKind::EquityBarrierOption, EngineKind::MonteCarlo, lv),
+                  key_of(InstrumentKind::EquityBarrierOption, EngineKind::MonteCarlo, lv_bumped));
+
+        ShortRateZCBInput zcb{"vasicek", 0.1, 0.05, 0.01, 0.03, 5.0};
+        auto cir = zcb;
+        cir.model_type = "cir";
+        EXPECT_NE(canonical_request_key({InstrumentKind::ZeroCouponBond, ModelKind::Vasicek, EngineKind::Analytic, zcb}),
+                  canonical_request_key({InstrumentKind::ZeroCouponBond, ModelKind::Vasicek, EngineKind::Analytic, cir}));
+    }
+
+    TEST(Registry, CacheServesRepeatsAndCounts)
+    {
+        VanillaBSInput in{S0, K, T, r, q, sigma, true};
+        in.n_paths = 20000;
+        const PricingRequest req{InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                                 EngineKind::MonteCarlo, PricingInput{in}};
+        PricingCache cache;
+        const auto first = cache.price(req);
+        const auto second = cache.price(req);
+        EXPECT_EQ(first.npv, default_registry().price(req).npv);
+        EXPECT_EQ(second.npv, first.npv);
+        EXPECT_EQ(second.diagnostics, first.diagnostics);
+
+        auto stats = cache.stats();
+        EXPECT_EQ(stats.hits, 1u);
+        EXPECT_EQ(stats.misses, 1u);
+        EXPECT_EQ(stats.entries, 1u);
+        EXPECT_GT(stats.bytes, 0u);
+        EXPECT_LE(stats.bytes, stats.capacity_bytes);
+
+        EXPECT_TRUE(cache.invalidate(req));
+        EXPECT_FALSE(cache.invalidate(req));
+        EXPECT_FALSE(cache.find(req).has_value());
+        cache.insert(req, first);
+        cache.clear();
+        stats = cache.stats();
+        EXPECT_EQ(stats.entries, 0u);
+        EXPECT_EQ(stats.bytes, 0u);
+
+        cache.reset_stats();
+        EXPECT_EQ(cache.stats().misses, 0u);
+    }
+
+    TEST(Registry, CacheEvictsLeastRecentlyUsedWithinCapacity)
+    {
+        std::vector<PricingRequest> reqs;
+        for (int i = 0; i < 3; ++i)
+        {
+            VanillaBSInput in{S0, 90.0 + 10.0 * i, T, r, q, sigma, true};
+            reqs.push_back({InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                            EngineKind::Analytic, PricingInput{in}});
+        }
+
+        PricingCache probe;
+        probe.price(reqs[0]);
+        const std::size_t entry_bytes = probe.stats().bytes;
+
+        // Room for two entries.
+        PricingCache cache(2 * entry_bytes + entry_bytes / 2);
+        cache.price(reqs[0]);
+        cache.price(reqs[1]);
+        cache.price(reqs[0]); // reqs[1] is now the least recently used
+        cache.price(reqs[2]);
+        EXPECT_TRUE(cache.find(reqs[0]).has_value());
+        EXPECT_FALSE(cache.find(reqs[1]).has_value());
+        EXPECT_TRUE(cache.find(reqs[2]).has_value());
+        EXPECT_EQ(cache.stats().evictions, 1u);
+        EXPECT_LE(cache.stats().bytes, cache.stats().capacity_bytes);
+
+        cache.set_capacity(entry_bytes);
+        EXPECT_EQ(cache.stats().entries, 1u);
+        cache.set_capacity(0);
+        cache.price(reqs[0]);
+        EXPECT_EQ(cache.stats().entries, 0u);
+    }
+
+    TEST(Registry, CacheDoesNotKeepErrors)
+    {
+        VanillaBSInput in{S0, K, -1.0, r, q, sigma, true};
+        const PricingRequest req{InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                                 EngineKind::Analytic, PricingInput{in}};
+        PricingCache cache;
+        EXPECT_THROW(cache.price(req), InvalidInput);
+        EXPECT_THROW(cache.price(req), InvalidInput);
+        EXPECT_EQ(cache.stats().entries, 0u);
+        EXPECT_EQ(cache.stats().misses, 2u);
+    }
+
+    TEST(Registry, PriceBatchThroughCache)
+    {
+        std::vector<PricingRequest> requests;
+        for (int i = 0; i < 8; ++i)
+        {
+            VanillaBSInput in{S0, 80.0 + 5.0 * (i % 4), T, r, q, sigma, true};
+            in.n_paths = 5000;
+            requests.push_back({InstrumentKind::EquityVanillaOption, ModelKind::BlackScholes,
+                                EngineKind::MonteCarlo, PricingInput{in}});
+        }
+
+        PricingCache cache;
+        const auto first = default_registry().price_batch(requests, &cache);
+        const auto second = default_registry().price_batch(requests, &cache);
+        const auto stats = cache.stats();
+        EXPECT_EQ(stats.hits + stats.misses, 16u);
+        // Every request of the second batch hits; the 4 repeats within the
+        // first may race each other and miss.
+        EXPECT_GE(stats.hits, 8u);
+        EXPECT_EQ(stats.entries, 4u);
+        for (std::size_t i = 0; i < requests.size(); ++i)
+        {
+            ASSERT_TRUE(first[i].ok() && second[i].ok());
+            EXPECT_EQ(second[i].result->npv, first[i].result->npv);
+            EXPECT_EQ(first[i].result->npv, default_registry().price(requests[i]).npv);
+        }
+    }
+
 } // namespace quantModeling
@@ -0,0 +1,296 @@
+#include <gtest/gtest.h>
+
+#include "quantModeling/calibration/short_rate.hpp"
+#include "quantModeling/core/types.hpp"
+#include "quantModeling/pricers/adapters/rates_short_rate.hpp"
+#include "quantModeling/pricers/registry.hpp"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace quantModeling;
+
+namespace
+{
+
+    /// Market-consistent quote set: caplets, a cap, bond options, ZCBs,
+    /// all priced through the analytic short-rate adapters.
+    std::vector<ShortRateQuote> make_gaussian_quotes(const std::string &model_type,
+                                                     Real a, Real b, Real sigma, Real r0)
+    {
+        std::vector<ShortRateQuote> quotes;
+
+        for (Real start : {0.5, 1.0, 2.0, 3.0, 5.0})
+        {
+            for (Real K : {0.03, 0.05})
+            {
+                ShortRateCapletInput in{model_type, a, b, sigma, r0, start, start + 0.5, K, true, 1.0};
+                ShortRateQuote q;
+                q.type = ShortRateQuoteType::Caplet;
+                q.start = start;
+                q.end = start + 0.5;
+                q.strike = K;
+                q.is_call = true;
+                q.market_price = price_caplet_short_rate_analytic(in).npv;
+                q.weight = 1.0 / q.market_price;
+                quotes.push_back(q);
+            }
+        }
+
+        {
+            ShortRateCapFloorInput in{model_type, a, b, sigma, r0, {1.0, 2.0, 3.0, 4.0}, 0.04, false, 1.0};
+            ShortRateQuote q;
+            q.type = ShortRateQuoteType::CapFloor;
+            q.schedule = in.schedule;
+            q.strike = 0.04;
+            q.is_call = false;
+            q.market_price = price_capfloor_short_rate_analytic(in).npv;
+            q.weight = 1.0 / q.market_price;
+            quotes.push_back(q);
+        }
+
+        for (Real T : {1.0, 2.0})
+        {
+            ShortRateBondOptionInput in{model_type, a, b, sigma, r0, T, T + 5.0, 0.8, T > 1.5, 1.0};
+            ShortRateQuote q;
+            q.type = ShortRateQuoteType::BondOption;
+            q.start = T;
+            q.end = T + 5.0;
+            q.strike = 0.8;
+            q.is_call = in.is_call;
+            q.market_price = price_bond_option_short_rate_analytic(in).npv;
+            q.weight = 1.0 / q.market_price;
+            quotes.push_back(q);
+        }
+
+        for (Real T : {1.0, 5.0, 10.0})
+        {
+            ShortRateZCBInput in{model_type, a, b, sigma, r0, T, 1.0};
+            ShortRateQuote q;
+            q.type = ShortRateQuoteType::ZeroCouponBond;
+            q.end = T;
+            q.market_price = price_zcb_short_rate(in).npv;
+            quotes.push_back(q);
+        }
+
+        return quotes;
+    }
+
+} // anonymous namespace
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  Parameter recovery from self-consistent quotes
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(ShortRateCalibration, VasicekRecoversParameters)
+{
+    const Real a = 0.25, b = 0.045, sigma = 0.012, r0 = 0.03;
+
+    ShortRateCalibrationInput in;
+    in.model_type = "vasicek";
+    in.a = 0.1;
+    in.b = 0.03;
+    in.sigma = 0.02;
+    in.r0 = r0;
+    in.quotes = make_gaussian_quotes("vasicek", a, b, sigma, r0);
+
+    const auto res = calibrate_short_rate(in);
+
+    EXPECT_TRUE(res.converged) << res.diagnostics;
+    EXPECT_NEAR(res.a, a, 1e-6);
+    EXPECT_NEAR(res.b, b, 1e-7);
+    EXPECT_NEAR(res.sigma, sigma, 1e-8);
+    EXPECT_LT(res.rmse, 1e-10);
+    EXPECT_LT(res.iterations, 50);
+    ASSERT_EQ(res.residuals.size(), in.quotes.size());
+    ASSERT_EQ(res.history.size(), static_cast<std::size_t>(res.iterations));
+    for (const auto &h : res.history)
+        EXPECT_GE(h.elapsed_ms, 0.0);
+}
+
+TEST(ShortRateCalibration, HullWhiteRecoversParameters)
+{
+    // Hull-White is parameterised as (a, b = θ/a, σ), matching ShortRate*Input.
+    const Real a = 0.08, b = 0.05, sigma = 0.009, r0 = 0.02;
+
+    ShortRateCalibrationInput in;
+    in.model_type = "hull_white";
+    in.a = 0.2;
+    in.b = 0.04;
+    in.sigma = 0.015;
+    in.r0 = r0;
+    in.quotes = make_gaussian_quotes("hull_white", a, b, sigma, r0);
+
+    const auto res = calibrate_short_rate(in);
+
+    EXPECT_TRUE(res.converged) << res.diagnostics;
+    EXPECT_NEAR(res.a, a, 1e-6);
+    EXPECT_NEAR(res.b, b, 1e-6);
+    EXPECT_NEAR(res.sigma, sigma, 1e-8);
+}
+
+TEST(ShortRateCalibration, FixedLongTermLevel)
+{
+    const Real a = 0.3, b = 0.05, sigma = 0.01, r0 = 0.04;
+
+    ShortRateCalibrationInput in;
+    in.model_type = "vasicek";
+    in.a = 0.15;
+    in.b = b; // held fixed
+    in.sigma = 0.02;
+    in.r0 = r0;
+    in.calibrate_long_term = false;
+    in.quotes = make_gaussian_quotes("vasicek", a, b, sigma, r0);
+
+    const auto res = calibrate_short_rate(in);
+
+    EXPECT_DOUBLE_EQ(res.b, b);
+    EXPECT_NEAR(res.a, a, 1e-6);
+    EXPECT_NEAR(res.sigma, sigma, 1e-8);
+}
+
+TEST(ShortRateCalibration, ModelPricesMatchAnalyticEngine)
+{
+    const Real a = 0.25, b = 0.045, sigma = 0.012, r0 = 0.03;
+
+    ShortRateCalibrationInput in;
+    in.model_type = "vasicek";
+    in.a = a;
+    in.b = b;
+    in.sigma = sigma;
+    in.r0 = r0;
+    in.quotes = make_gaussian_quotes("vasicek", a, b, sigma, r0);
+    in.max_iterations = 1;
+
+    const auto res = calibrate_short_rate(in);
+
+    for (std::size_t i = 0; i < in.quotes.size(); ++i)
+        EXPECT_NEAR(res.model_prices[i], in.quotes[i].market_price,
+                    1e-13 * std::max(1.0, in.quotes[i].market_price));
+}
+
+TEST(ShortRateCalibration, ThreadCountDoesNotChangeResult)
+{
+    const Real a = 0.25, b = 0.045, sigma = 0.012, r0 = 0.03;
+
+    ShortRateCalibrationInput in;
+    in.model_type = "vasicek";
+    in.a = 0.1;
+    in.b = 0.03;
+    in.sigma = 0.02;
+    in.r0 = r0;
+    in.quotes = make_gaussian_quotes("vasicek", a, b, sigma, r0);
+
+    in.n_threads = 1;
+    const auto serial = calibrate_short_rate(in);
+    in.n_threads = 4;
+    const auto threaded = calibrate_short_rate(in);
+
+    EXPECT_EQ(serial.iterations, threaded.iterations);
+    EXPECT_DOUBLE_EQ(serial.a, threaded.a);
+    EXPECT_DOUBLE_EQ(serial.b, threaded.b);
+    EXPECT_DOUBLE_EQ(serial.sigma, threaded.sigma);
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  CIR — ZCB quotes only
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(ShortRateCalibration, CIRFitsZeroCouponCurve)
+{
+    // A ZCB curve alone identifies σ only weakly under CIR (σ → 0 fits to
+    // ~1bp as well), so only the fit quality and admissibility are checked.
+    const Real a = 0.4, b = 0.05, sigma = 0.08, r0 = 0.03;
+
+    ShortRateCalibrationInput in;
+    in.model_type = "cir";
+    in.a = 0.3;
+    in.b = 0.04;
+    in.sigma = 0.05;
+    in.r0 = r0;
+    for (Real T : {0.5, 1.0, 2.0, 3.0, 5.0, 7.0, 10.0, 15.0, 20.0, 30.0})
+    {
+        ShortRateZCBInput zin{"cir", a, b, sigma, r0, T, 1.0};
+        ShortRateQuote q;
+        q.type = ShortRateQuoteType::ZeroCouponBond;
+        q.end = T;
+        q.market_price = price_zcb_short_rate(zin).npv;
+        in.quotes.push_back(q);
+    }
+
+    const auto res = calibrate_short_rate(in);
+
+    EXPECT_LT(res.rmse, 2e-5) << res.diagnostics;
+    EXPECT_GT(res.a, 0.0);
+    EXPECT_GE(2.0 * res.a * res.b, res.sigma * res.sigma);
+    for (std::size_t i = 1; i < res.history.size(); ++i)
+        EXPECT_LE(res.history[i].objective, res.history[i - 1].objective);
+}
+
+TEST(ShortRateCalibration, UnfittableQuotesDoNotConverge)
+{
+    // ZCBs above par need negative rates, which CIR cannot produce: the fit
+    // stalls with no acceptable step and must not be reported as converged.
+    ShortRateCalibrationInput in;
+    in.model_type = "cir";
+    in.a = 0.3;
+    in.b = 0.04;
+    in.sigma = 0.05;
+    in.r0 = 0.03;
+    for (Real T : {1.0, 2.0, 5.0, 10.0})
+    {
+        ShortRateQuote q;
+        q.type = ShortRateQuoteType::ZeroCouponBond;
+        q.end = T;
+        q.market_price = 1.05;
+        in.quotes.push_back(q);
+    }
+
+    const auto res = calibrate_short_rate(in);
+
+    EXPECT_FALSE(res.converged) << res.diagnostics;
+    EXPECT_NE(res.diagnostics.find("damping saturated"), std::string::npos) << res.diagnostics;
+    EXPECT_GT(res.rmse, 0.05);
+}
+
+TEST(ShortRateCalibration, CIROptionQuoteThrows)
+{
+    ShortRateCalibrationInput in;
+    in.model_type = "cir";
+    in.a = 0.5;
+    in.b = 0.05;
+    in.sigma = 0.01;
+    in.r0 = 0.04;
+    ShortRateQuote q;
+    q.type = ShortRateQuoteType::Caplet;
+    q.start = 1.0;
+    q.end = 1.5;
+    q.strike = 0.05;
+    q.market_price = 0.001;
+    in.quotes.push_back(q);
+
+    EXPECT_THROW(calibrate_short_rate(in), UnsupportedInstrument);
+}
+
+TEST(ShortRateCalibration, InvalidInputs)
+{
+    ShortRateCalibrationInput in;
+    in.model_type = "vasicek";
+    EXPECT_THROW(calibrate_short_rate(in), InvalidInput); // no quotes
+
+    ShortRateQuote q;
+    q.type = ShortRateQuoteType::BondOption;
+    q.start = 2.0;
+    q.end = 1.0; // end before expiry
+    q.strike = 0.9;
+    in.quotes.push_back(q);
+    EXPECT_THROW(calibrate_short_rate(in), InvalidInput);
+
+    in.quotes.clear();
+    q.start = 1.0;
+    q.end = 2.0;
+    in.quotes.push_back(q);
+    in.model_type = "ho_lee";
+    EXPECT_THROW(calibrate_short_rate(in), InvalidInput);
+}
@@ -733,3 +733,104 @@ TEST(CIRZCB, MonotonicInMaturity)
         prev = P;
     }
 }
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  Coupon-bond options (Jamshidian) and caplet strips
+// ═════════════════════════════════════════════════════════════════════════════
+
+TEST(JamshidianCouponBondOption, ZeroCouponMatchesClosedForm)
+{
+    VasicekModel m(0.3, 0.06, 0.015, 0.05);
+    const Real single = jamshidian_coupon_bond_option(m, true, 0.8, 1.0, {5.0}, {1.0});
+    EXPECT_NEAR(single, m.bond_option_price(true, 0.8, 1.0, 5.0), 1e-14);
+}
+
+TEST(JamshidianCouponBondOption, PutCallParity)
+{
+    HullWhiteModel m(0.1, 0.005, 0.01, 0.03);
+    BondOption call(1.0, 5.0, 1.0, true, 1.0);
+    call.coupon_rate = 0.04;
+    call.coupon_frequency = 2;
+    BondOption put = call;
+    put.is_call = false;
+
+    std::vector<Time> times;
+    std::vector<Real> amounts;
+    call.cash_flows_after_expiry(times, amounts);
+    ASSERT_EQ(times.size(), 8u); // coupons at 1.5, 2.0, ..., 5.0
+
+    auto model = std::make_shared<HullWhiteModel>(m);
+    PricingContext ctx{MarketView{}, PricingSettings{}, model};
+    ShortRateAnalyticEngine engine(ctx);
+    const Real C = price(call, engine).npv;
+    const Real P = price(put, engine).npv;
+
+    Real fwd = 0.0;
+    for (std::size_t i = 0; i < times.size(); ++i)
+        fwd += amounts[i] * m.zcb_price(times[i]);
+    EXPECT_NEAR(C - P, fwd - 1.0 * m.zcb_price(1.0), 1e-13);
+    EXPECT_GT(C, 0.0);
+    EXPECT_GT(P, 0.0);
+}
+
+TEST(JamshidianCouponBondOption, MatchesMonteCarlo)
+{
+    ShortRateBondOptionInput in;
+    in.model_type = "vasicek";
+    in.a = 0.3;
+    in.b = 0.06;
+    in.sigma = 0.015;
+    in.r0 = 0.05;
+    in.option_maturity = 2.0;
+    in.bond_maturity = 7.0;
+    in.strike = 0.95;
+    in.is_call = true;
+    in.notional = 100.0;
+    in.coupon_rate = 0.05;
+    in.coupon_frequency = 1;
+    in.n_paths = 200000;
+    in.seed = 7;
+
+    const auto analytic = price_bond_option_short_rate_analytic(in);
+    const auto mc = price_bond_option_short_rate_mc(in);
+    EXPECT_NEAR(mc.npv, analytic.npv, 4.0 * mc.mc_std_error + 0.01);
+}
+
+TEST(JamshidianCouponBondOption, CIRThrows)
+{
+    auto model = std::make_shared<CIRModel>(0.5, 0.05, 0.01, 0.04);
+    PricingContext ctx{MarketView{}, PricingSettings{}, model};
+    ShortRateAnalyticEngine engine(ctx);
+    BondOption opt(1.0, 3.0, 1.0, true, 1.0);
+    opt.coupon_rate = 0.05;
+    EXPECT_THROW(price(opt, engine), UnsupportedInstrument);
+}
+
+TEST(CapletStrip, MatchesPerCapletBondOptions)
+{
+    VasicekModel m(0.3, 0.06, 0.015, 0.05);
+    const std::vector<Time> schedule = {-0.25, 0.0, 0.25, 0.5, 1.0, 2.0, 3.5};
+    const Real K = 0.055;
+
+    for (bool is_cap : {true, false})
+    {
+        const auto strip = price_caplet_strip(m, schedule, K, is_cap);
+        ASSERT_EQ(strip.size(), schedule.size() - 1);
+        EXPECT_EQ(strip[0], 0.0);
+        EXPECT_EQ(strip[1], 0.0);
+        for (std::size_t i = 2; i < strip.size(); ++i)
+        {
+            const Real factor = 1.0 + K * (schedule[i + 1] - schedule[i]);
+            const Real ref = factor * m.bond_option_price(!is_cap, 1.0 / factor,
+                                                          schedule[i], schedule[i + 1]);
+            EXPECT_NEAR(strip[i], ref, 1e-15);
+        }
+    }
+}
+
+TEST(CapletStrip, CIRFallsBackAndThrows)
+{
+    CIRModel m(0.5, 0.05, 0.01, 0.04);
+    EXPECT_THROW(price_caplet_strip(m, {0.5, 1.0, 1.5}, 0.05, true), UnsupportedInstrument);
+    EXPECT_THROW(price_caplet_strip(m, {0.5, 0.5}, 0.05, true), InvalidInput);
+}
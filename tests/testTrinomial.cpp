@@ -144,6 +144,18 @@ namespace quantModeling
         EXPECT_NEAR(tree_delta, ana_delta, 0.01);
     }
 
+    TEST(TrinomialTree, GammaAndThetaConvergeToBS)
+    {
+        // Read off the lattice nodes around t = 0, not from re-built trees.
+        for (bool is_call : {true, false})
+        {
+            const auto ana = priceAnalytic(is_call);
+            const auto tree = priceTrinomial(is_call, 500);
+            EXPECT_NEAR(*tree.greeks.gamma, *ana.greeks.gamma, 0.02 * *ana.greeks.gamma);
+            EXPECT_NEAR(*tree.greeks.theta, *ana.greeks.theta, 0.05);
+        }
+    }
+
     // ─────────────────────────────────────────────────────────────────────────
     //  Trinomial vs Binomial consistency
     // ─────────────────────────────────────────────────────────────────────────
@@ -2,10 +2,15 @@
 
 #include "quantModeling/utils/rng.hpp"
 #include "quantModeling/utils/stats.hpp"
+#include "quantModeling/utils/thread_pool.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <numeric>
+#include <string>
+#include <thread>
 #include <vector>
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -81,6 +86,128 @@ namespace quantModeling
         }
     }
 
+    TEST(Stats, NormCdfRelativeAccuracy)
+    {
+        // Reference: extended-precision erfc.  Covers all three rational
+        // regions and the deep lower tail.
+        Real worst = 0.0;
+        for (Real x = -37.0; x <= 9.0; x += 0.00731)
+        {
+            const long double ref =
+                0.5L * std::erfc(-static_cast<long double>(x) / std::sqrt(2.0L));
+            const Real rel = static_cast<Real>(
+                std::abs((static_cast<long double>(norm_cdf(x)) - ref) / ref));
+            worst = std::max(worst, rel);
+        }
+        EXPECT_LT(worst, 1e-15);
+    }
+
+    TEST(Stats, NormPdfMatchesStdExp)
+    {
+        for (Real x = -30.0; x <= 30.0; x += 0.0137)
+        {
+            const Real ref = std::exp(-0.5 * x * x) / std::sqrt(2.0 * M_PI);
+            EXPECT_NEAR(norm_pdf(x), ref, 1e-15 * ref) << "x=" << x;
+        }
+    }
+
+    TEST(Stats, ArrayOverloadsMatchScalar)
+    {
+        std::vector<Real> x, cdf(1001), pdf(1001);
+        for (int i = 0; i <= 1000; ++i)
+            x.push_back(-10.0 + 0.02 * i);
+        norm_cdf(x.data(), cdf.data(), x.size());
+        norm_pdf(x.data(), pdf.data(), x.size());
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            EXPECT_NEAR(cdf[i], norm_cdf(x[i]), 1e-15 * norm_cdf(x[i]));
+            EXPECT_NEAR(pdf[i], norm_pdf(x[i]), 1e-15 * norm_pdf(x[i]));
+        }
+    }
+
+    TEST(Stats, NormCdfBenchmarkVsErfc)
+    {
+        // Micro-benchmark: array norm_cdf vs the former 0.5·erfc(−x/√2),
+        // recorded as test properties and not asserted.  With the default
+        // SSE2 build the two are on par (the change is one of accuracy); the
+        // array loop is several times faster with QM_NATIVE_ARCH.
+        constexpr std::size_t n = 1 << 18;
+        std::vector<Real> x(n), out(n);
+        for (std::size_t i = 0; i < n; ++i)
+            x[i] = -8.0 + 16.0 * static_cast<Real>(i) / static_cast<Real>(n);
+
+        Real best_fast = 1e300, best_erfc = 1e300, sink = 0.0;
+        for (int rep = 0; rep < 5; ++rep)
+        {
+            auto t0 = std::chrono::steady_clock::now();
+            norm_cdf(x.data(), out.data(), n);
+            auto t1 = std::chrono::steady_clock::now();
+            sink += out[n / 3];
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = 0.5 * std::erfc(-x[i] / std::sqrt(2.0));
+            auto t2 = std::chrono::steady_clock::now();
+            sink += out[n / 3];
+            best_fast = std::min(best_fast, std::chrono::duration<Real, std::milli>(t1 - t0).count());
+            best_erfc = std::min(best_erfc, std::chrono::duration<Real, std::milli>(t2 - t1).count());
+        }
+        RecordProperty("norm_cdf_ms", std::to_string(best_fast));
+        RecordProperty("erfc_ms", std::to_string(best_erfc));
+        EXPECT_GT(sink, 0.0);
+    }
+
+    // ─────────────────────────────────────────────────────────────────────────
+    //  Bivariate / trivariate normal CDF
+    // ─────────────────────────────────────────────────────────────────────────
+
+    TEST(Stats, BivariateNormCdfIdentities)
+    {
+        constexpr Real pi = 3.14159265358979323846;
+        for (Real rho : {-0.99, -0.95, -0.6, -0.2, 0.0, 0.25, 0.5, 0.8, 0.93, 0.999})
+        {
+            // Orthant probability and independence limit.
+            EXPECT_NEAR(bivariate_norm_cdf(0.0, 0.0, rho), 0.25 + std::asin(rho) / (2.0 * pi), 1e-15);
+            for (Real a : {-2.5, -0.7, 0.3, 1.9})
+                for (Real b : {-1.2, 0.0, 0.8, 3.1})
+                {
+                    // P(X ≤ a, Y ≤ b) + P(X ≤ a, −Y ≤ −b) = N(a), with −Y correlated −ρ.
+                    EXPECT_NEAR(bivariate_norm_cdf(a, b, rho) + bivariate_norm_cdf(a, -b, -rho),
+                                norm_cdf(a), 1e-14)
+                        << "a=" << a << " b=" << b << " rho=" << rho;
+                    EXPECT_NEAR(bivariate_norm_cdf(a, b, rho), bivariate_norm_cdf(b, a, rho), 1e-15);
+                }
+        }
+        EXPECT_NEAR(bivariate_norm_cdf(0.4, -1.1, 0.0), norm_cdf(0.4) * norm_cdf(-1.1), 1e-15);
+        EXPECT_NEAR(bivariate_norm_cdf(0.4, -1.1, 1.0), norm_cdf(-1.1), 1e-15);
+        EXPECT_NEAR(bivariate_norm_cdf(0.4, -0.1, -1.0), norm_cdf(0.4) + norm_cdf(-0.1) - 1.0, 1e-15);
+    }
+
+    TEST(Stats, TrivariateNormCdfIdentities)
+    {
+        constexpr Real pi = 3.14159265358979323846;
+        const Real r12 = 0.3, r13 = -0.45, r23 = 0.6;
+        EXPECT_NEAR(trivariate_norm_cdf(0.0, 0.0, 0.0, r12, r13, r23),
+                    0.125 + (std::asin(r12) + std::asin(r13) + std::asin(r23)) / (4.0 * pi), 1e-14);
+
+        // Independent first variable factorises.
+        EXPECT_NEAR(trivariate_norm_cdf(0.7, -0.2, 1.1, 0.0, 0.0, r23),
+                    norm_cdf(0.7) * bivariate_norm_cdf(-0.2, 1.1, r23), 1e-15);
+
+        // A far upper limit marginalises that variable out, whichever it is.
+        EXPECT_NEAR(trivariate_norm_cdf(0.7, -0.2, 40.0, r12, r13, r23),
+                    bivariate_norm_cdf(0.7, -0.2, r12), 1e-14);
+        EXPECT_NEAR(trivariate_norm_cdf(40.0, -0.2, 1.1, r12, r13, r23),
+                    bivariate_norm_cdf(-0.2, 1.1, r23), 1e-14);
+
+        // Inclusion-exclusion in the sign of one variable, on a near-singular
+        // matrix (det ≈ 0.002) where the Plackett integrand is steep.
+        const Real s12 = -0.176, s13 = -0.849, s23 = -0.369;
+        for (Real c : {-1.0, 0.2, 1.5})
+            EXPECT_NEAR(trivariate_norm_cdf(0.5, -0.3, c, s12, s13, s23) +
+                            trivariate_norm_cdf(0.5, -0.3, -c, s12, -s13, -s23),
+                        bivariate_norm_cdf(0.5, -0.3, s12), 1e-13)
+                << "c=" << c;
+    }
+
 } // namespace quantModeling
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -270,3 +397,106 @@ TEST(Antithetic, DisabledIsNormal)
         EXPECT_DOUBLE_EQ(gen(rng1), gauss(rng2));
     }
 }
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  WorkStealingPool
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(WorkStealingPool, RunsEveryIndexOnce)
+{
+    quantModeling::WorkStealingPool pool(4);
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallel_for(hits.size(), [&](std::size_t i)
+                      { hits[i].fetch_add(1); });
+    for (const auto &h : hits)
+        EXPECT_EQ(h.load(), 1);
+}
+
+TEST(WorkStealingPool, LongTaskDoesNotBlockItsQueue)
+{
+    // Index 0 waits until every other index has run.  With two workers the
+    // tasks dealt behind it onto its own deque can only run if they are
+    // stolen; the wait is bounded so that a regression fails, not hangs.
+    quantModeling::WorkStealingPool pool(2);
+    constexpr std::size_t n = 64;
+    std::atomic<std::size_t> finished{0};
+    bool others_ran_first = false;
+    pool.parallel_for(n, [&](std::size_t i)
+                      {
+        if (i != 0)
+        {
+            finished.fetch_add(1);
+            return;
+        }
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (finished.load() < n - 1 && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+        others_ran_first = finished.load() == n - 1; });
+    EXPECT_TRUE(others_ran_first);
+}
+
+TEST(WorkStealingPool, CallerOnlyHelpsWithItsOwnCall)
+{
+    // One worker and a thread in call A are both held in A's tasks, and a
+    // third A task is left queued.  Call B must finish its own cheap tasks
+    // without picking that one up.
+    quantModeling::WorkStealingPool pool(1);
+    std::atomic<int> a_started{0};
+    std::atomic<bool> release{false};
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    std::thread a([&]
+                  { pool.parallel_for(3, [&](std::size_t)
+                                      {
+                                          a_started.fetch_add(1);
+                                          while (!release.load() && std::chrono::steady_clock::now() < deadline)
+                                              std::this_thread::yield(); }); });
+    while (a_started.load() < 2 && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::yield();
+
+    std::atomic<int> b_ran{0};
+    pool.parallel_for(4, [&](std::size_t)
+                      { b_ran.fetch_add(1); });
+    EXPECT_EQ(b_ran.load(), 4);
+    EXPECT_EQ(a_started.load(), 2);
+
+    release.store(true);
+    a.join();
+    EXPECT_EQ(a_started.load(), 3);
+}
+
+TEST(WorkStealingPool, NestedCallsComplete)
+{
+    quantModeling::WorkStealingPool pool(2);
+    std::atomic<int> total{0};
+    pool.parallel_for(8, [&](std::size_t)
+                      { pool.parallel_for(8, [&](std::size_t)
+                                          { total.fetch_add(1); }); });
+    EXPECT_EQ(total.load(), 64);
+}
+
+TEST(WorkStealingPool, InTaskOnlyWhileRunningTasks)
+{
+    using quantModeling::WorkStealingPool;
+    WorkStealingPool pool(2);
+    EXPECT_FALSE(WorkStealingPool::in_task());
+    std::atomic<int> inside{0};
+    pool.parallel_for(16, [&](std::size_t)
+                      {
+                          if (WorkStealingPool::in_task())
+                              inside.fetch_add(1); });
+    EXPECT_EQ(inside.load(), 16);
+    EXPECT_FALSE(WorkStealingPool::in_task());
+}
+
+TEST(WorkStealingPool, RethrowsAfterRunningTheRest)
+{
+    quantModeling::WorkStealingPool pool(3);
+    std::atomic<int> ran{0};
+    EXPECT_THROW(pool.parallel_for(100, [&](std::size_t i)
+                                   {
+                                       ran.fetch_add(1);
+                                       if (i == 7)
+                                           throw quantModeling::InvalidInput("boom"); }),
+                 quantModeling::InvalidInput);
+    EXPECT_EQ(ran.load(), 100);
+}